@@ -0,0 +1,52 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+
+/**
+ * Լ ݺ ϰ 1ȸ   ð   ϴ.
+ * ̶, Լ ݺ Ƚ ε ڷ ޽ϴ.
+ */
+template <typename TFunction>
+double MeasureAverageNanoseconds(uint64_t iterations, const TFunction& function)
+{
+	std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+	for (uint64_t index = 0; index < iterations; ++index)
+	{
+		function(index);
+	}
+	std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+
+	return std::chrono::duration<double, std::nano>(end - begin).count() / static_cast<double>(iterations);
+}
+
+/**
+ * ġũ  մϴ.
+ * üũ Ϸ ġũ  ڵ带  ϵ   Һϱ  մϴ.
+ */
+inline void PrintBenchResult(const char* name, double nanoseconds, uint64_t checksum)
+{
+	std::printf("  %-48s %12.2f ns/op  (checksum: %llu)\n", name, nanoseconds, static_cast<unsigned long long>(checksum));
+}
+
+/** ̸ Ʈ(std::map FlatHashMap) ȸ  մϴ. */
+void RunNameRegistryBench();
+
+/**  Ʒ mimalloc   ӽ Ҵ  մϴ. */
+void RunFrameArenaBench();
+
+/**  Ŵ ۾   ParallelFor  ó ȿ մϴ. */
+void RunJobSystemBench();
+
+/**  ť  / (CPU  ) մϴ. */
+void RunRenderQueueBench();
+
+/** ޽ ȭ  ACMR ȭ  մϴ. */
+void RunMeshOptimizerBench();
+
+/**
+ * ū ؽó  ڵ  ״ ϴ  ¡ ۿ ϴ  ð ִ  ޸𸮸 մϴ.
+ * OpenGL ؽƮ Ƿ Texture2D ε  ʰ, ε  CPU 븸 ϴ 븮 Դϴ.
+ */
+void RunTextureDecodeCopyBench();
\ No newline at end of file
@@ -0,0 +1,129 @@
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <mimalloc.h>
+
+#include "Utils/FrameArena.h"
+
+#include "Bench.h"
+
+static const uint64_t FRAME_COUNT = 2000;
+
+/**    ϴ  ӽ Ҵ Դϴ.  , ü   ӽ ͸ մϴ. */
+static const uint32_t SMALL_ALLOCATION_COUNT = 4096;
+
+/**    ϴ ӽ ̳   Դϴ. */
+static const uint32_t CONTAINER_COUNT = 64;
+static const uint32_t CONTAINER_ELEMENT_COUNT = 512;
+
+/** Ҵ ũⰡ б ⿡ н ʵ 16~256 Ʈ ǻ  ũ⸦ ̸ մϴ. */
+static std::vector<uint32_t> MakeAllocationSizes()
+{
+	std::vector<uint32_t> allocationSizes(SMALL_ALLOCATION_COUNT);
+
+	uint32_t state = 0x12345678;
+	for (auto& allocationSize : allocationSizes)
+	{
+		state = state * 1664525u + 1013904223u;
+		allocationSize = 16 + ((state >> 8) % 241);
+	}
+
+	return allocationSizes;
+}
+
+void RunFrameArenaBench()
+{
+	std::vector<uint32_t> allocationSizes = MakeAllocationSizes();
+	std::vector<void*> allocations(SMALL_ALLOCATION_COUNT);
+
+	std::printf(" small allocations: %u per frame\n", SMALL_ALLOCATION_COUNT);
+
+	uint64_t checksum = 0;
+	double nanoseconds = MeasureAverageNanoseconds(FRAME_COUNT, [&](uint64_t frame)
+	{
+		for (uint32_t index = 0; index < SMALL_ALLOCATION_COUNT; ++index)
+		{
+			allocations[index] = mi_malloc(allocationSizes[index]);
+			std::memset(allocations[index], static_cast<int32_t>(frame), allocationSizes[index]);
+		}
+
+		for (uint32_t index = 0; index < SMALL_ALLOCATION_COUNT; ++index)
+		{
+			checksum += *reinterpret_cast<uint8_t*>(allocations[index]);
+			mi_free(allocations[index]);
+		}
+	});
+	PrintBenchResult("mi_malloc/mi_free (per frame)", nanoseconds, checksum);
+
+	checksum = 0;
+	nanoseconds = MeasureAverageNanoseconds(FRAME_COUNT, [&](uint64_t frame)
+	{
+		FrameArena::BeginFrame();
+		for (uint32_t index = 0; index < SMALL_ALLOCATION_COUNT; ++index)
+		{
+			allocations[index] = FrameArena::Allocate(allocationSizes[index]);
+			std::memset(allocations[index], static_cast<int32_t>(frame), allocationSizes[index]);
+		}
+
+		for (uint32_t index = 0; index < SMALL_ALLOCATION_COUNT; ++index)
+		{
+			checksum += *reinterpret_cast<uint8_t*>(allocations[index]);
+		}
+	});
+	PrintBenchResult("FrameArena::Allocate (per frame)", nanoseconds, checksum);
+
+	std::printf(" temporary containers: %u vectors x %u elements, %u strings per frame\n", CONTAINER_COUNT, CONTAINER_ELEMENT_COUNT, CONTAINER_COUNT);
+
+	checksum = 0;
+	nanoseconds = MeasureAverageNanoseconds(FRAME_COUNT, [&](uint64_t frame)
+	{
+		for (uint32_t container = 0; container < CONTAINER_COUNT; ++container)
+		{
+			std::vector<uint32_t> indices;
+			for (uint32_t index = 0; index < CONTAINER_ELEMENT_COUNT; ++index)
+			{
+				indices.push_back(index ^ static_cast<uint32_t>(frame));
+			}
+
+			char number[16];
+			std::snprintf(number, sizeof(number), "%u", container);
+
+			std::string name = "Resource/Shader/";
+			name += number;
+			name += "/Instance";
+
+			checksum += indices.back() + name.size();
+		}
+	});
+	PrintBenchResult("std::vector/std::string (per frame)", nanoseconds, checksum);
+
+	checksum = 0;
+	nanoseconds = MeasureAverageNanoseconds(FRAME_COUNT, [&](uint64_t frame)
+	{
+		FrameArena::BeginFrame();
+		for (uint32_t container = 0; container < CONTAINER_COUNT; ++container)
+		{
+			FrameVector<uint32_t> indices;
+			for (uint32_t index = 0; index < CONTAINER_ELEMENT_COUNT; ++index)
+			{
+				indices.push_back(index ^ static_cast<uint32_t>(frame));
+			}
+
+			char number[16];
+			std::snprintf(number, sizeof(number), "%u", container);
+
+			FrameString name = "Resource/Shader/";
+			name += number;
+			name += "/Instance";
+
+			checksum += indices.back() + name.size();
+		}
+	});
+	PrintBenchResult("FrameVector/FrameString (per frame)", nanoseconds, checksum);
+
+	FrameArenaStatistics statistics = FrameArena::GetStatistics();
+	std::printf(" frame arena: threads: %u, high-water: %llu bytes, capacity: %llu bytes\n", statistics.threadCount, static_cast<unsigned long long>(statistics.highWaterByteSize), static_cast<unsigned long long>(statistics.capacityByteSize));
+}
\ No newline at end of file
@@ -0,0 +1,102 @@
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+#include "Job/JobManager.h"
+
+#include "Bench.h"
+
+/** ۾ /      ϴ  ۾ Դϴ. */
+static const uint32_t EMPTY_JOB_COUNT = 65536;
+static const uint64_t EMPTY_JOB_ROUND_COUNT = 20;
+
+/**  ó     ݺ ȽԴϴ. */
+static const uint32_t BALL_COUNT = 1 << 20;
+static const uint32_t BALL_BATCH_SIZE = 4096;
+static const uint64_t BALL_ROUND_COUNT = 20;
+
+/** ġũ  Դϴ. */
+struct BallState
+{
+	float position[3];
+	float velocity[3];
+};
+
+/**  ϳ ̵  浹 մϴ.  ó ȿ ϱ  sqrt  մϴ. */
+static void UpdateBall(BallState& ball, float deltaSeconds)
+{
+	for (uint32_t axis = 0; axis < 3; ++axis)
+	{
+		ball.position[axis] += ball.velocity[axis] * deltaSeconds;
+		if (std::fabs(ball.position[axis]) > 100.0f)
+		{
+			ball.velocity[axis] = -ball.velocity[axis];
+		}
+	}
+
+	float speed = std::sqrt(ball.velocity[0] * ball.velocity[0] + ball.velocity[1] * ball.velocity[1] + ball.velocity[2] * ball.velocity[2]);
+	float damping = 1.0f / (1.0f + 0.001f * speed);
+	for (uint32_t axis = 0; axis < 3; ++axis)
+	{
+		ball.velocity[axis] *= damping;
+	}
+}
+
+void RunJobSystemBench()
+{
+	JobManager& jobManager = JobManager::GetRef();
+	jobManager.Startup();
+
+	std::printf(" workers: %u (+ main thread)\n", jobManager.GetWorkerCount());
+
+	uint64_t checksum = 0;
+	double nanoseconds = MeasureAverageNanoseconds(EMPTY_JOB_ROUND_COUNT, [&](uint64_t round)
+	{
+		JobCounter counter;
+		for (uint32_t index = 0; index < EMPTY_JOB_COUNT; ++index)
+		{
+			jobManager.Submit([]() {}, &counter);
+		}
+		jobManager.Wait(counter);
+		checksum += round;
+	});
+	PrintBenchResult("Submit + Wait (per empty job)", nanoseconds / static_cast<double>(EMPTY_JOB_COUNT), checksum);
+
+	std::vector<BallState> balls(BALL_COUNT);
+	for (uint32_t index = 0; index < BALL_COUNT; ++index)
+	{
+		balls[index] = { { 0.0f, 0.0f, 0.0f }, { static_cast<float>(index % 7), static_cast<float>(index % 11), static_cast<float>(index % 13) } };
+	}
+
+	std::printf(" balls: %u, batch: %u\n", BALL_COUNT, BALL_BATCH_SIZE);
+
+	checksum = 0;
+	double serialNanoseconds = MeasureAverageNanoseconds(BALL_ROUND_COUNT, [&](uint64_t round)
+	{
+		for (auto& ball : balls)
+		{
+			UpdateBall(ball, 0.016f);
+		}
+		checksum += static_cast<uint64_t>(balls[round].position[0]);
+	});
+	PrintBenchResult("serial update (per round)", serialNanoseconds, checksum);
+
+	checksum = 0;
+	double parallelNanoseconds = MeasureAverageNanoseconds(BALL_ROUND_COUNT, [&](uint64_t round)
+	{
+		jobManager.ParallelFor(BALL_COUNT, BALL_BATCH_SIZE, [&](uint32_t begin, uint32_t end)
+		{
+			for (uint32_t index = begin; index < end; ++index)
+			{
+				UpdateBall(balls[index], 0.016f);
+			}
+		});
+		checksum += static_cast<uint64_t>(balls[round].position[0]);
+	});
+	PrintBenchResult("ParallelFor update (per round)", parallelNanoseconds, checksum);
+
+	std::printf(" speedup: %.2fx\n", serialNanoseconds / parallelNanoseconds);
+
+	jobManager.Shutdown();
+}
\ No newline at end of file
@@ -0,0 +1,46 @@
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+#include "Bench.h"
+
+/**   ġũ Դϴ. */
+struct BenchSuite
+{
+	const char* name;
+	void (*run)();
+};
+
+static const BenchSuite BENCH_SUITES[] =
+{
+	{ "NameRegistry", RunNameRegistryBench },
+	{ "FrameArena", RunFrameArenaBench },
+	{ "JobSystem", RunJobSystemBench },
+	{ "RenderQueue", RunRenderQueueBench },
+	{ "MeshOptimizer", RunMeshOptimizerBench },
+	{ "TextureDecodeCopy", RunTextureDecodeCopyBench },
+};
+
+/**
+ *  ڷ ޵ ̸ ġũ մϴ. ڰ ٸ  ġũ մϴ.
+ * ex) DodgeBallBench NameRegistry
+ */
+int32_t main(int32_t argc, char* argv[])
+{
+	for (const auto& benchSuite : BENCH_SUITES)
+	{
+		bool bIsSelected = (argc <= 1);
+		for (int32_t index = 1; index < argc; ++index)
+		{
+			bIsSelected = bIsSelected || (std::strcmp(argv[index], benchSuite.name) == 0);
+		}
+
+		if (bIsSelected)
+		{
+			std::printf("[%s]\n", benchSuite.name);
+			benchSuite.run();
+		}
+	}
+
+	return 0;
+}
\ No newline at end of file
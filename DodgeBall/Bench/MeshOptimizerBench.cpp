@@ -0,0 +1,105 @@
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include "GL/IndexBuffer.h"
+#include "GL/MeshOptimizer.h"
+
+#include "Bench.h"
+
+/**   ޽     ȭ ݺ ȽԴϴ. */
+static const uint32_t GRID_CELL_COUNT = 128;
+static const uint64_t OPTIMIZE_ROUND_COUNT = 10;
+
+/** ؽ ġ ȭ  Ǵ ؽԴϴ. */
+struct BenchVertex
+{
+	float position[3];
+	float normal[3];
+};
+
+/**  ޽ø մϴ.    ġǹǷ,   ĳú   ࿡  ؽ ٽ о մϴ. */
+static void CreateGridMesh(std::vector<BenchVertex>& outVertices, std::vector<uint32_t>& outIndices)
+{
+	uint32_t rowVertexCount = GRID_CELL_COUNT + 1;
+
+	outVertices.resize(rowVertexCount * rowVertexCount);
+	for (uint32_t vertex = 0; vertex < outVertices.size(); ++vertex)
+	{
+		outVertices[vertex] = { { static_cast<float>(vertex % rowVertexCount), 0.0f, static_cast<float>(vertex / rowVertexCount) }, { 0.0f, 1.0f, 0.0f } };
+	}
+
+	outIndices.clear();
+	for (uint32_t row = 0; row < GRID_CELL_COUNT; ++row)
+	{
+		for (uint32_t column = 0; column < GRID_CELL_COUNT; ++column)
+		{
+			uint32_t topLeft = row * rowVertexCount + column;
+			uint32_t bottomLeft = topLeft + rowVertexCount;
+			outIndices.insert(outIndices.end(), { topLeft, bottomLeft, topLeft + 1, topLeft + 1, bottomLeft, bottomLeft + 1 });
+		}
+	}
+}
+
+/** ﰢ   ϴ.  ޽ø ġų   ʴ ͽ  䳻 ϴ. */
+static void ShuffleTriangles(std::vector<uint32_t>& indices)
+{
+	uint32_t triangleCount = static_cast<uint32_t>(indices.size() / 3);
+
+	std::vector<uint32_t> order(triangleCount);
+	for (uint32_t triangle = 0; triangle < triangleCount; ++triangle)
+	{
+		order[triangle] = triangle;
+	}
+
+	std::mt19937 generator(1234u);
+	std::shuffle(order.begin(), order.end(), generator);
+
+	std::vector<uint32_t> shuffleIndices(indices.size());
+	for (uint32_t triangle = 0; triangle < triangleCount; ++triangle)
+	{
+		std::copy(indices.begin() + order[triangle] * 3, indices.begin() + order[triangle] * 3 + 3, shuffleIndices.begin() + triangle * 3);
+	}
+
+	indices.swap(shuffleIndices);
+}
+
+/** ޽ø ȭϰ ACMR ҿ ð մϴ. */
+static void RunOptimize(const char* name, const std::vector<BenchVertex>& sourceVertices, const std::vector<uint32_t>& sourceIndices)
+{
+	MeshOptimizationStatistics statistics;
+	uint64_t checksum = 0;
+
+	double nanoseconds = MeasureAverageNanoseconds(OPTIMIZE_ROUND_COUNT, [&](uint64_t round)
+	{
+		std::vector<BenchVertex> vertices = sourceVertices;
+		std::vector<uint32_t> indices = sourceIndices;
+
+		statistics = MeshOptimizer::Optimize(vertices, indices);
+		checksum += indices[round % indices.size()];
+	});
+	PrintBenchResult(name, nanoseconds, checksum);
+
+	std::printf(" ACMR (FIFO %u): %.3f -> %.3f, vertices: %u -> %u\n", MeshOptimizer::DEFAULT_CACHE_SIZE, statistics.acmrBefore, statistics.acmrAfter, statistics.vertexCountBefore, statistics.vertexCountAfter);
+}
+
+void RunMeshOptimizerBench()
+{
+	std::vector<BenchVertex> vertices;
+	std::vector<uint32_t> indices;
+	CreateGridMesh(vertices, indices);
+
+	uint32_t indexCount = static_cast<uint32_t>(indices.size());
+	uint32_t vertexCount = static_cast<uint32_t>(vertices.size());
+	std::printf(" grid mesh: %u vertices, %u triangles\n", vertexCount, indexCount / 3);
+
+	IndexBuffer::EType indexType = IndexBuffer::SelectType(vertexCount - 1);
+	std::printf(" index memory: %u bytes (%u-bit) vs. %u bytes (32-bit)\n", indexCount * IndexBuffer::GetIndexSize(indexType), 8 * IndexBuffer::GetIndexSize(indexType), indexCount * 4);
+
+	RunOptimize("row order grid (per mesh)", vertices, indices);
+
+	ShuffleTriangles(indices);
+	RunOptimize("shuffled grid (per mesh)", vertices, indices);
+}
\ No newline at end of file
@@ -0,0 +1,79 @@
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "GL/GLResource.h"
+
+#include "Utils/FlatHashMap.h"
+#include "Utils/NameID.h"
+#include "Utils/Utils.h"
+
+#include "Bench.h"
+
+static const uint64_t LOOKUP_COUNT = 4000000;
+static const uint32_t LOOKUP_ORDER_SIZE = 65536;
+
+void RunNameRegistryBench()
+{
+	for (const uint32_t nameCount : { 16u, 256u, 4096u })
+	{
+		std::vector<std::string> names;
+		std::vector<NameID> nameIDs;
+		for (uint32_t index = 0; index < nameCount; ++index)
+		{
+			names.push_back(PrintF("Resource/Shader/Basic_%u", index));
+			nameIDs.push_back(NameID(names.back()));
+		}
+
+		std::map<std::string, GLResource*> stringMap;
+		FlatHashMap<NameID, GLResource*> flatHashMap;
+		for (uint32_t index = 0; index < nameCount; ++index)
+		{
+			GLResource* resource = reinterpret_cast<GLResource*>(static_cast<uintptr_t>(index + 1));
+			stringMap.insert({ names[index], resource });
+			flatHashMap.Insert(nameIDs[index], resource);
+		}
+
+		/** ȸ  б ⿡ н ʵ ǻ   ȸմϴ. */
+		std::vector<uint32_t> order(LOOKUP_ORDER_SIZE);
+		uint32_t state = 0x12345678;
+		for (auto& index : order)
+		{
+			state = state * 1664525u + 1013904223u;
+			index = (state >> 8) % nameCount;
+		}
+
+		std::printf(" names: %u\n", nameCount);
+
+		uint64_t checksum = 0;
+		double nanoseconds = MeasureAverageNanoseconds(LOOKUP_COUNT, [&](uint64_t index)
+		{
+			checksum += reinterpret_cast<uintptr_t>(stringMap.find(names[order[index & (LOOKUP_ORDER_SIZE - 1)]])->second);
+		});
+		PrintBenchResult("std::map<std::string> (std::string key)", nanoseconds, checksum);
+
+		checksum = 0;
+		nanoseconds = MeasureAverageNanoseconds(LOOKUP_COUNT, [&](uint64_t index)
+		{
+			const char* name = names[order[index & (LOOKUP_ORDER_SIZE - 1)]].c_str();
+			checksum += reinterpret_cast<uintptr_t>(stringMap.find(name)->second); /** ڿ ͷ ȣ ó ӽ std::string մϴ. */
+		});
+		PrintBenchResult("std::map<std::string> (const char* key)", nanoseconds, checksum);
+
+		checksum = 0;
+		nanoseconds = MeasureAverageNanoseconds(LOOKUP_COUNT, [&](uint64_t index)
+		{
+			checksum += reinterpret_cast<uintptr_t>(*flatHashMap.Find(nameIDs[order[index & (LOOKUP_ORDER_SIZE - 1)]]));
+		});
+		PrintBenchResult("FlatHashMap<NameID> (precomputed NameID)", nanoseconds, checksum);
+
+		checksum = 0;
+		nanoseconds = MeasureAverageNanoseconds(LOOKUP_COUNT, [&](uint64_t index)
+		{
+			const char* name = names[order[index & (LOOKUP_ORDER_SIZE - 1)]].c_str();
+			checksum += reinterpret_cast<uintptr_t>(*flatHashMap.Find(NameID(name))); /** Ÿӿ ؽø մϴ. */
+		});
+		PrintBenchResult("FlatHashMap<NameID> (runtime hash)", nanoseconds, checksum);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,127 @@
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+#include "GL/RenderQueue.h"
+
+#include "Job/JobManager.h"
+
+#include "Bench.h"
+
+/**  Ӵ ׸   ݺ ȽԴϴ. */
+static const uint32_t DRAW_COUNTS[] = { 10000, 50000, 100000 };
+static const uint64_t ROUND_COUNT = 50;
+
+/**    ϴ ̴/Ƽ  Դϴ. */
+static const uint32_t SHADER_COUNT = 8;
+static const uint32_t MATERIAL_COUNT = 64;
+
+/** index° ׸  մϴ. ̴/Ƽ/̰   ϰ ̵ ؽø մϴ. */
+static RenderCommand MakeCommand(uint32_t index)
+{
+	uint32_t hash = index * 0x9E3779B9u;
+	hash ^= hash >> 16;
+
+	uint32_t shader = hash % SHADER_COUNT;
+	uint32_t material = (hash >> 3) % MATERIAL_COUNT;
+	uint32_t depth = (hash >> 8) & 0xFFFFFF;
+
+	RenderCommand command;
+	command.sortKey = RenderQueue::MakeSortKey(0, shader, material, depth);
+	command.programID = shader + 1;
+	command.vertexArrayID = 1;
+	command.textureID = material + 1;
+	command.indexCount = 36;
+	command.firstIndex = 0;
+	return command;
+}
+
+/** ĵ  ̴ α׷ Ǵ ؽó ٲ Ƚ ϴ. */
+static uint32_t CountStateChanges(const RenderQueue& renderQueue)
+{
+	uint32_t stateChangeCount = 0;
+	for (uint32_t index = 0; index < renderQueue.GetCommandCount(); ++index)
+	{
+		const RenderCommand& command = renderQueue.GetSortedCommand(index);
+		if (index == 0)
+		{
+			stateChangeCount += 2;
+			continue;
+		}
+
+		const RenderCommand& prevCommand = renderQueue.GetSortedCommand(index - 1);
+		stateChangeCount += (prevCommand.programID != command.programID) ? 1 : 0;
+		stateChangeCount += (prevCommand.textureID != command.textureID) ? 1 : 0;
+	}
+
+	return stateChangeCount;
+}
+
+void RunRenderQueueBench()
+{
+	JobManager& jobManager = JobManager::GetRef();
+	jobManager.Startup();
+
+	for (const auto& drawCount : DRAW_COUNTS)
+	{
+		std::printf(" draws: %u\n", drawCount);
+
+		RenderQueue renderQueue;
+		uint64_t checksum = 0;
+
+		double nanoseconds = MeasureAverageNanoseconds(ROUND_COUNT, [&](uint64_t round)
+		{
+			renderQueue.Reset();
+			for (uint32_t index = 0; index < drawCount; ++index)
+			{
+				renderQueue.Submit(MakeCommand(index));
+			}
+			renderQueue.Sort();
+			checksum += renderQueue.GetSortedCommand(static_cast<uint32_t>(round % drawCount)).sortKey;
+		});
+		PrintBenchResult("Submit + Sort, single thread (per draw)", nanoseconds / static_cast<double>(drawCount), checksum);
+
+		checksum = 0;
+		nanoseconds = MeasureAverageNanoseconds(ROUND_COUNT, [&](uint64_t round)
+		{
+			renderQueue.Reset();
+			jobManager.ParallelFor(drawCount, 1024, [&](uint32_t begin, uint32_t end)
+			{
+				for (uint32_t index = begin; index < end; ++index)
+				{
+					renderQueue.Submit(MakeCommand(index));
+				}
+			});
+			renderQueue.Sort();
+			checksum += renderQueue.GetSortedCommand(static_cast<uint32_t>(round % drawCount)).sortKey;
+		});
+		PrintBenchResult("Submit + Sort, ParallelFor (per draw)", nanoseconds / static_cast<double>(drawCount), checksum);
+
+		checksum = 0;
+		nanoseconds = MeasureAverageNanoseconds(ROUND_COUNT, [&](uint64_t round)
+		{
+			renderQueue.Sort();
+			checksum += renderQueue.GetSortedCommand(static_cast<uint32_t>(round % drawCount)).sortKey;
+		});
+		PrintBenchResult("radix Sort only (per draw)", nanoseconds / static_cast<double>(drawCount), checksum);
+
+		std::vector<RenderCommand> commands(drawCount);
+		checksum = 0;
+		nanoseconds = MeasureAverageNanoseconds(ROUND_COUNT, [&](uint64_t round)
+		{
+			for (uint32_t index = 0; index < drawCount; ++index)
+			{
+				commands[index] = MakeCommand(index);
+			}
+			std::stable_sort(commands.begin(), commands.end(), [](const RenderCommand& lhs, const RenderCommand& rhs) { return lhs.sortKey < rhs.sortKey; });
+			checksum += commands[round % drawCount].sortKey;
+		});
+		PrintBenchResult("std::stable_sort baseline (per draw)", nanoseconds / static_cast<double>(drawCount), checksum);
+
+		uint32_t sortedStateChangeCount = CountStateChanges(renderQueue);
+		std::printf(" program/texture changes: %u sorted vs. %u in submission order\n", sortedStateChangeCount, 2 * drawCount);
+	}
+
+	jobManager.Shutdown();
+}
\ No newline at end of file
@@ -0,0 +1,187 @@
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#if defined(_WIN32)
+#include <windows.h>
+#include <psapi.h>
+#endif
+
+#include <mimalloc.h>
+#include <stb_image.h>
+
+#include "Bench.h"
+
+/**  ؽó  ũԴϴ. 4096x4096 RGBA8 ̹   ڵ  64MiBԴϴ. */
+static const uint32_t TEXTURE_COUNT = 2;
+static const uint32_t TEXTURE_SIZE = 4096;
+static const uint32_t TEXTURE_CHANNELS = 4;
+
+/** ؽó  εϴ ݺ ȽԴϴ. */
+static const uint64_t LOAD_ROUND_COUNT = 3;
+
+/**
+ *  TGA ̹  մϴ. PNG ڴ Ƿ, ڵ   б⿡    մϴ.
+ *   ڵ    ε ð ϴ   ũ 巯ϴ.
+ */
+static bool WriteTGAFile(const std::string& path, uint32_t seed)
+{
+	FILE* file = std::fopen(path.c_str(), "wb");
+	if (!file)
+	{
+		return false;
+	}
+
+	uint8_t header[18] = {};
+	header[2] = 2; //  Ʈ ÷
+	header[12] = static_cast<uint8_t>(TEXTURE_SIZE & 0xFF);
+	header[13] = static_cast<uint8_t>(TEXTURE_SIZE >> 8);
+	header[14] = static_cast<uint8_t>(TEXTURE_SIZE & 0xFF);
+	header[15] = static_cast<uint8_t>(TEXTURE_SIZE >> 8);
+	header[16] = static_cast<uint8_t>(TEXTURE_CHANNELS * 8);
+	header[17] = 0x28; //  8Ʈ,   
+	std::fwrite(header, 1, sizeof(header), file);
+
+	std::vector<uint8_t> row(TEXTURE_SIZE * TEXTURE_CHANNELS);
+	uint32_t state = seed;
+	for (uint32_t y = 0; y < TEXTURE_SIZE; ++y)
+	{
+		for (auto& value : row)
+		{
+			state = state * 1664525u + 1013904223u;
+			value = static_cast<uint8_t>(state >> 24);
+		}
+		std::fwrite(row.data(), 1, row.size(), file);
+	}
+
+	std::fclose(file);
+	return true;
+}
+
+/**
+ * μ ִ  ޸(peak RSS) ʱȭմϴ.
+ * Linux /proc/self/clear_refs ִ    ǵ  ְ,   ÷ ʱȭ Ƿ    ޽ϴ.
+ */
+static void ResetPeakResidentBytes()
+{
+	mi_collect(true); //    ޸𸮸 ü ȯ.
+
+#if defined(__linux__)
+	if (FILE* file = std::fopen("/proc/self/clear_refs", "w"))
+	{
+		std::fputs("5", file);
+		std::fclose(file);
+	}
+#endif
+}
+
+/** μ ִ  ޸(peak RSS) Ʈ  ϴ.   ٸ 0Դϴ. */
+static uint64_t GetPeakResidentBytes()
+{
+#if defined(_WIN32)
+	PROCESS_MEMORY_COUNTERS counters = {};
+	if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+	{
+		return static_cast<uint64_t>(counters.PeakWorkingSetSize);
+	}
+#elif defined(__linux__)
+	if (FILE* file = std::fopen("/proc/self/status", "r"))
+	{
+		char line[256];
+		unsigned long long peakKilobytes = 0;
+		while (std::fgets(line, sizeof(line), file))
+		{
+			if (std::sscanf(line, "VmHWM: %llu kB", &peakKilobytes) == 1)
+			{
+				break;
+			}
+		}
+		std::fclose(file);
+		return static_cast<uint64_t>(peakKilobytes) * 1024;
+	}
+#endif
+	return 0;
+}
+
+/** ؽó  ڵϰ ε ۸ غϴ  ð ִ  ޸𸮸 մϴ. */
+template <typename TLoadFunction>
+static void MeasureDecodeCopy(const char* name, const std::vector<std::string>& paths, const TLoadFunction& loadFunction)
+{
+	ResetPeakResidentBytes();
+	uint64_t beginPeakBytes = GetPeakResidentBytes();
+
+	uint64_t checksum = 0;
+	double nanoseconds = MeasureAverageNanoseconds(LOAD_ROUND_COUNT * paths.size(), [&](uint64_t index)
+	{
+		checksum += loadFunction(paths[index % paths.size()]);
+	});
+
+	uint64_t peakBytes = GetPeakResidentBytes();
+	PrintBenchResult(name, nanoseconds, checksum);
+	std::printf("  %-48s %12.2f MiB peak RSS (+%.2f MiB)\n", "", static_cast<double>(peakBytes) / (1024.0 * 1024.0), static_cast<double>(peakBytes - beginPeakBytes) / (1024.0 * 1024.0));
+}
+
+void RunTextureDecodeCopyBench()
+{
+	std::filesystem::path directory = std::filesystem::temp_directory_path() / "DodgeBallTextureDecodeCopyBench";
+	std::filesystem::create_directories(directory);
+
+	std::vector<std::string> paths;
+	for (uint32_t index = 0; index < TEXTURE_COUNT; ++index)
+	{
+		std::string path = (directory / ("Texture" + std::to_string(index) + ".tga")).string();
+		if (!WriteTGAFile(path, 1234u + index))
+		{
+			std::printf("  failed to write %s\n", path.c_str());
+			return;
+		}
+		paths.push_back(path);
+	}
+
+	std::printf("  %u textures, %ux%u, %u channels\n", TEXTURE_COUNT, TEXTURE_SIZE, TEXTURE_SIZE, TEXTURE_CHANNELS);
+
+	/**    о  ĳÿ øϴ. ù °  ũ б   ʵ մϴ. */
+	for (const auto& path : paths)
+	{
+		int32_t width = 0, height = 0, channels = 0;
+		stbi_image_free(stbi_load(path.c_str(), &width, &height, &channels, 0));
+	}
+
+	/** ִ  ޸𸮸 ʱȭ   ÷   ֵ, ޸𸮸  ϴ θ  մϴ. */
+	MeasureDecodeCopy("decode, use decoder output", paths, [](const std::string& path) -> uint64_t
+	{
+		int32_t width = 0, height = 0, channels = 0;
+		uint8_t* imagePtr = stbi_load(path.c_str(), &width, &height, &channels, 0);
+		if (!imagePtr)
+		{
+			return 0;
+		}
+
+		uint64_t checksum = imagePtr[0] + imagePtr[static_cast<std::size_t>(width * height * channels) - 1];
+		stbi_image_free(imagePtr);
+		return checksum;
+	});
+
+	MeasureDecodeCopy("decode, copy to staging vector", paths, [](const std::string& path) -> uint64_t
+	{
+		int32_t width = 0, height = 0, channels = 0;
+		uint8_t* imagePtr = stbi_load(path.c_str(), &width, &height, &channels, 0);
+		if (!imagePtr)
+		{
+			return 0;
+		}
+
+		std::size_t bufferSize = static_cast<std::size_t>(width * height * channels);
+		std::vector<uint8_t> buffer(bufferSize);
+		std::memcpy(buffer.data(), imagePtr, bufferSize);
+
+		stbi_image_free(imagePtr);
+		return buffer[0] + buffer[bufferSize - 1];
+	});
+
+	std::error_code errorCode;
+	std::filesystem::remove_all(directory, errorCode);
+}
\ No newline at end of file
@@ -1,8 +1,22 @@
 #pragma once
 
 #include "GL/GLError.h"
+#include "Utils/Macro.h"
 #include "Utils/Utils.h"
 
+#if defined(GL_CALLBACK_VALIDATION)
+/**
+ *  (KHR_debug) ݹ OpenGL  ϴ Դϴ.
+ *  ̹ ݹ ϹǷ, API ȣ ˻ ũδ API ȣ⸸ ϰ glGetError ȣ ʽϴ.
+ */
+#ifndef GL_API_CHECK
+#define GL_API_CHECK(EXP) (void)(EXP)
+#endif
+#ifndef GL_API_ASSERT
+#define GL_API_ASSERT(EXP, ...) (void)(EXP)
+#endif
+#endif
+
 #if defined(DEBUG_MODE) || defined(RELWITHDEBINFO_MODE)
 /**
  *  ũδ OpenGL API ȣ  򰡽 ˻ϰ, 򰡽   break ̴ϴ.
@@ -18,13 +32,14 @@
 		GLenum _errorCode = glGetError();\
 		DebugPrintF("\nAssertion check point failed!\n> File: %s\n> Line: %d\n> Function: %s\n> Expression: %s\n", __FILE__, __LINE__, __FUNCTION__, #EXP);\
 		DebugPrintF("> Code: %d\n> Error: %s\n\n", static_cast<int32_t>(_errorCode), GLError::GetMessage(_errorCode));\
-		__debugbreak();\
+		DEBUG_BREAK();\
 	}\
 }
 #endif
 /**
  *  ũδ OpenGL API API ȣ  ˻ϰ, 򰡽   break ̴ϴ.
  * ַ, ȯ   API  մϴ.
+ * glGetError ̹ ȭ ϹǷ,   (EGLValidationMode::STRICT) ƴ϶ ȣ ʽϴ.
  * ex)
  * GL_API_CHECK(glBindBuffer(...));
  */
@@ -32,12 +47,15 @@
 #define GL_API_CHECK(EXP)\
 {\
 	EXP;\
-	GLenum _errorCode = glGetError();\
-	if (_errorCode != GL_NO_ERROR)\
+	if (GLError::IsStrictValidation())\
 	{\
-		DebugPrintF("\nAssertion check point failed!\n> File: %s\n> Line: %d\n> Function: %s\n> Expression: %s\n", __FILE__, __LINE__, __FUNCTION__, #EXP);\
-		DebugPrintF("> Code: %d\n> Error: %s\n\n", static_cast<int32_t>(_errorCode), GLError::GetMessage(_errorCode));\
-		__debugbreak();\
+		GLenum _errorCode = glGetError();\
+		if (_errorCode != GL_NO_ERROR)\
+		{\
+			DebugPrintF("\nAssertion check point failed!\n> File: %s\n> Line: %d\n> Function: %s\n> Expression: %s\n", __FILE__, __LINE__, __FUNCTION__, #EXP);\
+			DebugPrintF("> Code: %d\n> Error: %s\n\n", static_cast<int32_t>(_errorCode), GLError::GetMessage(_errorCode));\
+			DEBUG_BREAK();\
+		}\
 	}\
 }
 #endif
@@ -57,7 +75,7 @@
 		DebugPrintF("> Code: %d\n> Error: %s\n> Description:", static_cast<int32_t>(_errorCode), GLError::GetMessage(_errorCode)); \
 		DebugPrintF(__VA_ARGS__);\
 		DebugPrintF("\n\n");\
-		__debugbreak(); \
+		DEBUG_BREAK(); \
 	}\
 }
 #endif
@@ -71,14 +89,17 @@
 #define GL_API_ASSERT(EXP, ...)\
 {\
 	EXP;\
-	GLenum _errorCode = glGetError();\
-	if (_errorCode != GL_NO_ERROR)\
+	if (GLError::IsStrictValidation())\
 	{\
-		DebugPrintF("\nAssertion check point failed!\n> File: %s\n> Line: %d\n> Function: %s\n> Expression: %s\n", __FILE__, __LINE__, __FUNCTION__, #EXP); \
-		DebugPrintF("> Code: %d\n> Error: %s\n> Description:", static_cast<int32_t>(_errorCode), GLError::GetMessage(_errorCode)); \
-		DebugPrintF(__VA_ARGS__);\
-		DebugPrintF("\n\n");\
-		__debugbreak();\
+		GLenum _errorCode = glGetError();\
+		if (_errorCode != GL_NO_ERROR)\
+		{\
+			DebugPrintF("\nAssertion check point failed!\n> File: %s\n> Line: %d\n> Function: %s\n> Expression: %s\n", __FILE__, __LINE__, __FUNCTION__, #EXP); \
+			DebugPrintF("> Code: %d\n> Error: %s\n> Description:", static_cast<int32_t>(_errorCode), GLError::GetMessage(_errorCode)); \
+			DebugPrintF(__VA_ARGS__);\
+			DebugPrintF("\n\n");\
+			DEBUG_BREAK();\
+		}\
 	}\
 }
 #endif
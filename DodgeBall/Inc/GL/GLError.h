@@ -1,8 +1,24 @@
 #pragma once
 
+#include <cstdint>
 #include <map>
 #include <string>
 
+/**
+ * OpenGL API ȣ  Դϴ.
+ * STRICT API ȣ  glGetError  ˻ϹǷ  ġ Ȯ, ̹ ȭ ߻մϴ.
+ * DEBUG_OUTPUT ̹  (KHR_debug) ݹ  ϹǷ API ȣ⸶ ߻ϴ  ϴ.
+ * DEBUG_OUTPUT_SYNCHRONOUS  ߻Ų API ȣ  ݹ ȣǹǷ, ݹ ȣ   ġ ã  ֽϴ.
+ * https://registry.khronos.org/OpenGL/extensions/KHR/KHR_debug.txt
+ */
+enum class EGLValidationMode
+{
+	NONE                     = 0x00,
+	STRICT                   = 0x01,
+	DEBUG_OUTPUT             = 0x02,
+	DEBUG_OUTPUT_SYNCHRONOUS = 0x03,
+};
+
 /**
  * OpenGL  óϴ ŬԴϴ.
  * ̶,  Ŭ    ޼ (static) ŸԴϴ.
@@ -13,11 +29,20 @@ public:
 	/** OpenGL  ڵ忡 ϴ  ޽ C ŸϷ ϴ. */
 	static const char* GetMessage(uint32_t code);
 
+	/** API ȣ⸶ glGetError  ˻ϴ Ȯմϴ. */
+	static bool IsStrictValidation() { return bIsStrictValidation_; }
+
 private:
 	/** GL Ŵ GL  ο   ֵ մϴ. */
 	friend class GLManager;
 
+	/**   ݹ ϰ   Ȱȭմϴ. ̶, OpenGL 4.3 ̻ ؽƮ ʿմϴ. */
+	static void EnableDebugOutput(bool bIsSynchronous);
+
 private:
 	/** OpenGL  ڵ忡 ϴ  ޽Դϴ. */
 	static std::map<uint32_t, std::string> errorMessages_;
+
+	/** API ȣ⸶ glGetError  ˻ϴ Դϴ. */
+	static bool bIsStrictValidation_;
 };
\ No newline at end of file
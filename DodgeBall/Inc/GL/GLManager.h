@@ -1,16 +1,45 @@
 #pragma once
 
+#include <array>
 #include <cstdint>
-#include <map>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
-#include <glfw/glfw3.h>
+#include <GLFW/glfw3.h>
 
+#include "GL/GLError.h"
 #include "GL/GLResource.h"
+#include "GL/GLResourceTable.h"
+#include "GL/ProgramBinaryCache.h"
+#include "GL/VertexLayout.h"
 
+#include "GLFW/GLFWManager.h"
+
+#include "Utils/FlatHashMap.h"
 #include "Utils/Macro.h"
+#include "Utils/NameID.h"
+#include "Utils/Profiler.h"
+
+/**     ĳø ģ OpenGL   ȣ Դϴ. */
+struct GLStateStatistics
+{
+	/** OpenGL API  ȣ ȽԴϴ. */
+	uint64_t issuedCallCount = 0;
+
+	/**  ¿  ̾ ȣ  ȽԴϴ. */
+	uint64_t skippedCallCount = 0;
+
+	/**  ȣ     ȽԴϴ. */
+	uint64_t bufferBindCount = 0;
+	uint64_t vertexArrayBindCount = 0;
+	uint64_t programBindCount = 0;
+	uint64_t textureBindCount = 0;
+
+	/** ؽ 迭 Ӽ   OpenGL API ȣ ȽԴϴ. ؽ 迭 ̸ ߴٸ Ӹ 0̾ մϴ. */
+	uint64_t vertexFormatCallCount = 0;
+};
 
 /**
  * OpenGL ؽƮ     ó ϴ ŴԴϴ.
@@ -18,6 +47,23 @@
  */
 class GLManager
 {
+public:
+	/**
+	 * CPU GPU ռ   ִ ִ  Դϴ.
+	 *   ۴  ŭ   ϰ,       潺 ȣ˴ϴ.
+	 */
+	static const uint32_t MAX_FRAMES_IN_FLIGHT = 3;
+
+	/**  ĳð ϴ ؽó      Դϴ. ̺ ū / ĳø ġ ʰ ׻ ȣմϴ. */
+	static const uint32_t MAX_CACHED_TEXTURE_UNITS = 32;
+	static const uint32_t MAX_CACHED_UNIFORM_BUFFER_SLOTS = 16;
+
+	/**
+	 *    ⺻ OpenGL API ȣ  Դϴ.
+	 * GL_CALLBACK_VALIDATION  DEBUG_OUTPUT, DEBUG_MODE/RELWITHDEBINFO_MODE  STRICT,    NONEԴϴ.
+	 */
+	static const EGLValidationMode DEFAULT_VALIDATION_MODE;
+
 public:
 	DISALLOW_COPY_AND_ASSIGN(GLManager);
 
@@ -27,18 +73,46 @@ public:
 	/** GL Ŵ ̱ ü ͸ ϴ. */
 	static GLManager* GetPtr();
 
-	/** GL Ŵ ʱȭմϴ. ̶, GL Ŵ ʱȭ ϱ  ݵ GLFW Ŵ ʱȭ ؾ մϴ. */
-	void Startup();
+	/**
+	 * GL Ŵ ʱȭմϴ. ̶, GL Ŵ ʱȭ ϱ  ݵ GLFW Ŵ ʱȭ ؾ մϴ.
+	 *   STRICT Ϸ GL_API_CHECK glGetError ȣϴ (GL_CALLBACK_VALIDATION ƴ DEBUG_MODE/RELWITHDEBINFO_MODE) մϴ.
+	 * α׷ ̳ʸ ĳ ΰ   ʴٸ, ̴ α׷ ̳ʸ  ͸ ϰ  ࿡ մϴ.
+	 */
+	void Startup(const EGLValidationMode& validationMode = DEFAULT_VALIDATION_MODE, const std::string& programBinaryCachePath = "");
+
+	/**
+	 *  Ŀ OpenGL  ؽƮ ʿ Ȯմϴ.  忡 STRICT DEBUG_OUTPUT üϴ 쵵 մϴ.
+	 * GLFW Ŵ ʱȭ    ؾ մϴ.  ؽƮ ƴ϶ Startup    NONE üմϴ.
+	 */
+	static bool IsDebugContextRequired(const EGLValidationMode& validationMode);
 
 	/** GL Ŵ ʱȭ մϴ. */
 	void Shutdown();
 
-	/**   մϴ. */
+	/**   մϴ. ̶,  ӿ  Ʒ Ҵ ޸𸮴  ȿȭ˴ϴ. */
 	void BeginFrame(float red, float green, float blue, float alpha, float depth = 1.0f, uint8_t stencil = 0);
 
 	/**   մϴ. */
 	void EndFrame();
 
+	/** OpenGL API ȣ   ϴ. */
+	EGLValidationMode GetValidationMode() const { return validationMode_; }
+
+	/**
+	 * ̹ ̴  (GL_KHR_parallel_shader_compile Ǵ GL_ARB_parallel_shader_compile) ϴ Ȯմϴ.
+	 * Ѵٸ ʱȭ  ̹   ִ ִ    ûϰ, ̴  Ϸ θ   ȸ  ֽϴ.
+	 */
+	bool IsParallelShaderCompileSupported() const { return bIsParallelShaderCompileSupported_; }
+
+	/** S3TC ؽó (GL_EXT_texture_compression_s3tc)  θ Ȯմϴ. BC1/BC3 ŷ ؽó  Ȯ ʿϰ, BC4/BC5(RGTC) ھ Դϴ. */
+	bool IsS3TCSupported() const { return bIsS3TCSupported_; }
+
+	/** α׷ ̳ʸ ĳø ϴ. ĳ θ  ʾҰų ̹ α׷ ̳ʸ  ʴ´ٸ nullptrԴϴ. */
+	ProgramBinaryCache* GetProgramBinaryCache() const { return programBinaryCache_.get(); }
+
+	/**   ε ϴ.  ε EndFrame ȣ  1 մϴ. */
+	uint64_t GetFrameIndex() const { return frameIndex_; }
+
 	/** Viewport մϴ. */
 	void SetViewport(int32_t x, int32_t y, int32_t width, int32_t height);
 
@@ -49,58 +123,135 @@ public:
 	void SetAlphaBlendMode(bool bIsEnable);
 	void SetCullFaceMode(bool bIsEnable);
 
+	/**
+	 *  ĳø  OpenGL Ʈ εմϴ.  ε Ʈ ٸ OpenGL API ȣ ʽϴ.
+	 * ̶,  ĳð ȿϷ ҽ glBindBuffer/glUseProgram/glBindTexture   ȣ ʰ  ޼带 ؾ մϴ.
+	 */
+	void BindBuffer(uint32_t target, uint32_t bufferID);
+	void BindVertexArray(uint32_t vertexArrayID);
+	void UseProgram(uint32_t programID);
+	void BindTexture(uint32_t unit, uint32_t target, uint32_t textureID);
+
+	/**
+	 *  ĳø  ۸ ε ε  εմϴ. byteSize 0̸  ü εմϴ(glBindBufferBase).
+	 * ̶, ε ε target Ϲ ε  Բ մϴ.
+	 */
+	void BindBufferRange(uint32_t target, uint32_t slot, uint32_t bufferID, uint32_t offset = 0, uint32_t byteSize = 0);
+
+	/** ı OpenGL Ʈ  ĳÿ մϴ. Ʈ ıϸ OpenGL ش ε 0 ǵǷ, ҽ ı  ȣؾ մϴ. */
+	void OnDeleteBuffer(uint32_t bufferID);
+	void OnDeleteVertexArray(uint32_t vertexArrayID);
+	void OnDeleteProgram(uint32_t programID);
+	void OnDeleteTexture(uint32_t textureID);
+
+	/** DSA ؽ 迭 ε ۸   ȣմϴ.  ؽ 迭 εǾ ִٸ ε  ε ĳø մϴ. */
+	void OnSetElementBuffer(uint32_t vertexArrayID, uint32_t bufferID);
+
+	/** ؽ 迭 Ӽ  ϱ  ȣ OpenGL API Ƚ   迡 մϴ. */
+	void AddVertexFormatCallCount(uint32_t callCount) { frameStateStatistics_.vertexFormatCallCount += callCount; }
+
+	/**
+	 * ؽ ̾ƿ ϰ ̾ƿ ID ȯմϴ.  ̾ƿ ؽ÷ ãƼ ׻  ID ȯմϴ.
+	 * ̾ƿ ID 1 ϸ, ؽ 迭 ID ؼ Ӽ  ٽ  մϴ.
+	 */
+	uint32_t RegisterVertexLayout(const VertexLayout& layout);
+
+	/** ̾ƿ ID ϴ ؽ ̾ƿ ϴ. */
+	const VertexLayout& GetVertexLayout(uint32_t layoutID) const;
+
+	/** ϵ ؽ ̾ƿ  ϴ. */
+	uint32_t GetVertexLayoutCount() const { return static_cast<uint32_t>(vertexLayouts_.size()); }
+
+	/**  ĳø ȿȭմϴ.  ĳø ġ ʰ OpenGL ¸  (: ImGui ) ȣմϴ. */
+	void InvalidateStateCache();
+
+	/**     ȣ 踦 ϴ. */
+	const GLStateStatistics& GetStateStatistics() const { return lastFrameStateStatistics_; }
+
 	/** OpenGL ҽ մϴ. */
 	template <typename TResource, typename... Args>
 	TResource* Create(Args&&... args)
 	{
-		int32_t resourceID = -1;
-		for (uint32_t index = 0; index < resources_.size(); ++index)
-		{
-			if (!resources_[index].first && !resources_[index].second)
-			{
-				resourceID = static_cast<int32_t>(index);
-				break;
-			}
-		}
+		return Get(CreateHandle<TResource>(std::forward<Args>(args)...));
+	}
 
-		if (resourceID == -1)
-		{
-			resourceID = resources_.size();
-			resources_.push_back({ nullptr, true });
-			resources_[resourceID].first = std::make_unique<TResource>(args...);
-		}
-		else
+	/** OpenGL ҽ ϰ ҽ ڵ ϴ. */
+	template <typename TResource, typename... Args>
+	GLHandle<TResource> CreateHandle(Args&&... args)
+	{
+		PROFILE_SCOPE("GLManager::CreateHandle");
+
+		uint32_t resourceTableID = GetResourceTableID<TResource>();
+		GLResourceTable<TResource>& resourceTable = GetResourceTable<TResource>();
+
+		GLHandle<TResource> handle = resourceTable.Create(std::forward<Args>(args)...);
+
+		TResource* resource = resourceTable.Get(handle);
+		resource->resourceTableID_ = resourceTableID;
+		resource->resourceHandle_ = handle.value;
+
+		return handle;
+	}
+
+	/** ڵ鿡 ϴ OpenGL ҽ ϴ. ̹ ı ҽ ڵ̶ nullptr ȯմϴ. */
+	template <typename TResource>
+	TResource* Get(const GLHandle<TResource>& handle)
+	{
+		return GetResourceTable<TResource>().Get(handle);
+	}
+
+	/** GL Ŵ  OpenGL ҽ ڵ ϴ. */
+	template <typename TResource>
+	GLHandle<TResource> GetHandle(const TResource* resource)
+	{
+		if (!resource || resource->resourceTableID_ != GetResourceTableID<TResource>())
 		{
-			resources_[resourceID].second = true;
-			resources_[resourceID].first = std::make_unique<TResource>(args...);
+			return GLHandle<TResource>();
 		}
 
-		return reinterpret_cast<TResource*>(resources_[resourceID].first.get());
+		return GLHandle<TResource>(resource->resourceHandle_);
 	}
 
 	/**  OpenGL ҽ ıմϴ. */
 	void Destroy(const GLResource* resource);
 
+	/** ڵ鿡 ϴ OpenGL ҽ ıմϴ. ̹ ı ҽ ڵ̶ ƹ ۵  ʽϴ. */
+	template <typename TResource>
+	void Destroy(const GLHandle<TResource>& handle)
+	{
+		GetResourceTable<TResource>().Destroy(handle.value);
+	}
+
+	/** ҽ ŸԺ Ʈ Ǯ 踦 ϴ. ϸ 뵵 մϴ. */
+	template <typename TResource>
+	ObjectPoolStatistics GetResourceStatistics()
+	{
+		return GetResourceTable<TResource>().GetStatistics();
+	}
+
 	/** ҽ GL Ŵ մϴ. */
 	void Register(const std::string& name, GLResource* resource);
 
 	/** ҽ ̸  Ǿ Ȯմϴ. */
-	bool IsRegistration(const std::string& name);
+	bool IsRegistration(const NameID& name) const;
 
 	/** GL Ŵ  մϴ. */
-	void Unregister(const std::string& name);
+	void Unregister(const NameID& name);
 
-	/** ̸ ϴ ҽ ϴ. */
+	/**
+	 * ̸ ϴ ҽ ϴ.
+	 * ̶, ̸ ؽ θ ϹǷ ڿ ͷ̳ constexpr NameID ϸ ڿ 񱳰 ߻ ʽϴ.
+	 */
 	template <typename TResource>
-	TResource* GetByName(const std::string& name)
+	TResource* GetByName(const NameID& name)
 	{
-		auto it = namedResources_.find(name);
-		if (it == namedResources_.end())
+		GLResource** resource = namedResources_.Find(name);
+		if (!resource)
 		{
 			return nullptr;
 		}
 
-		return reinterpret_cast<TResource*>(it->second);
+		return reinterpret_cast<TResource*>(*resource);
 	}
 
 private:
@@ -111,6 +262,38 @@ private:
 	GLManager() = default;
 	virtual ~GLManager() {}
 
+	/**  忡   ִ   ϴ. STRICT     DEBUG_OUTPUT ȯմϴ. */
+	static EGLValidationMode GetAvailableValidationMode(const EGLValidationMode& validationMode);
+
+	/**  ĳø  OpenGL (glEnable/glDisable) մϴ. */
+	void SetCapability(uint32_t capabilityIndex, uint32_t capability, bool bIsEnable);
+
+	/** ҽ ŸԿ ϴ ҽ ̺ ID ϴ. ID Ÿ ó    ߱޵˴ϴ. */
+	template <typename TResource>
+	static uint32_t GetResourceTableID()
+	{
+		static const uint32_t resourceTableID = resourceTableCount_++;
+		return resourceTableID;
+	}
+
+	/** ҽ ŸԿ ϴ ҽ ̺ ϴ. ̺ ٸ մϴ. */
+	template <typename TResource>
+	GLResourceTable<TResource>& GetResourceTable()
+	{
+		uint32_t resourceTableID = GetResourceTableID<TResource>();
+		if (resourceTableID >= resourceTables_.size())
+		{
+			resourceTables_.resize(resourceTableID + 1);
+		}
+
+		if (!resourceTables_[resourceTableID])
+		{
+			resourceTables_[resourceTableID] = std::make_unique<GLResourceTable<TResource>>();
+		}
+
+		return *static_cast<GLResourceTable<TResource>*>(resourceTables_[resourceTableID].get());
+	}
+
 private:
 	/** GL Ŵ ̱ üԴϴ. */
 	static GLManager singleton_;
@@ -118,13 +301,81 @@ private:
 	/**   Ǵ Դϴ. */
 	GLFWwindow* renderTargetWindow_ = nullptr;
 
+	/** GLFW Ŵ  Դϴ. SIMULATION 忡 OpenGL ؽƮ  ʽϴ. */
+	ERunMode runMode_ = ERunMode::WINDOWED;
+
+	/** OpenGL API ȣ  Դϴ. */
+	EGLValidationMode validationMode_ = EGLValidationMode::NONE;
+
 	/**   Ǵ  / ũԴϴ. */
 	int32_t windowWidth_ = 0;
 	int32_t windowHeight_ = 0;
 
-	/** OpenGL ҽ ۿ ش   뿩Դϴ. */
-	std::vector<std::pair<std::unique_ptr<GLResource>, bool>> resources_;
+	/** ̴    Դϴ. */
+	bool bIsParallelShaderCompileSupported_ = false;
+
+	/** S3TC ؽó   Դϴ. */
+	bool bIsS3TCSupported_ = false;
+
+	/** ̴ α׷ ̳ʸ ϴ ĳԴϴ. */
+	std::unique_ptr<ProgramBinaryCache> programBinaryCache_;
+
+	/**   εԴϴ. */
+	uint64_t frameIndex_ = 0;
+
+	/**     潺(GLsync)Դϴ.  ε MAX_FRAMES_IN_FLIGHT   մϴ. */
+	std::array<void*, MAX_FRAMES_IN_FLIGHT> frameFences_ = { nullptr, };
+
+	/**  ĳÿ    ¸ Ÿ Դϴ.   ϸ ׻ ٸǷ  ȣ ݵ OpenGL API ȣմϴ. */
+	static const uint32_t UNKNOWN_STATE = 0xFFFFFFFF;
+
+	/**  ĳð ϴ  ε  OpenGL  Դϴ. */
+	static const uint32_t MAX_CACHED_BUFFER_TARGETS = 8;
+	static const uint32_t MAX_CACHED_CAPABILITIES = 4;
+
+	/** ؽó ֿ ε ؽóԴϴ. */
+	struct TextureBinding
+	{
+		uint32_t target;
+		uint32_t textureID;
+	};
+
+	/** ε ε  ε  Դϴ. */
+	struct BufferRangeBinding
+	{
+		uint32_t bufferID;
+		uint32_t offset;
+		uint32_t byteSize;
+	};
+
+	/**  ĳԴϴ.  OpenGL ؽƮ Ǿٰ ˰ ִ ¸ մϴ. */
+	std::array<uint32_t, MAX_CACHED_BUFFER_TARGETS> boundBuffers_;
+	std::array<BufferRangeBinding, MAX_CACHED_UNIFORM_BUFFER_SLOTS> boundUniformBufferRanges_;
+	std::array<TextureBinding, MAX_CACHED_TEXTURE_UNITS> boundTextures_;
+	std::array<uint32_t, MAX_CACHED_CAPABILITIES> capabilities_;
+	std::array<int32_t, 4> viewport_;
+	uint32_t boundVertexArray_ = UNKNOWN_STATE;
+	uint32_t boundProgram_ = UNKNOWN_STATE;
+	uint32_t activeTextureUnit_ = UNKNOWN_STATE;
+	bool bIsAlphaBlendFuncSet_ = false;
+
+	/**  Ӱ     ȣ Դϴ. */
+	GLStateStatistics frameStateStatistics_;
+	GLStateStatistics lastFrameStateStatistics_;
+
+	/** ݱ ߱ ҽ ̺ ID Դϴ. */
+	static uint32_t resourceTableCount_;
+
+	/** ҽ ̺ ID ϴ ҽ ŸԺ ̺Դϴ. */
+	std::vector<std::unique_ptr<IGLResourceTable>> resourceTables_;
 
 	/** ̸  ҽԴϴ. */
-	std::map<std::string, GLResource*> namedResources_;
+	FlatHashMap<NameID, GLResource*> namedResources_;
+
+	/** ϵ ҽ  ̸Դϴ. ؽ 浹 ˻  ޽ ¿ մϴ. */
+	FlatHashMap<NameID, std::string> resourceNames_;
+
+	/** ߺ  ؽ ̾ƿ ̾ƿ ϴ IDԴϴ. ID - 1 ̾ƿ  εԴϴ. */
+	std::vector<VertexLayout> vertexLayouts_;
+	FlatHashMap<VertexLayout, uint32_t, VertexLayoutHasher> vertexLayoutIDs_;
 };
\ No newline at end of file
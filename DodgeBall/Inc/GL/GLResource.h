@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstdint>
+
 #include "Utils/Macro.h"
 
 /**
@@ -9,8 +11,8 @@
 class GLResource
 {
 public:
-	GLResource();
-	virtual ~GLResource();
+	GLResource() = default;
+	virtual ~GLResource() {}
 
 	DISALLOW_COPY_AND_ASSIGN(GLResource);
 
@@ -20,4 +22,14 @@ public:
 
 protected:
 	bool bIsInitialized_ = false;
+
+private:
+	/** GL Ŵ ҽ ڵ    ֵ մϴ. */
+	friend class GLManager;
+
+	/** ҽ  GL Ŵ ҽ ̺ IDԴϴ. GL Ŵ   ҽ 0xFFFFFFFFԴϴ. */
+	uint32_t resourceTableID_ = 0xFFFFFFFF;
+
+	/** GL Ŵ ҽ ̺  ڵ Դϴ. */
+	uint32_t resourceHandle_ = 0;
 };
\ No newline at end of file
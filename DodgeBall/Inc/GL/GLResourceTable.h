@@ -0,0 +1,219 @@
+#pragma once
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "GL/GLResource.h"
+
+#include "Utils/Assertion.h"
+#include "Utils/Macro.h"
+#include "Utils/ObjectPool.h"
+
+/**
+ * GL Ŵ  OpenGL ҽ Ű 32Ʈ ڵԴϴ.
+ *  20Ʈ  ε,  12Ʈ  (generation) Դϴ.
+ *  ıǸ   ϹǷ, ı ҽ Ű ڵ ȸ  ȿ ˴ϴ.
+ */
+template <typename TResource>
+struct GLHandle
+{
+	GLHandle() = default;
+	explicit GLHandle(uint32_t handleValue) : value(handleValue) {}
+
+	/**   0   Ƿ, 0 ׻ ȿ ڵԴϴ. */
+	bool IsNull() const { return value == 0; }
+
+	bool operator==(const GLHandle& handle) const { return value == handle.value; }
+	bool operator!=(const GLHandle& handle) const { return value != handle.value; }
+
+	uint32_t value = 0;
+};
+
+/** ŸԿ  GL Ŵ ҽ ̺ ϱ  ̽Դϴ. */
+class IGLResourceTable
+{
+public:
+	/** ڵ  ε Ʈ   Ʈ Դϴ. */
+	static const uint32_t INDEX_BITS = 20;
+	static const uint32_t GENERATION_BITS = 12;
+
+	/** ڵ鿡   ִ ִ   ִ  Դϴ. */
+	static const uint32_t MAX_SLOT_COUNT = (1u << INDEX_BITS);
+	static const uint32_t MAX_GENERATION = (1u << GENERATION_BITS) - 1;
+
+	/**  Ʈ  Ÿ εԴϴ. */
+	static const uint32_t INVALID_INDEX = 0xFFFFFFFF;
+
+public:
+	IGLResourceTable() = default;
+	virtual ~IGLResourceTable() {}
+
+	DISALLOW_COPY_AND_ASSIGN(IGLResourceTable);
+
+	/** ڵ鿡 ϴ ҽ ϴ. ڵ ȿϴٸ nullptr ȯմϴ. */
+	virtual GLResource* GetResource(uint32_t handle) = 0;
+
+	/** ڵ鿡 ϴ ҽ ıմϴ. ڵ ȿϴٸ false ȯմϴ. */
+	virtual bool Destroy(uint32_t handle) = 0;
+
+	/** ̺   ҽ ıմϴ. */
+	virtual void DestroyAll() = 0;
+
+	/** ҽ ϴ Ʈ Ǯ 踦 ϴ. */
+	virtual ObjectPoolStatistics GetStatistics() const = 0;
+
+	/**  ε   ڵ  ϴ. */
+	static uint32_t MakeHandle(uint32_t index, uint32_t generation) { return (generation << INDEX_BITS) | index; }
+
+	/** ڵ   ε ϴ. */
+	static uint32_t GetIndex(uint32_t handle) { return handle & (MAX_SLOT_COUNT - 1); }
+
+	/** ڵ    ϴ. */
+	static uint32_t GetGeneration(uint32_t handle) { return handle >> INDEX_BITS; }
+};
+
+/**
+ *  Ÿ OpenGL ҽ Ʈ Ǯ ϰ,     ڵ ߱ϴ  Դϴ.
+ * ҽ ü Ʈ Ǯ ûũ ǹǷ,  ҽ ʹ ıǱ  ȿմϴ.
+ * ı  Կ    ε ϴ  Ʈ ϹǷ, /ı/ȸ  O(1)Դϴ.
+ */
+template <typename TResource>
+class GLResourceTable : public IGLResourceTable
+{
+public:
+	GLResourceTable() = default;
+	virtual ~GLResourceTable()
+	{
+		DestroyAll();
+	}
+
+	DISALLOW_COPY_AND_ASSIGN(GLResourceTable);
+
+	/** ҽ ϰ ڵ ȯմϴ. */
+	template <typename... Args>
+	GLHandle<TResource> Create(Args&&... args)
+	{
+		uint32_t index = freeListHead_;
+		if (index == INVALID_INDEX)
+		{
+			index = AllocateSlot();
+		}
+		else
+		{
+			freeListHead_ = slots_[index].nextFreeIndex;
+		}
+
+		Slot& slot = slots_[index];
+		slot.resource = resourcePool_.Create(std::forward<Args>(args)...);
+		slot.nextFreeIndex = INVALID_INDEX;
+
+		return GLHandle<TResource>(MakeHandle(index, slot.generation));
+	}
+
+	/** ڵ鿡 ϴ ҽ ϴ. ڵ ȿϴٸ nullptr ȯմϴ. */
+	TResource* Get(const GLHandle<TResource>& handle)
+	{
+		if (!IsValid(handle.value))
+		{
+			return nullptr;
+		}
+
+		return slots_[GetIndex(handle.value)].resource;
+	}
+
+	virtual GLResource* GetResource(uint32_t handle) override
+	{
+		return Get(GLHandle<TResource>(handle));
+	}
+
+	virtual bool Destroy(uint32_t handle) override
+	{
+		if (!IsValid(handle))
+		{
+			return false; // ̹ ı ҽ Ű ڵ̰ų,  ̺  ڵ ƴ.
+		}
+
+		uint32_t index = GetIndex(handle);
+		DestroySlot(index);
+
+		return true;
+	}
+
+	virtual void DestroyAll() override
+	{
+		for (uint32_t index = 0; index < slots_.size(); ++index)
+		{
+			if (slots_[index].resource)
+			{
+				DestroySlot(index);
+			}
+		}
+	}
+
+	virtual ObjectPoolStatistics GetStatistics() const override
+	{
+		return resourcePool_.GetStatistics();
+	}
+
+	/**  ִ ҽ  ϴ. */
+	uint32_t GetLiveCount() const { return resourcePool_.GetLiveCount(); }
+
+private:
+	/**  Դϴ. ҽ nullptr  Դϴ. */
+	struct Slot
+	{
+		TResource* resource = nullptr;
+		uint32_t generation = 1; /** 0 ȿ ڵ   ʽϴ. */
+		uint32_t nextFreeIndex = INVALID_INDEX;
+	};
+
+	/** ڵ  ִ ҽ Ű Ȯմϴ. */
+	bool IsValid(uint32_t handle) const
+	{
+		uint32_t index = GetIndex(handle);
+		if (index >= slots_.size())
+		{
+			return false;
+		}
+
+		const Slot& slot = slots_[index];
+		return slot.resource && slot.generation == GetGeneration(handle);
+	}
+
+	/** ο  Ҵմϴ. */
+	uint32_t AllocateSlot()
+	{
+		uint32_t index = static_cast<uint32_t>(slots_.size());
+		ASSERT(index < MAX_SLOT_COUNT, "Exceeded the maximum number of resource slots. (%u)", MAX_SLOT_COUNT);
+
+		slots_.push_back(Slot());
+		return index;
+	}
+
+	/**  ҽ ıϰ  Ʈ ȯմϴ. */
+	void DestroySlot(uint32_t index)
+	{
+		Slot& slot = slots_[index];
+		if (slot.resource->IsInitialized())
+		{
+			slot.resource->Release();
+		}
+		resourcePool_.Destroy(slot.resource);
+
+		slot.resource = nullptr;
+		slot.generation = (slot.generation == MAX_GENERATION) ? 1 : slot.generation + 1;
+		slot.nextFreeIndex = freeListHead_;
+		freeListHead_ = index;
+	}
+
+private:
+	/** ҽ ü ϴ Ʈ ǮԴϴ. */
+	ObjectPool<TResource> resourcePool_;
+
+	/**   Դϴ. */
+	std::vector<Slot> slots_;
+
+	/**  Ʈ ù °  εԴϴ. */
+	uint32_t freeListHead_ = INVALID_INDEX;
+};
\ No newline at end of file
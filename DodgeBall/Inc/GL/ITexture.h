@@ -27,4 +27,7 @@ public:
 	/** ؽó / ũ⸦ ϴ. */
 	virtual int32_t GetWidth() const = 0;
 	virtual int32_t GetHeight() const = 0;
+
+	/** ؽó   ϴ GPU ޸ ġ(Ʈ) ϴ. ̹ ߰ ϴ İ Ÿʹ  ʽϴ. */
+	virtual uint64_t GetGPUMemoryByteSize() const = 0;
 };
\ No newline at end of file
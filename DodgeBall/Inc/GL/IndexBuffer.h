@@ -7,11 +7,29 @@
 /**
  *  ο ε  ε Դϴ.
  *  ε    STATIC ̰, ݵ ؽ ۿ Բ ؾ մϴ.
+ * ε ׻ 32Ʈ 迭 ϰ, ۴ ε Ÿ ũ ȯؼ մϴ.
  */
 class IndexBuffer : public GLResource
 {
 public:
-	IndexBuffer(const void* bufferPtr, uint32_t indexCount);
+	/** ε  ŸԴϴ. https://registry.khronos.org/OpenGL-Refpages/gl4/html/glDrawElements.xhtml */
+	enum class EType
+	{
+		UNSIGNED_BYTE  = 0x1401,
+		UNSIGNED_SHORT = 0x1403,
+		UNSIGNED_INT   = 0x1405,
+	};
+
+public:
+	/**
+	 * ε 迭 ִ ǥ  ִ   Ÿ(16Ʈ Ǵ 32Ʈ) ε ۸ մϴ.
+	 * 8Ʈ ε  GPU ϵ  ʾ ȯ  ߻ϹǷ, ڵ  ʽϴ.
+	 */
+	IndexBuffer(const uint32_t* indices, uint32_t indexCount);
+
+	/** ε Ÿ indexCount ε   մϴ.  ڸ ̿ϸ ߿ SetIndexData ä ־ մϴ. */
+	IndexBuffer(uint32_t indexCount, const EType& type);
+
 	virtual ~IndexBuffer();
 
 	DISALLOW_COPY_AND_ASSIGN(IndexBuffer);
@@ -24,10 +42,36 @@ public:
 	/** ε ε ۸ ε մϴ. */
 	void Unbind();
 
+	/**
+	 * [firstIndex, firstIndex + indexCount)  ε մϴ. ū ۸  ޽ð    մϴ.
+	 * ̶,  ε ε  Ÿ ǥ  ־ մϴ.
+	 */
+	void SetIndexData(const uint32_t* indices, uint32_t firstIndex, uint32_t indexCount);
+
 	/** ε   ϴ. */
 	uint32_t GetIndexCount() const { return indexCount_; }
 
+	/** ε  Ÿ԰ Ʈ ũ⸦ ϴ. */
+	EType GetType() const { return type_; }
+	uint32_t GetIndexSize() const { return GetIndexSize(type_); }
+
+	/** ε  OpenGL Ʈ ID ϴ. */
+	uint32_t GetIndexBufferID() const { return indexBufferID_; }
+
+	/** ִ maxIndex ε   ִ   Ÿ(16Ʈ Ǵ 32Ʈ) ϴ. */
+	static EType SelectType(uint32_t maxIndex)
+	{
+		return (maxIndex <= 0xFFFF) ? EType::UNSIGNED_SHORT : EType::UNSIGNED_INT;
+	}
+
+	/** ε Ÿ Ʈ ũ⸦ ϴ. */
+	static uint32_t GetIndexSize(const EType& type)
+	{
+		return (type == EType::UNSIGNED_BYTE) ? 1 : ((type == EType::UNSIGNED_SHORT) ? 2 : 4);
+	}
+
 private:
 	uint32_t indexBufferID_ = 0;
 	uint32_t indexCount_ = 0;
+	EType type_ = EType::UNSIGNED_INT;
 };
\ No newline at end of file
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstdint>
+
+#include "GL/GLResource.h"
+#include "GL/PersistentBufferRing.h"
+
+/**
+ * glMultiDrawElementsIndirect д ׸  ϳԴϴ.   ũ OpenGL  ƾ մϴ.
+ * https://registry.khronos.org/OpenGL-Refpages/gl4/html/glMultiDrawElementsIndirect.xhtml
+ */
+struct DrawElementsIndirectCommand
+{
+	uint32_t indexCount;
+	uint32_t instanceCount;
+	uint32_t firstIndex;
+	int32_t baseVertex;
+	uint32_t baseInstance;
+};
+
+/**
+ *  ׸ (DrawElementsIndirectCommand) ϴ Դϴ.
+ *  Ӹ ٲǷ ׻    ۷ ϰ, ʹ Allocate Ҵ ޸𸮿  մϴ.
+ */
+class IndirectBuffer : public GLResource
+{
+public:
+	/**  ӿ   ִ ִ   մϴ. */
+	IndirectBuffer(uint32_t maxCommandCount);
+	virtual ~IndirectBuffer();
+
+	DISALLOW_COPY_AND_ASSIGN(IndirectBuffer);
+
+	virtual void Release() override;
+
+	/**  ׸ ۸ ο εմϴ. */
+	void Bind();
+
+	/** ε  ׸ ۸ ε մϴ. */
+	void Unbind();
+
+	/**    commandCount   ޸𸮸 Ҵմϴ. ȯ   ׸ ȣ indirect ڷ մϴ. */
+	BufferAllocation Allocate(uint32_t commandCount);
+
+	/**  ӿ   ִ ִ   ϴ. */
+	uint32_t GetMaxCommandCount() const { return maxCommandCount_; }
+
+private:
+	uint32_t indirectBufferID_ = 0;
+	uint32_t maxCommandCount_ = 0;
+
+	/**    Դϴ. */
+	PersistentBufferRing persistentBufferRing_;
+};
\ No newline at end of file
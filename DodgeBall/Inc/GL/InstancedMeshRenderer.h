@@ -0,0 +1,86 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "Utils/Macro.h"
+
+class IndexBuffer;
+class Shader;
+class ShaderCompileBatch;
+class VertexArray;
+class VertexBuffer;
+
+/** νϽ ޽ ؽԴϴ. */
+struct MeshVertex
+{
+	glm::vec3 position;
+	glm::vec3 normal;
+};
+
+/**
+ * νϽ ϳ Դϴ.
+ * ó ȸ  ʴ ޽ø  ϹǷ, ȯ   ġ  ũ⸸ ؼ νϽ ۷ 20Ʈ Դϴ.
+ */
+struct MeshInstance
+{
+	/**  ġ(xyz)  ũ(w)Դϴ. */
+	glm::vec4 positionScale;
+
+	/** RGBA8 Դϴ.  Ʈ R, G, B, A Դϴ. */
+	uint32_t color;
+};
+
+/**
+ * ϳ ޽ø   νϽ ׸ Դϴ.
+ * νϽ ʹ  ε ؽ (EUsage::PERSISTENT)  ϰ, νϽ  Ӽ(divisor = 1) нϴ.
+ * Ӹ  ٸ  ϹǷ, ׸ ȣ  νϽ(baseInstance) ̹    ġ մϴ.
+ * ex)
+ * MeshInstance* instances = renderer.AllocateInstances(ballCount);
+ * JobManager::GetRef().ParallelFor(ballCount, 4096, [&](uint32_t begin, uint32_t end) { ... instances[index] = ...; });
+ * renderer.Draw(viewProjection, lightDirection);
+ */
+class InstancedMeshRenderer
+{
+public:
+	/** ̴  ġ ϸ ̴ ġ ߰ϰ, ġ ϷǱ  Draw ȣ ʾƾ մϴ. */
+	InstancedMeshRenderer(const std::vector<MeshVertex>& vertices, const std::vector<uint32_t>& indices, uint32_t maxInstanceCount, ShaderCompileBatch* shaderCompileBatch = nullptr);
+	virtual ~InstancedMeshRenderer();
+
+	DISALLOW_COPY_AND_ASSIGN(InstancedMeshRenderer);
+
+	/**
+	 * ̹ ӿ ׸ νϽ ޸𸮸 Ҵմϴ. ȯ ޸𸮴 GPU д ۿ  εǾ Ƿ ⸸ ؾ մϴ.
+	 * ̶,  ӿ Ҵ νϽ  ִ νϽ    ϴ.
+	 */
+	MeshInstance* AllocateInstances(uint32_t instanceCount);
+
+	/** ̹ ӿ Ҵ  νϽ ׸ϴ.  Ҵ νϽ ϳ ׸ ȣ ׸ϴ. */
+	void Draw(const glm::mat4& viewProjection, const glm::vec3& lightDirection);
+
+	/**  ӿ ׸  ִ ִ νϽ  ϴ. */
+	uint32_t GetMaxInstanceCount() const { return maxInstanceCount_; }
+
+private:
+	/** ̹ ӿ ׸ νϽ Դϴ. */
+	struct InstanceRange
+	{
+		uint32_t baseInstance;
+		uint32_t instanceCount;
+	};
+
+private:
+	uint32_t maxInstanceCount_ = 0;
+
+	Shader* shader_ = nullptr;
+	VertexBuffer* meshVertexBuffer_ = nullptr;
+	IndexBuffer* meshIndexBuffer_ = nullptr;
+	VertexBuffer* instanceBuffer_ = nullptr;
+	VertexArray* vertexArray_ = nullptr;
+
+	/** ̹ ӿ Ҵ νϽ  Ҵ  εԴϴ. */
+	std::vector<InstanceRange> instanceRanges_;
+	uint64_t frameIndex_ = 0;
+};
\ No newline at end of file
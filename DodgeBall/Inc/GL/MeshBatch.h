@@ -0,0 +1,97 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "GL/IndirectBuffer.h"
+#include "GL/VertexArray.h"
+
+#include "Utils/Macro.h"
+
+class IndexBuffer;
+class VertexBuffer;
+
+/** ޽ ġ ׸  ߻ ׸ ɰ OpenGL ׸ ȣ Դϴ. */
+struct MeshBatchStatistics
+{
+	uint32_t commandCount = 0;
+	uint32_t drawCallCount = 0;
+};
+
+/**
+ *  ؽ ̾ƿ ϴ  ޽ø ϳ ؽ/ε ۿ Ƽ    ׸ ȣ ׸ ġԴϴ.
+ * ޽ô AddMesh ū  տ   ҴϹǷ, ó      ʴ  Ʈ մϴ.
+ * Ӹ Submit ׸ ޽ø ϰ Draw ȣϸ,    ׸ ۿ    
+ * glMultiDrawElementsIndirect    ޽ø ׸ϴ.  Ӵ CPU  ޽  ϰ ׸ ȣ ϳ   ϳԴϴ.
+ * ̴ gl_DrawID( ) Ǵ gl_BaseInstance ޽ú ͸   ֽϴ.
+ * ex)
+ * MeshBatch arenaBatch(layout, 65536, 262144, 1024);
+ * uint32_t pillarMesh = arenaBatch.AddMesh(vertices.data(), vertexCount, indices.data(), indexCount);
+ * ...
+ * arenaBatch.Submit(pillarMesh);
+ * arenaShader->Bind();
+ * arenaBatch.Draw();
+ */
+class MeshBatch
+{
+public:
+	/** ؽ ̾ƿ ġ   ִ ִ ؽ , ִ ε ,   ִ ׸   մϴ. */
+	MeshBatch(const VertexLayout& layout, uint32_t maxVertexCount, uint32_t maxIndexCount, uint32_t maxCommandCount);
+	virtual ~MeshBatch();
+
+	DISALLOW_COPY_AND_ASSIGN(MeshBatch);
+
+	/**
+	 * ޽ø ġ ۿ ߰ϰ ޽ ε ȯմϴ.
+	 * ؽ ̾ƿ stride ũ ġ ̰, ε ޽ ù ° ؽ  ϴ 32Ʈ εԴϴ.
+	 * ε ۴ ִ ؽ  ´   ε Ÿ մϴ.
+	 */
+	uint32_t AddMesh(const void* vertices, uint32_t vertexCount, const uint32_t* indices, uint32_t indexCount);
+
+	/** ̹ ӿ ׸ ޽ø մϴ. */
+	void Submit(uint32_t meshIndex, uint32_t instanceCount = 1, uint32_t baseInstance = 0);
+
+	/**   ޽ø    ׸ ȣ ׸  ϴ. ̴ ȣϱ  εؾ մϴ. */
+	void Draw();
+
+	/** ġ ߰ ޽  ϴ. */
+	uint32_t GetMeshCount() const { return static_cast<uint32_t>(meshes_.size()); }
+
+	/** ġ ۿ Ҵ ؽ  ε  ϴ. */
+	uint32_t GetVertexCount() const { return vertexCount_; }
+	uint32_t GetIndexCount() const { return indexCount_; }
+
+	/**  ׸ ġ 踦 ϴ. */
+	const MeshBatchStatistics& GetStatistics() const { return statistics_; }
+
+private:
+	/** ġ ۿ ޽ð ϴ Դϴ. */
+	struct MeshRange
+	{
+		uint32_t firstIndex;
+		uint32_t indexCount;
+		int32_t baseVertex;
+	};
+
+private:
+	VertexLayout layout_;
+
+	uint32_t maxVertexCount_ = 0;
+	uint32_t maxIndexCount_ = 0;
+
+	/** ݱ Ҵ ؽ  ε Դϴ.  ޽ô  ġ Ҵմϴ. */
+	uint32_t vertexCount_ = 0;
+	uint32_t indexCount_ = 0;
+
+	VertexBuffer* vertexBuffer_ = nullptr;
+	IndexBuffer* indexBuffer_ = nullptr;
+	IndirectBuffer* indirectBuffer_ = nullptr;
+	VertexArray* vertexArray_ = nullptr;
+
+	std::vector<MeshRange> meshes_;
+
+	/** ̹ ӿ  ׸ Դϴ. */
+	std::vector<DrawElementsIndirectCommand> commands_;
+
+	MeshBatchStatistics statistics_;
+};
\ No newline at end of file
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+/** ޽ ȭ  Դϴ. */
+struct MeshOptimizationStatistics
+{
+	/** ȭ  ACMR(ﰢ  ؽ ĳ ̽ )Դϴ. ̻  0.5 , ־  3Դϴ. */
+	float acmrBefore = 0.0f;
+	float acmrAfter = 0.0f;
+
+	/** ȭ  ؽ Դϴ. ε  ʴ ؽ ŵ˴ϴ. */
+	uint32_t vertexCountBefore = 0;
+	uint32_t vertexCountAfter = 0;
+};
+
+/**
+ * ޽ø GPU б   ġϴ óԴϴ. ޽ø ε    ϸ,   ٲ ʽϴ.
+ * 1. ؽ ĳ ȭ: ȯ  ؽ ĳ(post-transform vertex cache)  þ ﰢ  ٲߴϴ. (Tom Forsyth, Linear-Speed Vertex Cache Optimisation)
+ * 2. ؽ ġ ȭ: ε ó ϴ  ؽ ġؼ ؽ ۸  е մϴ.
+ * ex)
+ * std::vector<MeshVertex> vertices = ...;
+ * std::vector<uint32_t> indices = ...;
+ * MeshOptimizationStatistics statistics = MeshOptimizer::Optimize(vertices, indices);
+ */
+class MeshOptimizer
+{
+public:
+	/** ACMR   ϴ FIFO ؽ ĳ ⺻ ũԴϴ. */
+	static const uint32_t DEFAULT_CACHE_SIZE = 16;
+
+public:
+	/** FIFO ؽ ĳø ùķ̼ؼ ACMR(ﰢ  ؽ ĳ ̽ ) մϴ. */
+	static float ComputeACMR(const uint32_t* indices, uint32_t indexCount, uint32_t vertexCount, uint32_t cacheSize = DEFAULT_CACHE_SIZE);
+
+	/** ؽ ĳ  þ ﰢ  ٲߴϴ. ؽ ʹ ٲ ʽϴ. */
+	static void OptimizeVertexCache(uint32_t* indices, uint32_t indexCount, uint32_t vertexCount);
+
+	/**
+	 * ε ó ϴ  ؽ ġϰ ε մϴ.
+	 *  ʴ ؽ   з, ȯ  Ǵ ؽ Դϴ.
+	 */
+	static uint32_t OptimizeVertexFetch(void* vertices, uint32_t vertexCount, uint32_t vertexStride, uint32_t* indices, uint32_t indexCount);
+
+	/** ؽ ĳ ȭ ؽ ġ ȭ  ϰ,  ʴ ؽ մϴ. */
+	template <typename TVertex>
+	static MeshOptimizationStatistics Optimize(std::vector<TVertex>& vertices, std::vector<uint32_t>& indices)
+	{
+		uint32_t vertexCount = static_cast<uint32_t>(vertices.size());
+		uint32_t indexCount = static_cast<uint32_t>(indices.size());
+
+		MeshOptimizationStatistics statistics;
+		statistics.vertexCountBefore = vertexCount;
+		statistics.acmrBefore = ComputeACMR(indices.data(), indexCount, vertexCount);
+
+		OptimizeVertexCache(indices.data(), indexCount, vertexCount);
+		vertices.resize(OptimizeVertexFetch(vertices.data(), vertexCount, static_cast<uint32_t>(sizeof(TVertex)), indices.data(), indexCount));
+
+		statistics.vertexCountAfter = static_cast<uint32_t>(vertices.size());
+		statistics.acmrAfter = ComputeACMR(indices.data(), indexCount, statistics.vertexCountAfter);
+		return statistics;
+	}
+};
\ No newline at end of file
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <cstdint>
+
+#include "Utils/Macro.h"
+
+/**   ۿ Ҵ ޸ Դϴ. */
+struct BufferAllocation
+{
+	void* bufferPtr = nullptr; /** CPU ͸  ε ޸ ּԴϴ. */
+	uint32_t offset = 0;       /**   ġκ Ʈ Դϴ. ο ̳ glBindBufferRange մϴ. */
+	uint32_t byteSize = 0;     /** Ҵ  Ʈ ũԴϴ. */
+};
+
+/**
+ * glBufferStorage  ۸ GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT   ϰ,
+ * Ӹ GLManager::MAX_FRAMES_IN_FLIGHT   ϳ   Ҵϴ  Դϴ.
+ *   GL Ŵ    ϴ 潺 ȣǹǷ, Ҵ ޸𸮿   ̹ ȭ ߻ ʽϴ.
+ * ̶,  Ŭ ؽ ۿ   PERSISTENT    մϴ.
+ */
+class PersistentBufferRing
+{
+public:
+	PersistentBufferRing() = default;
+	virtual ~PersistentBufferRing() {}
+
+	DISALLOW_COPY_AND_ASSIGN(PersistentBufferRing);
+
+	/**
+	 *    ϰ  մϴ.
+	 * ̶, ۴ ü  ũ(regionByteSize * MAX_FRAMES_IN_FLIGHT)ŭ ǰ, Ҵ  ġ alignment  ĵ˴ϴ.
+	 */
+	void Initialize(uint32_t target, uint32_t bufferID, uint32_t regionByteSize, uint32_t alignment);
+
+	/**  մϴ.   ۸  ҽ մϴ. */
+	void Release();
+
+	/**    ޸𸮸 Ҵմϴ. Ҵ ޸𸮴    Ѿ  ȿմϴ. */
+	BufferAllocation Allocate(uint32_t byteSize);
+
+	/**   θ Ȯմϴ. */
+	bool IsMapped() const { return mappedBufferPtr_ != nullptr; }
+
+	/**   ϳ Ʈ ũ⸦ ϴ. */
+	uint32_t GetRegionByteSize() const { return regionByteSize_; }
+
+private:
+	/**  ε Դϴ. */
+	uint32_t target_ = 0;
+
+	/**    IDԴϴ. */
+	uint32_t bufferID_ = 0;
+
+	/**   ϳ Ʈ ũԴϴ. */
+	uint32_t regionByteSize_ = 0;
+
+	/** Ҵ  ġ  ũԴϴ. */
+	uint32_t alignment_ = 1;
+
+	/**  ε   ּԴϴ. */
+	uint8_t* mappedBufferPtr_ = nullptr;
+
+	/**  Ҵ   εԴϴ. */
+	uint64_t frameIndex_ = 0;
+
+	/**      Ҵ  Դϴ. */
+	uint32_t regionOffset_ = 0;
+};
\ No newline at end of file
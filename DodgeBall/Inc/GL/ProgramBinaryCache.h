@@ -0,0 +1,84 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "Utils/Macro.h"
+
+/** ̴ α׷ ϴ ̴  ϳ (GLenum) ҽ ڵԴϴ. */
+struct ShaderStageSource
+{
+	uint32_t type;
+	const std::string* source;
+};
+
+/** α׷ ̳ʸ ĳ ȸ/ Դϴ. */
+struct ProgramBinaryCacheStatistics
+{
+	/** ĳ ̳ʸ α׷  ȽԴϴ. */
+	uint32_t hitCount = 0;
+
+	/** ĳ   ҽ  ȽԴϴ. */
+	uint32_t missCount = 0;
+
+	/** ĳ  ־ ջǾų ̹ ̳ʸ źؼ ҽ  ȽԴϴ. */
+	uint32_t rejectCount = 0;
+
+	/**  α׷ ̳ʸ ĳ Ϸ  ȽԴϴ. */
+	uint32_t storeCount = 0;
+};
+
+/**
+ * ũ ̴ α׷ ̳ʸ(glGetProgramBinary) ũ ϰ,  ࿡   ҷ(glProgramBinary) ĳԴϴ.
+ * ĳ Ű ̹ ĺ ڿ(GL_VENDOR, GL_RENDERER, GL_VERSION)  ̴  /ҽ ڵ ؽ̹Ƿ, ̴ ̹ ٲ ڵ ٸ  մϴ.
+ * ̹   ڿ ̳ʸ ź  Ƿ, ҷ⿡ ϸ 0 ȯϰ ȣڴ ҽ ؾ մϴ.
+ * ex)
+ * uint64_t key = programBinaryCache->ComputeKey(stages);
+ * uint32_t programID = programBinaryCache->Load(key);
+ * if (!programID)
+ * {
+ *     programID = ...; // ҽ   ũ (GL_PROGRAM_BINARY_RETRIEVABLE_HINT )
+ *     programBinaryCache->Store(key, programID);
+ * }
+ */
+class ProgramBinaryCache
+{
+public:
+	/** ĳ   ͸ η ĳø մϴ. ͸ ٸ մϴ. ̶, OpenGL ؽƮ  忡 εǾ ־ մϴ. */
+	explicit ProgramBinaryCache(const std::string& directoryPath);
+	virtual ~ProgramBinaryCache();
+
+	DISALLOW_COPY_AND_ASSIGN(ProgramBinaryCache);
+
+	/** ̹ α׷ ̳ʸ  ϳ ̻ ϴ Ȯմϴ.  ʴ´ٸ ĳø   ϴ. */
+	bool IsAvailable() const { return !binaryFormats_.empty(); }
+
+	/** ̴   ҽ ڵ ĳ Ű մϴ. */
+	uint64_t ComputeKey(const std::vector<ShaderStageSource>& stages) const;
+
+	/** ĳ Ű ϴ ̳ʸ ̴ α׷ մϴ. ĳ  ų ̹ ̳ʸ źϸ 0 ȯմϴ. */
+	uint32_t Load(uint64_t key);
+
+	/** ũ  ̴ α׷ ̳ʸ ĳ Ű ϴ Ϸ մϴ. */
+	bool Store(uint64_t key, uint32_t programID);
+
+	/** ĳ ȸ/ 踦 ϴ. */
+	const ProgramBinaryCacheStatistics& GetStatistics() const { return statistics_; }
+
+private:
+	/** ĳ Ű ϴ ĳ  θ ϴ. */
+	std::string GetFilePath(uint64_t key) const;
+
+private:
+	/** ĳ   ͸ Դϴ. */
+	std::string directoryPath_;
+
+	/** ̹ ĺ ڿ ؽԴϴ.  ĳ Ű   մϴ. */
+	uint64_t driverHash_ = 0;
+
+	/** ̹ ϴ α׷ ̳ʸ Դϴ. */
+	std::vector<int32_t> binaryFormats_;
+
+	ProgramBinaryCacheStatistics statistics_;
+};
\ No newline at end of file
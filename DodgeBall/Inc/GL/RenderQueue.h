@@ -0,0 +1,151 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "GL/IndexBuffer.h"
+
+#include "Utils/Macro.h"
+
+/**
+ *  ť ϴ ׸ Դϴ.
+ *  Ű  ǹǷ,  ̴/Ƽ ϴ     Ǿ   ּȭ˴ϴ.
+ * ε ۴ ؽ 迭 ε ε ۸ ϸ, ε Ÿ  ε  Ÿ԰ ƾ մϴ.
+ */
+struct RenderCommand
+{
+	/** RenderQueue::MakeSortKey   ŰԴϴ. */
+	uint64_t sortKey = 0;
+
+	/** ׸⿡  ̴ α׷ ؽ 迭Դϴ. */
+	uint32_t programID = 0;
+	uint32_t vertexArrayID = 0;
+
+	/** 0 ؽó ֿ ε 2D ؽóԴϴ. 0̸ ε ʽϴ. */
+	uint32_t textureID = 0;
+
+	/** ׸    Դϴ. ũⰡ 0̸ ε ʽϴ. */
+	uint32_t uniformBufferID = 0;
+	uint32_t uniformOffset = 0;
+	uint32_t uniformByteSize = 0;
+
+	/** ؽ 迭 ε ε  ε ŸԴϴ. */
+	IndexBuffer::EType indexType = IndexBuffer::EType::UNSIGNED_INT;
+
+	/** ׸ Դϴ. */
+	uint32_t indexCount = 0;
+	uint32_t firstIndex = 0;
+	int32_t baseVertex = 0;
+	uint32_t instanceCount = 1;
+};
+
+/**  ť   ߻   ׸ ȣ Դϴ. */
+struct RenderQueueStatistics
+{
+	uint32_t commandCount = 0;
+	uint32_t programChangeCount = 0;
+	uint32_t vertexArrayChangeCount = 0;
+	uint32_t textureChangeCount = 0;
+	uint32_t uniformBufferChangeCount = 0;
+};
+
+/**
+ *  Ű  ׸  ťԴϴ.
+ *  尡 ÿ Submit    ,   ڽŸ  ۿ ϹǷ    ߻ ʽϴ.
+ *   Sort    ؼ  (radix sort)ϰ, Execute ĵ  ׸⸦ մϴ.
+ * ̶, Sort/Execute/Reset ٸ 尡  ϰ    ȣؾ մϴ.
+ * ex)
+ * RenderQueue renderQueue;
+ * JobManager::GetRef().ParallelFor(ballCount, 1024, [&](uint32_t begin, uint32_t end) { ... renderQueue.Submit(command); });
+ * renderQueue.Sort();
+ * renderQueue.Execute();
+ * renderQueue.Reset();
+ */
+class RenderQueue
+{
+public:
+	/**  Ű  ʵ尡 ϴ Ʈ Դϴ.  Ʈ н, ̴, Ƽ,  Դϴ. */
+	static const uint32_t PASS_BITS = 8;
+	static const uint32_t SHADER_BITS = 12;
+	static const uint32_t MATERIAL_BITS = 20;
+	static const uint32_t DEPTH_BITS = 24;
+
+	/** ׸   ۸ ε Դϴ. */
+	static const uint32_t DRAW_UNIFORM_BUFFER_SLOT = 0;
+
+public:
+	RenderQueue();
+	virtual ~RenderQueue();
+
+	DISALLOW_COPY_AND_ASSIGN(RenderQueue);
+
+	/**
+	 *  Ű մϴ.   ʵ Ʈ  Ѵ  Ʈ ߸ϴ.
+	 * ̴    ǹǷ,  нó  ü  ׷ Ѵٸ ̸ ؼ մϴ.
+	 */
+	static uint64_t MakeSortKey(uint32_t pass, uint32_t shader, uint32_t material, uint32_t depth)
+	{
+		uint64_t key = static_cast<uint64_t>(pass & ((1u << PASS_BITS) - 1));
+		key = (key << SHADER_BITS) | static_cast<uint64_t>(shader & ((1u << SHADER_BITS) - 1));
+		key = (key << MATERIAL_BITS) | static_cast<uint64_t>(material & ((1u << MATERIAL_BITS) - 1));
+		key = (key << DEPTH_BITS) | static_cast<uint64_t>(depth & ((1u << DEPTH_BITS) - 1));
+		return key;
+	}
+
+	/**    ۿ ׸  մϴ. */
+	void Submit(const RenderCommand& command);
+
+	/**    ϰ  Ű  մϴ.  Ű     ,   մϴ. */
+	void Sort();
+
+	/** ĵ  մϴ.  ɰ ٸ ¸ GL Ŵ  ĳø  մϴ. */
+	void Execute();
+
+	/**    մϴ.   ޸𸮴  ӿ մϴ. */
+	void Reset();
+
+	/** ĵ   ϴ. */
+	uint32_t GetCommandCount() const { return static_cast<uint32_t>(sortEntries_.size()); }
+
+	/** ĵ  index°  ϴ. */
+	const RenderCommand& GetSortedCommand(uint32_t index) const { return commands_[sortEntries_[index].commandIndex]; }
+
+	/**    踦 ϴ. */
+	const RenderQueueStatistics& GetStatistics() const { return statistics_; }
+
+private:
+	/** 庰  Դϴ. ٸ  ۿ  ĳ   ʵ մϴ. */
+	struct alignas(64) ThreadCommandBuffer
+	{
+		std::thread::id threadID;
+		std::vector<RenderCommand> commands;
+	};
+
+	/**  Դϴ.  ü  Ű ε ̵ؼ   Դϴ. */
+	struct SortEntry
+	{
+		uint64_t sortKey;
+		uint32_t commandIndex;
+	};
+
+	/**    ۸ ϴ. ۰ ٸ մϴ. */
+	ThreadCommandBuffer& GetThreadCommandBuffer();
+
+private:
+	/**  ť  IDԴϴ. 庰  ĳð ı ť ۸  ʵ ּ  մϴ. */
+	uint64_t queueID_ = 0;
+
+	/** 庰  Դϴ. ۸ ߰  ޴ϴ. */
+	std::mutex threadCommandBuffersMutex_;
+	std::vector<std::unique_ptr<ThreadCommandBuffer>> threadCommandBuffers_;
+
+	/**  ɰ  Դϴ. ޸𸮴 Ӹ մϴ. */
+	std::vector<RenderCommand> commands_;
+	std::vector<SortEntry> sortEntries_;
+	std::vector<SortEntry> sortBuffer_;
+
+	RenderQueueStatistics statistics_;
+};
\ No newline at end of file
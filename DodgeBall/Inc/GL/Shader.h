@@ -1,31 +1,127 @@
 #pragma once
 
+#include <cstdint>
 #include <string>
 #include <vector>
 
+#include <glm/glm.hpp>
+
 #include "GL/GLResource.h"
+#include "GL/ProgramBinaryCache.h"
+
+#include "Utils/FlatHashMap.h"
+#include "Utils/NameID.h"
+
+/** ũ α׷ ݿ(reflection) ⺻ (default block) Դϴ. */
+struct ShaderUniform
+{
+	/**  ġԴϴ. glProgramUniform* մϴ. */
+	int32_t location;
+
+	/**  Ÿ(GL_FLOAT_VEC3, GL_SAMPLER_2D ) 迭 ũԴϴ. 迭 ƴ϶ ũ 1Դϴ. */
+	uint32_t type;
+	int32_t arraySize;
+};
+
+/** ũ α׷ ݿ   Ǵ ̴ 丮 Դϴ. */
+struct ShaderBlock
+{
+	/** α׷ ȿ  εԴϴ. */
+	uint32_t index;
+
+	/**    ε Դϴ. */
+	uint32_t binding;
 
-/** OpenGL ̴ α׷ ҽԴϴ. */
+	/**   ּ Ʈ ũԴϴ. 迭 ũⰡ   丮   迭  ϳ  ũԴϴ. */
+	uint32_t dataSize;
+};
+
+/**
+ * OpenGL ̴ α׷ ҽԴϴ.
+ * GL Ŵ α׷ ̳ʸ ĳð Ǿ ִٸ, ĳõ ̳ʸ α׷ ϰ ĳÿ   ҽ մϴ.
+ * 񵿱   ϸ ϰ ũ ɸ ϰ  ٸ Ƿ, ̹ ϴ  ٸ α׷ ϰų    ֽϴ.
+ * ũ  Ȱ / /丮    ݿؼ ̸ ID ã  ִ ̺ մϴ.
+ *   glProgramUniform* ϹǷ, Ӹ ڿ ġ ȸϰų α׷ ε ʽϴ.
+ * ex)
+ * static constexpr NameID VIEW_PROJECTION("viewProjection");
+ * shader->SetUniform(VIEW_PROJECTION, viewProjection);
+ */
 class Shader : public GLResource
 {
 public:
-	/**  ǥ ڿ  ̴ ҽ ڵԴϴ. ҽ   ƴմϴ. */
+	/** ̴ α׷  Դϴ. */
+	enum class ECompileMode
+	{
+		SYNCHRONOUS  = 0x00, /** ڿ ϰ ũ   մϴ. */
+		ASYNCHRONOUS = 0x01, /** ڴ ϰ ũ ⸸ ϰ, PollCompletion ϷḦ Ȯմϴ. */
+	};
+
+public:
+	/**  ǥ ڿ  ̴ ҽ ڵԴϴ. ҽ   ƴմϴ.  ڵ   մϴ. */
 	Shader(const std::string& csSource);
 	Shader(const std::string& vsSource, const std::string& fsSource);
 	Shader(const std::string& vsSource, const std::string& gsSource, const std::string& fsSource);
 
+	/** ̴   ̴ α׷ մϴ. ҽ ڵ ڰ ȯ ڿ ص ˴ϴ. */
+	Shader(const std::vector<ShaderStageSource>& stages, const ECompileMode& compileMode);
+
 	virtual ~Shader();
 
 	DISALLOW_COPY_AND_ASSIGN(Shader);
 
 	virtual void Release() override;
 
-	/** ̴ α׷  ο εմϴ. */
+	/** ̴ α׷  ο εմϴ.   ʾҴٸ   մϴ. */
 	void Bind();
 
 	/** ε ̴ α׷ ε մϴ. */
 	void Unbind();
 
+	/**
+	 * ϰ ũ  Ȯϰ, ٸ  ˻մϴ.
+	 * GL_KHR_parallel_shader_compile ϸ  ʰ,    ٷ ˻ϹǷ   մϴ.
+	 */
+	bool PollCompletion();
+
+	/** ϰ ũ   ϰ  ˻մϴ. */
+	void WaitCompletion();
+
+	/** ϰ ũ  ̴ α׷   ִ Ȯմϴ. */
+	bool IsReady() const { return bIsReady_; }
+
+	/** ̴ α׷ OpenGL Ʈ ID ϴ. */
+	uint32_t GetProgramID() const { return programID_; }
+
+	/**
+	 * ̸ ϴ / /丮  ãϴ. Ȱȭ (ȭ ŵ) ̸̶ nullptr ȯմϴ.
+	 * ̶, ̴ α׷   ִ (IsReady) մϴ. 迭  "name" "name[0]" η ã  ֽϴ.
+	 */
+	const ShaderUniform* FindUniform(const NameID& name) const;
+	const ShaderBlock* FindUniformBlock(const NameID& name) const;
+	const ShaderBlock* FindStorageBlock(const NameID& name) const;
+
+	/** ̸ ϴ  ġ ϴ. Ȱȭ  ̶ -1 ȯմϴ. */
+	int32_t GetUniformLocation(const NameID& name) const;
+
+	/** ݿ / /丮   ϴ. */
+	uint32_t GetUniformCount() const { return uniforms_.GetSize(); }
+	uint32_t GetUniformBlockCount() const { return uniformBlocks_.GetSize(); }
+	uint32_t GetStorageBlockCount() const { return storageBlocks_.GetSize(); }
+
+	/**  /丮   ε Կ մϴ. Ȱȭ  ̶ ƹ ۵  ʽϴ. */
+	void SetUniformBlockBinding(const NameID& name, uint32_t binding);
+	void SetStorageBlockBinding(const NameID& name, uint32_t binding);
+
+	/**   մϴ. ̴ α׷ ε ʾƵ ǰ, Ȱȭ  ̶ ƹ ۵  ʽϴ. */
+	void SetUniform(const NameID& name, int32_t value);
+	void SetUniform(const NameID& name, uint32_t value);
+	void SetUniform(const NameID& name, float value);
+	void SetUniform(const NameID& name, const glm::vec2& value);
+	void SetUniform(const NameID& name, const glm::vec3& value);
+	void SetUniform(const NameID& name, const glm::vec4& value);
+	void SetUniform(const NameID& name, const glm::mat3& value);
+	void SetUniform(const NameID& name, const glm::mat4& value);
+
 private:
 	/** ̴ Դϴ. */
 	enum class EType : int32_t
@@ -38,9 +134,35 @@ private:
 		COMPUTE    = 0x91B9,
 	};
 
+	/** ̴  ϰ α׷ ũ մϴ. α׷ ̳ʸ ĳø   ִٸ ĳø  ȸմϴ. */
+	void Submit(const std::vector<ShaderStageSource>& stages);
+
+	/** /ũ  ˻ϰ, ̴ Ʈ ϰ, ̳ʸ ĳÿ մϴ. */
+	void Finalize();
+
+	/** ũ α׷ Ȱ / /丮  ݿմϴ. */
+	void Reflect();
+
+	/** ̴ ϰ  մϴ.   Finalize ˻մϴ. */
 	uint32_t CreateShader(const EType& type, const char* sourcePtr);
-	uint32_t CreateProgram(const std::vector<uint32_t>& shaderIDs);
+
+	/** ̴ ũؼ α׷ մϴ. bIsRetrievable ̸ ũ ̳ʸ   ֵ մϴ. */
+	uint32_t CreateProgram(const std::vector<uint32_t>& shaderIDs, bool bIsRetrievable);
 
 private:
 	uint32_t programID_ = 0;
+
+	/** ϰ ũ  Դϴ. */
+	bool bIsReady_ = false;
+
+	/** ũ  ˻ϱ  ϴ ̴ ƮԴϴ. */
+	std::vector<uint32_t> shaderIDs_;
+
+	/** α׷ ̳ʸ ĳ ŰԴϴ. */
+	uint64_t cacheKey_ = 0;
+
+	/** ݿ / /丮 Դϴ. */
+	FlatHashMap<NameID, ShaderUniform> uniforms_;
+	FlatHashMap<NameID, ShaderBlock> uniformBlocks_;
+	FlatHashMap<NameID, ShaderBlock> storageBlocks_;
 };
\ No newline at end of file
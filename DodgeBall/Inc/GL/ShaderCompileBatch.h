@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "GL/GLResourceTable.h"
+#include "GL/Shader.h"
+
+#include "Utils/Macro.h"
+
+/**
+ *  ̴ α׷  Ѳ ϰ, Ӹ Ϸ θ Ȯϴ ġԴϴ.
+ *  α׷  ϹǷ, ̹ GL_KHR_parallel_shader_compile ϸ   α׷ ÿ մϴ.
+ *  ʴ ̹ Poll ȣ  α׷ ϳ  ٸǷ, ε ȭ α׷ ̸   ֽϴ.
+ * ġ  ̴ GL Ŵ ϹǷ,   GL Ŵ ıؾ մϴ.
+ * ex)
+ * ShaderCompileBatch shaderCompileBatch;
+ * Shader* shader = shaderCompileBatch.Add(vsSource, fsSource);
+ * ...
+ * if (!shaderCompileBatch.Poll()) //  
+ * {
+ *     RenderLoadingScreen(shaderCompileBatch.GetReadyCount(), shaderCompileBatch.GetShaderCount());
+ *     return;
+ * }
+ */
+class ShaderCompileBatch
+{
+public:
+	ShaderCompileBatch() = default;
+	virtual ~ShaderCompileBatch() {}
+
+	DISALLOW_COPY_AND_ASSIGN(ShaderCompileBatch);
+
+	/** ̴ α׷ 񵿱  ϰ ġ ߰մϴ. ȯ ̴ Poll ϷḦ Ȯϱ    ϴ. */
+	Shader* Add(const std::vector<ShaderStageSource>& stages);
+	Shader* Add(const std::string& vsSource, const std::string& fsSource);
+
+	/**
+	 *   ̴ α׷ Ϸ θ Ȯմϴ. ġ  α׷ ϷǾٸ true ȯմϴ.
+	 * ̶, ϷḦ Ȯϱ  ı ̴ ġ մϴ.
+	 */
+	bool Poll();
+
+	/** ġ  α׷ Ϸ  մϴ. */
+	void Wait();
+
+	/** ġ ߰ ̴ α׷ , ߿ Ϸ  ϴ. */
+	uint32_t GetShaderCount() const { return shaderCount_; }
+	uint32_t GetReadyCount() const { return shaderCount_ - static_cast<uint32_t>(pendingShaders_.size()); }
+
+private:
+	/**    ̴ ڵԴϴ. */
+	std::vector<GLHandle<Shader>> pendingShaders_;
+
+	/** ġ ߰ ̴ α׷ Դϴ. */
+	uint32_t shaderCount_ = 0;
+};
\ No newline at end of file
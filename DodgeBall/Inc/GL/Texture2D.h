@@ -3,12 +3,23 @@
 #include <string>
 
 #include "GL/ITexture.h"
+#include "GL/TextureContainer.h"
 
-/** 2D ؽó ҽԴϴ. ϴ δ PNG, JPG, BMP, TGAԴϴ. */
+/**
+ * 2D ؽó ҽԴϴ. ϴ δ PNG, JPG, BMP, TGA ؽó Ŀ   ŷ ؽó(.dbtex)Դϴ.
+ * ؽó δ  ؽó ε尡   δ ڸ ǥ ؽó ε˴ϴ.
+ * ؽó  ڰ ū         ü üϰ, ٽ ʿ ؽó δ  Ͽ о մϴ.
+ * ̶, / ũ ϴ     ũԴϴ.
+ */
 class Texture2D : public ITexture
 {
 public:
+	/** ̹   忡 ٷ ڵϰ εմϴ. ڵ   ʰ Һ   ٷ ε , Ӹ մϴ. */
 	Texture2D(const std::string& path, const EFilter& filter);
+
+	/**   ؽó մϴ. ؽó δ 񵿱 ε ϸ,   ڵ  ڿ մϴ. */
+	explicit Texture2D(const EFilter& filter);
+
 	virtual ~Texture2D();
 
 	DISALLOW_COPY_AND_ASSIGN(Texture2D);
@@ -18,13 +29,88 @@ public:
 	virtual void Active(uint32_t unit) const override;
 	virtual int32_t GetWidth() const override { return width_; }
 	virtual int32_t GetHeight() const override { return height_; }
+	virtual uint64_t GetGPUMemoryByteSize() const override { return GetGPUMemoryByteSize(residentMipLevel_); }
+
+	/**  ū    residentMipLevel    ϴ GPU ޸ ġ(Ʈ) ϴ. */
+	uint64_t GetGPUMemoryByteSize(int32_t residentMipLevel) const;
+
+	/** ε ؽó OpenGL Ʈ ID ϴ. ε尡   ؽó δ ڸ ǥ ؽóԴϴ. */
+	uint32_t GetBindingTextureID() const;
+
+	/** ؽó   εǾ  ؽó εǴ Ȯմϴ. */
+	bool IsResident() const { return bIsResident_; }
+
+	/** / ũ⿡ ϴ ü  ü   ϴ. */
+	static int32_t GetMipLevelCount(int32_t width, int32_t height);
+
+	/**  ũ   ü   ϴ.    ٸ 0Դϴ. */
+	int32_t GetMipLevelCount() const { return mipLevelCount_; }
+
+	/**   ϴ  ū   ϴ. 0̸  ũ ӱ  մϴ. */
+	int32_t GetResidentMipLevel() const { return residentMipLevel_; }
+
+	/** ؽó    θ ϴ.     Ͽ ٽ о մϴ. */
+	const std::string& GetPath() const { return path_; }
+
+	/**
+	 * ū     ū    residentMipLevel øϴ. ؽó  ڰ մϴ.
+	 *         GPU ȿ (glCopyImageSubData)ϹǷ, CPU ġų   ٽ  ʽϴ.
+	 *     ؽó δ(TextureLoader::StreamAsync)   ڵ 忡 ٽ о մϴ.
+	 */
+	void EvictMipLevels(int32_t residentMipLevel);
 
 private:
-	uint32_t CreateTextureFromImage(const std::string& path, const EFilter& filter);
+	friend class TextureLoader;
+
+	/** ̹  ڵؼ   ϰ, ڵ  ״ εմϴ. */
+	void CreateTextureFromImage(const std::string& path);
+
+	/** ŷ ؽó  о    ϰ,     εմϴ. */
+	void CreateTextureFromContainer(const std::string& path);
+
+	/** ڵ ̹   0   εմϴ. ̹ ũ ä   ؽó ƾ մϴ. */
+	void UploadImage(uint32_t textureID, const uint8_t* imagePtr) const;
+
+	/** ü  ü  Һ  (glTextureStorage2D) ϰ ø Ķ͸ մϴ.   ʽϴ. */
+	void CreateTextureStorage(int32_t width, int32_t height, int32_t channels);
+
+	/**  İ    ؼ Һ   ϰ ø Ķ͸ մϴ. */
+	void CreateTextureStorage(int32_t width, int32_t height, int32_t channels, uint32_t internalFormat, int32_t mipLevelCount);
+
+	/**   residentMipLevel    Һ   ϰ ø Ķ͸ մϴ.  ؽó ID ȯմϴ. */
+	uint32_t CreateMipLevelStorage(int32_t residentMipLevel) const;
+
+	/**
+	 *      üմϴ. ؽó δ     ε  ȣմϴ.
+	 *   0    residentMipLevel̾ ϸ,  ϴ   GPU ȿ      մϴ.
+	 */
+	void ReplaceMipLevelStorage(uint32_t textureID, int32_t residentMipLevel);
+
+	/**   [beginLevel, endLevel) ٸ   մϴ.    0       Բ մϴ. */
+	void CopyMipLevels(uint32_t sourceID, int32_t sourceBaseLevel, uint32_t destinationID, int32_t destinationBaseLevel, int32_t beginLevel, int32_t endLevel) const;
 
 private:
 	int32_t width_ = 0;
 	int32_t height_ = 0;
 	int32_t channels_ = 0;
 	uint32_t textureID_ = 0;
+
+	/** ø Ϳ ȼ  (GL_RED, GL_RGBA )Դϴ. */
+	EFilter filter_ = EFilter::LINEAR;
+	uint32_t pixelFormat_ = 0;
+
+	/**    İ   ,  Դϴ. */
+	uint32_t internalFormat_ = 0;
+	bool bIsCompressed_ = false;
+	ECompressedFormat compressedFormat_ = ECompressedFormat::BC1;
+
+	/**  ũ   ü     ϴ  ū  Դϴ. */
+	int32_t mipLevelCount_ = 0;
+	int32_t residentMipLevel_ = 0;
+
+	/** ؽó    Դϴ. */
+	std::string path_;
+
+	/** ε尡  Դϴ. */
+	bool bIsResident_ = false;
 };
\ No newline at end of file
@@ -0,0 +1,120 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "GL/GLResource.h"
+#include "GL/ITexture.h"
+#include "Utils/FlatHashMap.h"
+#include "Utils/NameID.h"
+
+/** Ʋ󽺿 ߰ ̹Դϴ. ȼ     ä  Ǿ ־ մϴ. */
+struct TextureAtlasImage
+{
+	NameID name;
+	const uint8_t* pixels = nullptr;
+	int32_t width = 0;
+	int32_t height = 0;
+	int32_t channels = 0;
+};
+
+/** Ʋ ȿ ̹ ϴ Դϴ. */
+struct TextureAtlasRegion
+{
+	/** ̹ ġ   ؽó IDԴϴ. ؽó ID  (RenderCommand::textureID) ״   ֽϴ. */
+	uint32_t page = 0;
+	uint32_t textureID = 0;
+
+	/**   ؽó ǥ (u0, v0, u1, v1)Դϴ. (padding)  ʽϴ. */
+	glm::vec4 uvRect = glm::vec4(0.0f);
+
+	/** ̹ ũ(ؼ)Դϴ. */
+	int32_t width = 0;
+	int32_t height = 0;
+};
+
+/**
+ *  ̹   ū  ؽó(RGBA8) Ƽ ϴ ؽó ƲԴϴ.
+ * ̹ stb_rect_pack ī̶ Ŀ ġϰ, ̸(NameID)  ؽó ǥ ȸմϴ.
+ *   ̹ ϴ ׸  ؽó εϹǷ,  ť  Ű  ؽó ٽ ε ʰ ׸  ֽϴ.
+ * ε ߿ ̹  ߰ؾ Ŀ ū ̹ ġؼ   ϰ,  ߿   ̹ ϳ ߰  ֽϴ.
+ *       ϸ, ̹ ġ ̹ ġ ٲ ʽϴ.
+ * ̹ ֺ ڸ ؼ   ιǷ,  ͸ ̿ ̹   ʽϴ.
+ * ex)
+ * TextureAtlas* atlas = GLManager::GetRef().Create<TextureAtlas>(2048, ITexture::EFilter::LINEAR);
+ * atlas->AddFromFile("Button", "Resource/UI/Button.png");
+ * const TextureAtlasRegion* region = atlas->Find("Button");
+ * command.textureID = region->textureID; //  ؽó ǥ region->uvRect  ȯ
+ */
+class TextureAtlas : public GLResource
+{
+public:
+	/** ̹ ֺ  ⺻ ũ(ؼ)Դϴ. */
+	static const int32_t DEFAULT_PADDING = 1;
+
+public:
+	/**   pageSize 簢  ϴ  Ʋ󽺸 մϴ.  ó ̹ ߰  մϴ. */
+	TextureAtlas(int32_t pageSize, const ITexture::EFilter& filter, int32_t padding = DEFAULT_PADDING);
+	virtual ~TextureAtlas();
+
+	DISALLOW_COPY_AND_ASSIGN(TextureAtlas);
+
+	virtual void Release() override;
+
+	/**
+	 * ̹  Ʋ󽺿 ġϰ εմϴ. ߰ ̹  ȯմϴ.
+	 * ̹  ̸ ̹ ְų,   ũⰡ  Ŀ ġ   ̹ ߰ ʽϴ.
+	 */
+	uint32_t Add(const std::vector<TextureAtlasImage>& images);
+
+	/** ̹ ϳ Ʋ󽺿 ġϰ εմϴ. ߰ ϸ false ȯմϴ. */
+	bool Add(const TextureAtlasImage& image);
+
+	/** ̹  ڵؼ Ʋ󽺿 ߰մϴ.   ϰų ߰ ϸ false ȯմϴ. */
+	bool AddFromFile(const NameID& name, const std::string& path);
+
+	/** ̸ ϴ ̹  ϴ. ٸ nullptr ȯմϴ. */
+	const TextureAtlasRegion* Find(const NameID& name) const { return regions_.Find(name); }
+
+	/**  ؽó ֿ εմϴ. */
+	void Active(uint32_t unit, uint32_t page) const;
+
+	/**    ũ  ,  ؽó ID ϴ. */
+	int32_t GetPageSize() const { return pageSize_; }
+	uint32_t GetPageCount() const { return static_cast<uint32_t>(pages_.size()); }
+	uint32_t GetPageTextureID(uint32_t page) const;
+
+	/** Ʋ󽺿 ߰ ̹  ϴ. */
+	uint32_t GetImageCount() const { return regions_.GetSize(); }
+
+	/**     ̹( ) ϴ  ϴ. */
+	float GetOccupancy() const;
+
+private:
+	/**  ϳ ؽó Ŀ Դϴ. stb_rect_pack Ÿ   ʵ ҽ Ͽ մϴ. */
+	struct AtlasPage;
+
+	/**   մϴ. */
+	AtlasPage& CreatePage();
+
+	/** ġ ̹  Բ RGBA8 ȯؼ  εϰ,  մϴ. */
+	void UploadImage(const TextureAtlasImage& image, uint32_t page, int32_t x, int32_t y);
+
+private:
+	int32_t pageSize_ = 0;
+	ITexture::EFilter filter_ = ITexture::EFilter::LINEAR;
+	int32_t padding_ = 0;
+
+	std::vector<std::unique_ptr<AtlasPage>> pages_;
+	FlatHashMap<NameID, TextureAtlasRegion> regions_;
+
+	/** ġ ̹  ؼ ϴ  Դϴ. */
+	uint64_t packedArea_ = 0;
+
+	/**   ̹ RGBA8 ȯ  ϴ ӽ Դϴ. */
+	std::vector<uint8_t> uploadBuffer_;
+};
\ No newline at end of file
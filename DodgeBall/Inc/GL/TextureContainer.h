@@ -0,0 +1,87 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "Utils/Macro.h"
+
+/** ŷ ؽó   Դϴ.   4x4 ؼ   մϴ. */
+enum class ECompressedFormat : uint32_t
+{
+	BC1 = 1, /** RGB, ϴ 8Ʈ(4bpp). İ   ؽó մϴ. */
+	BC3 = 2, /** RGBA, ϴ 16Ʈ(8bpp). BC1  BC4  ĸ մϴ. */
+	BC4 = 3, /** R, ϴ 8Ʈ(4bpp).  , ũ   ä ؽó մϴ. */
+	BC5 = 4, /** RG, ϴ 16Ʈ(8bpp).  ä  BC4  մϴ.   XY մϴ. */
+};
+
+/** ̳ʿ    ϳԴϴ. */
+struct TextureContainerLevel
+{
+	int32_t width = 0;
+	int32_t height = 0;
+	std::vector<uint8_t> data;
+};
+
+/**
+ * ؽó Ŀ ϴ ŷ ؽó (.dbtex)Դϴ.
+ *  ü ü   · ϹǷ,  ð ̹ ڵϰų Ӹ  ʰ   ״ εմϴ(glCompressedTextureSubImage2D).
+ *  ,   Ʈ ũ 迭,   (0 )  ˴ϴ.
+ * ex)
+ * TextureContainer container;
+ * if (container.Load("Resource/Texture/Ball.dbtex"))
+ * {
+ *     for (int32_t level = 0; level < container.GetMipLevelCount(); ++level) { ... container.GetLevel(level) ... }
+ * }
+ */
+class TextureContainer
+{
+public:
+	/** ŷ ؽó  ȮԴϴ. */
+	static const char* FILE_EXTENSION;
+
+public:
+	TextureContainer() = default;
+	virtual ~TextureContainer() {}
+
+	DISALLOW_COPY_AND_ASSIGN(TextureContainer);
+
+	/** Ͽ ŷ ؽó нϴ.  ų    false ȯմϴ. */
+	bool Load(const std::string& path);
+
+	/** ŷ ؽó Ͽ մϴ. Ͽ ϸ Ϻθ ϵ  ϰ false ȯմϴ. */
+	bool Save(const std::string& path) const;
+
+	/**     , 0  ũ   մϴ. */
+	void Reset(const ECompressedFormat& format, int32_t width, int32_t height);
+
+	/**    ߰մϴ.  ũ  ũ  Ŀ ¾ƾ մϴ. */
+	void AddLevel(int32_t width, int32_t height, std::vector<uint8_t>&& data);
+
+	/**  İ 0  ũ⸦ ϴ. */
+	ECompressedFormat GetFormat() const { return format_; }
+	int32_t GetWidth() const { return width_; }
+	int32_t GetHeight() const { return height_; }
+
+	/**      ϴ. */
+	int32_t GetMipLevelCount() const { return static_cast<int32_t>(levels_.size()); }
+	const TextureContainerLevel& GetLevel(int32_t level) const { return levels_[level]; }
+
+	/**     Ʈ ũ⸦ ϴ. */
+	uint64_t GetDataByteSize() const;
+
+	/**   4x4  ϳ Ʈ ũ⸦ ϴ. */
+	static uint32_t GetBlockByteSize(const ECompressedFormat& format);
+
+	/**    ä  ϴ. */
+	static int32_t GetChannelCount(const ECompressedFormat& format);
+
+	/** / ũ ̹   Ʈ ũ⸦ ϴ. 4  ƴ ũ   øմϴ. */
+	static uint32_t GetLevelByteSize(const ECompressedFormat& format, int32_t width, int32_t height);
+
+private:
+	ECompressedFormat format_ = ECompressedFormat::BC1;
+	int32_t width_ = 0;
+	int32_t height_ = 0;
+	std::vector<TextureContainerLevel> levels_;
+};
\ No newline at end of file
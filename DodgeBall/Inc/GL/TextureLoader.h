@@ -0,0 +1,217 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "GL/GLResourceTable.h"
+#include "GL/ITexture.h"
+#include "GL/PersistentBufferRing.h"
+#include "GL/TextureContainer.h"
+
+#include "Utils/Macro.h"
+
+class Texture2D;
+
+/** ؽó δ ¿   ε Դϴ. */
+struct TextureLoaderStatistics
+{
+	/** ڵ ٸų ڵ  û(ؽó ε   ) Դϴ. */
+	uint32_t pendingDecodeCount = 0;
+
+	/** ڵ  ε带 ٸų ε  û(ؽó ε   ) Դϴ. */
+	uint32_t pendingUploadCount = 0;
+
+	/** ε尡   ؽó εǴ ؽó  Դϴ. */
+	uint32_t residentCount = 0;
+
+	/** ڵ ؼ ڸ ǥ ؽó  ؽó  Դϴ. */
+	uint32_t failedCount = 0;
+
+	/**  ӿ ȼ  ۷ ε Ʈ  ε忡  CPU ðԴϴ. */
+	uint64_t uploadByteCount = 0;
+	double uploadMilliseconds = 0.0;
+};
+
+/**
+ * ̹  ׶ 忡 ڵϰ,  忡 Ӵ 길ŭ  εϴ 񵿱 ؽó δԴϴ.
+ * ڵ(stb_image)   ؼ  ɸǷ  Ŵ ƴ δ  忡 մϴ.  Ŵ ϸ  尡 Wait ߿ ڵ ۾     ֽϴ.
+ * ε  ε ȼ  (PBO)  ġǷ,     縸 ϰ ̹ ؽó մϴ.
+ * ε尡   ؽó 1x1 ڸ ǥ ؽó εǹǷ, ε ߿ ؽó ״   ֽϴ. ڵ  ؽó  ڸ ǥ ؽó ϴ.
+ * ε尡  ؽó ؽó  ڿ ϹǷ, GPU ޸       ֽϴ.
+ * ؽó  ڰ     ûϸ, ڵ 尡   ٽ о       ȿ    εմϴ.
+ * ̶,  δ Ŭ ̱̰, GL Ŵ ʱȭ ڿ ʱȭؾ մϴ.
+ * ex)
+ * Texture2D* texture = TextureLoader::GetRef().LoadAsync("Resource/Texture/Ball.png", ITexture::EFilter::LINEAR);
+ * ...
+ * GLManager::GetRef().BeginFrame(...);
+ * TextureLoader::GetRef().Tick(); //  
+ * texture->Active(0);             // ε尡   ڸ ǥ ؽó ε.
+ */
+class TextureLoader
+{
+public:
+	/** Ӵ ε  ⺻ Դϴ. Ʈ  ȼ      ũ̱⵵ մϴ. */
+	static const uint32_t DEFAULT_UPLOAD_BYTES_PER_FRAME = 8 * 1024 * 1024;
+	static const double DEFAULT_UPLOAD_MILLISECONDS_PER_FRAME;
+
+	/** ̹ ڵϴ δ   Դϴ. */
+	static const uint32_t DECODE_THREAD_COUNT = 2;
+
+public:
+	DISALLOW_COPY_AND_ASSIGN(TextureLoader);
+
+	/** ؽó δ ̱ ü ڸ ϴ. */
+	static TextureLoader& GetRef();
+
+	/** ؽó δ ̱ ü ͸ ϴ. */
+	static TextureLoader* GetPtr();
+
+	/** ؽó δ ʱȭմϴ. Ӵ ε  Ʈ  CPU ð(и) ϰ,   ϳ    ӿ εմϴ. */
+	void Startup(uint32_t uploadBytesPerFrame = DEFAULT_UPLOAD_BYTES_PER_FRAME, double uploadMillisecondsPerFrame = DEFAULT_UPLOAD_MILLISECONDS_PER_FRAME);
+
+	/** ؽó δ ʱȭ մϴ. ڵ  ̹ ڵ     ϴ. */
+	void Shutdown();
+
+	/**
+	 * ̹  ڵ ûϰ,    ؽó մϴ. ȯ ؽó GL Ŵ մϴ.
+	 * ε尡   ؽó ıϸ, δ  ε带 մϴ.
+	 * ̶, ŷ ؽó(.dbtex) ڵ ʿ Ƿ Texture2D ڷ ؾ մϴ.
+	 */
+	Texture2D* LoadAsync(const std::string& path, const ITexture::EFilter& filter);
+
+	/**
+	 * ؽó    [residentMipLevel,    )  ûմϴ. ؽó  ڰ մϴ.
+	 * ڵ 尡   ٽ о    ( ̹ CPU ),  尡  ȿ    εմϴ.
+	 * ε尡   ؽó    εǸ,    üϰ  ؽó  ڿ ˸ϴ(TextureResidencyManager::OnMipLevelsStreamed).
+	 */
+	void StreamAsync(Texture2D* texture, int32_t residentMipLevel);
+
+	/**
+	 * ڵ  ̹  ȿ εմϴ.  忡 GLManager::BeginFrame    ȣؾ մϴ.
+	 * ȼ       Ʈ ̹Ƿ,  ӿ ٽ ȣϸ ƹ͵ ε ʽϴ.
+	 */
+	void Tick();
+
+	/** û  ؽó ε尡  Ȯմϴ. */
+	bool IsIdle() const;
+
+	/** ε尡   ؽó  εϴ ڸ ǥ ؽó ID ϴ. */
+	uint32_t GetPlaceholderTextureID() const { return placeholderTextureID_; }
+
+	/** ؽó δ ¿   ε 踦 ϴ. */
+	TextureLoaderStatistics GetStatistics() const;
+
+private:
+	/** ε û ϳ Դϴ. ڵ 尡 ȼ ä,  尡   εմϴ. */
+	struct TextureLoadRequest
+	{
+		GLHandle<Texture2D> texture;
+		std::string path;
+
+		/** ڵ Դϴ. ȼ stb_image Ҵ ޸̸, ε尡  մϴ. */
+		uint8_t* pixels = nullptr;
+		int32_t width = 0;
+		int32_t height = 0;
+		int32_t channels = 0;
+
+		/**  ε Դϴ.  ؽó   4x4      ϴ. */
+		int32_t nextRow = 0;
+
+		/**    û ο,   ŷ ؽó Դϴ. */
+		bool bIsStreamRequest = false;
+		bool bIsCompressed = false;
+
+		/**    [beginMipLevel, endMipLevel)Դϴ. endMipLevel û  ϴ  ū  Դϴ. */
+		int32_t beginMipLevel = 0;
+		int32_t endMipLevel = 0;
+
+		/** ڵ 尡    Դϴ. ŷ ؽó  İ ü    Բ ؼ ε  ؽó մϴ. */
+		std::vector<TextureContainerLevel> levels;
+		ECompressedFormat format = ECompressedFormat::BC1;
+		int32_t mipLevelCount = 0;
+
+		/**  ε  (levels ε)    εϴ   Դϴ.    ù ε  մϴ. */
+		int32_t nextLevel = 0;
+		uint32_t streamTextureID = 0;
+	};
+
+private:
+	/**
+	 * ؽó δ ⺻ ڿ   ҸԴϴ.
+	 * ̱ ϱ  private ϴ.
+	 */
+	TextureLoader() = default;
+	virtual ~TextureLoader() {}
+
+	/** ڵ   Դϴ. */
+	void RunDecodeThread();
+
+	/**    û   ٽ о    ϴ. ڵ 忡 ȣմϴ. */
+	void DecodeMipLevels(TextureLoadRequest& request) const;
+
+	/** ڵ  ε  ִ Ȯմϴ. ε  ٸ  ϰ false ȯմϴ. */
+	bool IsUploadable(const TextureLoadRequest& request, const Texture2D* texture) const;
+
+	/**
+	 * ε û     ȿ  ŭ    εմϴ.   εߴٸ true ȯմϴ.
+	 * ε Ʈ ŭ   ̰,  ð   (ƽ) Ѿ Ȯմϴ.
+	 */
+	bool Upload(TextureLoadRequest& request, Texture2D* texture, uint32_t& remainByteCount, uint64_t deadlineTicks);
+
+	/**    û     ȿ εմϴ.    εߴٸ   üϰ true ȯմϴ. */
+	bool UploadMipLevels(TextureLoadRequest& request, Texture2D* texture, uint32_t& remainByteCount, uint64_t deadlineTicks);
+
+	/**
+	 *   ̹  [nextRow, )  ȿ  ŭ    ȼ  ۸      εմϴ.
+	 * ε ŭ nextRow ű,   εߴٸ true ȯմϴ.
+	 */
+	bool UploadRows(const Texture2D* texture, uint32_t textureID, int32_t level, const uint8_t* data, int32_t width, int32_t height, int32_t& nextRow, uint32_t& remainByteCount, uint64_t deadlineTicks);
+
+	/** û ϴ ޸𸮿    մϴ. */
+	void ReleaseRequest(TextureLoadRequest& request);
+
+private:
+	/** ؽó δ ̱ üԴϴ. */
+	static TextureLoader singleton_;
+
+	/** OpenGL ؽƮ ؼ ؽó ε  ִ Դϴ. */
+	bool bIsEnabled_ = false;
+
+	/** Ӵ ε Դϴ. */
+	uint32_t uploadBytesPerFrame_ = 0;
+	double uploadMillisecondsPerFrame_ = 0.0;
+
+	/** ڸ ǥ ؽóԴϴ. */
+	uint32_t placeholderTextureID_ = 0;
+
+	/** ε忡 ϴ ȼ  ۿ   Դϴ. */
+	uint32_t pixelUnpackBufferID_ = 0;
+	PersistentBufferRing pixelUnpackRing_;
+
+	/** ڵ  ڵ /Ϸ ťԴϴ. */
+	std::vector<std::thread> decodeThreads_;
+	mutable std::mutex queueMutex_;
+	std::condition_variable decodeCondition_;
+	std::deque<std::unique_ptr<TextureLoadRequest>> decodeQueue_;
+	std::vector<std::unique_ptr<TextureLoadRequest>> decodedRequests_;
+	uint32_t decodingCount_ = 0;
+	bool bIsQuit_ = false;
+
+	/**  尡 ε  ûԴϴ. տ  εմϴ. */
+	std::deque<std::unique_ptr<TextureLoadRequest>> uploadQueue_;
+
+	/**  ε带   εԴϴ. */
+	uint64_t tickFrameIndex_ = UINT64_MAX;
+
+	/**  ε Ϸ ,      ε Դϴ. */
+	uint32_t residentCount_ = 0;
+	uint32_t failedCount_ = 0;
+	uint64_t uploadByteCount_ = 0;
+	double uploadMilliseconds_ = 0.0;
+};
\ No newline at end of file
@@ -0,0 +1,206 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "GL/GLResourceTable.h"
+
+#include "Utils/FlatHashMap.h"
+#include "Utils/Macro.h"
+
+class Texture2D;
+
+/** ؽó   ¿   Ʈ Դϴ. */
+struct TextureResidencyStatistics
+{
+	/**   ؽó Դϴ. */
+	uint32_t textureCount = 0;
+
+	/** GPU ޸    ؽó  ϴ GPU ޸ ġ(Ʈ)Դϴ. */
+	uint64_t budgetByteSize = 0;
+	uint64_t residentByteSize = 0;
+
+	/**   ؽó      ʿ GPU ޸ ġ(Ʈ)Դϴ. */
+	uint64_t fullByteSize = 0;
+
+	/**   ؽó    ϴ GPU ޸ ġ(Ʈ)Դϴ.       Բ մϴ. */
+	uint64_t reservedByteSize = 0;
+
+	/**  ӿ   üϸ鼭 ÿ  GPU ޸ ִ ġ(Ʈ)Դϴ. */
+	uint64_t peakByteSize = 0;
+
+	/** ؽó δ    ûϰ    ؽó Դϴ. */
+	uint32_t pendingStreamCount = 0;
+
+	/**  ӿ      ģ   Դϴ. */
+	uint32_t evictedLevelCount = 0;
+	uint32_t streamedLevelCount = 0;
+
+	/** ݱ          Դϴ. */
+	uint64_t totalEvictedLevelCount = 0;
+	uint64_t totalStreamedLevelCount = 0;
+
+	/**   ٽ  ؼ     ؽó  Դϴ. */
+	uint32_t streamFailedCount = 0;
+};
+
+/**
+ * ؽó ϴ GPU ޸𸮸   ϴ ؽó  Դϴ.
+ *  ڵ尡 ؽó ׸  ȭ鿡 ϴ ũ(ȼ) ˷ָ,  ũ⿡ ʿ  ū   մϴ.
+ *         ؽó ū   ,   ֱٿ  ؽó ʿ    Ͽ մϴ.
+ *  GPU   ,  ؽó δ ûؼ ڵ 尡   ٽ   ε  ȿ εմϴ.
+ *    ؽó    ׷    , Ӵ  ûϴ ؽó  մϴ.
+ *  ߿       Բ ϹǷ,    ũ ü    꿡 մϴ.
+ *   (MIN_RESIDENT_SIZE )  Ƿ, ؽó  ص    ʽϴ.
+ * ̶,   Ŭ ̱̰, GL Ŵ ؽó δ ʱȭ ڿ ʱȭؾ մϴ.
+ * ex)
+ * TextureResidencyManager::GetRef().Startup(256 * 1024 * 1024);
+ * ...
+ * GLManager::GetRef().BeginFrame(...);
+ * TextureLoader::GetRef().Tick();
+ * TextureResidencyManager::GetRef().Tick(); //  ,        .
+ * ...
+ * TextureResidencyManager::GetRef().NotifyUsage(texture, screenPixelSize);
+ * texture->Active(0);
+ */
+class TextureResidencyManager
+{
+public:
+	/** GPU ޸  ⺻ Դϴ. */
+	static const uint64_t DEFAULT_BUDGET_BYTE_SIZE = 256ull * 1024ull * 1024ull;
+
+	/** Ӵ    ûϴ ؽó  ⺻ Դϴ. */
+	static const uint32_t DEFAULT_STREAM_TEXTURES_PER_FRAME = 2;
+
+	/**  ʰ ׻ ϴ   ִ ũ(  ؼ )Դϴ. */
+	static const int32_t MIN_RESIDENT_SIZE = 64;
+
+public:
+	DISALLOW_COPY_AND_ASSIGN(TextureResidencyManager);
+
+	/** ؽó   ̱ ü ڸ ϴ. */
+	static TextureResidencyManager& GetRef();
+
+	/** ؽó   ̱ ü ͸ ϴ. */
+	static TextureResidencyManager* GetPtr();
+
+	/** ؽó  ڸ ʱȭմϴ. */
+	void Startup(uint64_t budgetByteSize = DEFAULT_BUDGET_BYTE_SIZE, uint32_t streamTexturesPerFrame = DEFAULT_STREAM_TEXTURES_PER_FRAME);
+
+	/** ؽó   ʱȭ մϴ. ؽó GL Ŵ ϹǷ ı ʽϴ. */
+	void Shutdown();
+
+	/** GPU ޸  մϴ. پ   Tick    ϴ. */
+	void SetBudget(uint64_t budgetByteSize);
+
+	/** ؽó   մϴ.  ؽó           ϴ. */
+	void Register(Texture2D* texture);
+
+	/**
+	 * ̹ ӿ ؽó  ˸ϴ. ϵ  ؽó մϴ.
+	 * ȭ ũ ؽó ȭ鿡 ϴ   ȼ ̸,  ӿ   ϸ  ū ũ⸦  ʿ   մϴ.
+	 */
+	void NotifyUsage(Texture2D* texture, float screenPixelSize);
+
+	/**
+	 *  ϰ 꿡  ؽó    մϴ.  忡 GLManager::BeginFrame    ȣؾ մϴ.
+	 * ı ؽó  󿡼 ϰ, ε尡   ؽó ǳʶݴϴ.
+	 */
+	void Tick();
+
+	/** ؽó δ    ưų  ˸ϴ. ؽó δ  忡 ȣմϴ. */
+	void OnMipLevelsStreamed(Texture2D* texture, int32_t previousMipLevel, bool bIsStreamed);
+
+	/** ؽó   ¿   Ʈ 踦 ϴ. */
+	TextureResidencyStatistics GetStatistics() const;
+
+private:
+	/**   ؽó ϳ  Դϴ. */
+	struct TextureResidency
+	{
+		GLHandle<Texture2D> texture;
+
+		/**  ̶ ߴ ο    εԴϴ. */
+		bool bIsUsed = false;
+		uint64_t lastUsedFrameIndex = 0;
+
+		/**   ӿ ʿߴ  ū  Դϴ. */
+		int32_t requestedMipLevel = 0;
+
+		/**  Ͽ    ߴ Դϴ.   ؽó ٽ  ʰ    մϴ. */
+		bool bIsStreamFailed = false;
+
+		/** ؽó δ    ûϰ   ʾҴ ο,     ū  Դϴ. */
+		bool bIsStreamPending = false;
+		int32_t pendingMipLevel = 0;
+	};
+
+private:
+	/**
+	 * ؽó   ⺻ ڿ   ҸԴϴ.
+	 * ̱ ϱ  private ϴ.
+	 */
+	TextureResidencyManager() = default;
+	virtual ~TextureResidencyManager() {}
+
+	/** ؽó   ϴ. ϵ  ؽó մϴ. */
+	TextureResidency& FindOrAddResidency(Texture2D* texture);
+
+	/** ı ؽó  󿡼 մϴ. */
+	void RemoveDestroyedTextures();
+
+	/** ֱ ӿ  ؽó Ȯմϴ. */
+	bool IsRecentlyUsed(const TextureResidency& residency) const;
+
+	/**
+	 *     ؽó ū   ,  ޸𸮸 ǥ ũ Ϸ Դϴ. ǥ ũ⿡ ߴٸ true ȯմϴ.
+	 * ֱٿ  ؽó bIsUsedTextureEvictable true  ʿ   , false ȭ ũ⿡  ū   ϴ.
+	 */
+	bool EvictMipLevels(uint64_t targetByteSize, bool bIsUsedTextureEvictable);
+
+	/** ؽó   ִ  ū   ϴ.      ׻ մϴ. */
+	static int32_t GetMaxResidentMipLevel(const Texture2D* texture);
+
+private:
+	/** ؽó   ̱ üԴϴ. */
+	static TextureResidencyManager singleton_;
+
+	/** OpenGL ؽƮ ؼ ؽó     ִ Դϴ. */
+	bool bIsEnabled_ = false;
+
+	/** GPU ޸  Ӵ  ûϴ ؽó Դϴ. */
+	uint64_t budgetByteSize_ = 0;
+	uint32_t streamTexturesPerFrame_ = 0;
+
+	/**   ؽó  ϰ ڵ    ε ã ؽ Դϴ. */
+	std::vector<TextureResidency> residencies_;
+	FlatHashMap<uint32_t, uint32_t> residencyIndices_;
+
+	/**      ε    εԴϴ. Ӹ մϴ. */
+	std::vector<uint32_t> evictionOrder_;
+	std::vector<uint32_t> streamOrder_;
+
+	/**   ؽó  ϴ GPU ޸ ġԴϴ. Tick մϴ. */
+	uint64_t residentByteSize_ = 0;
+	uint64_t fullByteSize_ = 0;
+
+	/**    ٸ ؽó      GPU ޸ ġԴϴ. Tick մϴ. */
+	uint32_t pendingStreamCount_ = 0;
+	uint64_t reservedByteSize_ = 0;
+
+	/** ̹ ӿ   üϸ鼭 ÿ  GPU ޸ ִ ġԴϴ. */
+	uint64_t peakByteSize_ = 0;
+
+	/**       εԴϴ. */
+	uint64_t tickFrameIndex_ = UINT64_MAX;
+
+	/**  Tick  ؽó δ  ģ   Դϴ.  Tick    űϴ. */
+	uint32_t completedStreamLevelCount_ = 0;
+
+	/**  Ӱ  Ʈ Դϴ. */
+	uint32_t evictedLevelCount_ = 0;
+	uint32_t streamedLevelCount_ = 0;
+	uint64_t totalEvictedLevelCount_ = 0;
+	uint64_t totalStreamedLevelCount_ = 0;
+	uint32_t streamFailedCount_ = 0;
+};
\ No newline at end of file
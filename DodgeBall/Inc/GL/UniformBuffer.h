@@ -3,6 +3,7 @@
 #include <cstdint>
 
 #include "GL/GLResource.h"
+#include "GL/PersistentBufferRing.h"
 
 /**  ο ε   Դϴ. */
 class UniformBuffer : public GLResource
@@ -15,6 +16,12 @@ public:
 		STREAM = 0x88E0,
 		STATIC = 0x88E4,
 		DYNAMIC = 0x88E8,
+
+		/**
+		 * glBufferStorage ϰ    Դϴ. OpenGL    ƴմϴ.
+		 * ۴ byteSize ũ   GLManager::MAX_FRAMES_IN_FLIGHT , ʹ Allocate Ҵ ޸𸮿  մϴ.
+		 */
+		PERSISTENT = 0x0001,
 	};
 
 public:
@@ -39,11 +46,29 @@ public:
 	 */
 	void BindSlot(const uint32_t slot);
 
-	/**   ͸ մϴ. */
+	/**
+	 *   Ϻ  ̴   Կ εմϴ. Allocate Ҵ  ε  մϴ.
+	 * https://registry.khronos.org/OpenGL-Refpages/gl4/html/glBindBufferRange.xhtml
+	 */
+	void BindSlot(const uint32_t slot, uint32_t offset, uint32_t byteSize);
+
+	/**   ͸ մϴ. ̶, PERSISTENT   ۴ Allocate ؾ մϴ. */
 	void SetBufferData(const void* bufferPtr, uint32_t bufferSize);
 
+	/**
+	 * PERSISTENT   ۿ    ޸𸮸 Ҵմϴ.
+	 *  ü  ͸ ϳ ο ϰ, ȯ   ش  մϴ.
+	 */
+	BufferAllocation Allocate(uint32_t byteSize);
+
+	/**   OpenGL Ʈ ID ϴ. */
+	uint32_t GetUniformBufferID() const { return uniformBufferID_; }
+
 private:
 	uint32_t uniformBufferID_ = 0;
 	uint32_t byteSize_ = 0;
 	EUsage usage_ = EUsage::NONE;
+
+	/** PERSISTENT      Դϴ. */
+	PersistentBufferRing persistentBufferRing_;
 };
\ No newline at end of file
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+#include "GL/GLResource.h"
+#include "GL/VertexLayout.h"
+
+class IndexBuffer;
+class VertexBuffer;
+
+/**
+ * ؽ  Ӽ ġ ε  ε ϴ ؽ 迭(VAO) ҽԴϴ.
+ * ޽ (ؽ) νϽ (νϽ)ó  ؽ ۸  ٸ ε ε ̾ƿ   ֽϴ.
+ *   DSA(glVertexArrayVertexBuffer, glVertexArrayAttribFormat ) ϹǷ,  ߿ ؽ 迭̳  ε ٲ ʽϴ.
+ * Ӽ  ε ε ̾ƿ ID ٲ  ٽ ϹǷ,  ̾ƿ ٸ ؽ ۷ üϸ  Ḹ մϴ.
+ * ̾ƿ ٲ  ̾ƿ  Ӽ ġ Ȱȭմϴ.
+ * ޽ø ٲ  ޽ø  ؽ 迭 εϱ⸸ ϸ ǰ, Ӽ ٽ  ʽϴ.
+ * ex)
+ * VertexArray* vertexArray = GLManager::GetRef().Create<VertexArray>();
+ * vertexArray->SetVertexBuffer(0, meshVertexBuffer, meshLayout);
+ * vertexArray->SetVertexBuffer(1, instanceVertexBuffer, instanceLayout);
+ * vertexArray->SetIndexBuffer(indexBuffer);
+ */
+class VertexArray : public GLResource
+{
+public:
+	/** ؽ 迭   ִ ؽ  ε ε Դϴ. OpenGL ϴ ּڰ(16) ۰ մϴ. */
+	static const uint32_t MAX_VERTEX_BUFFER_BINDINGS = 4;
+
+public:
+	VertexArray();
+	virtual ~VertexArray();
+
+	DISALLOW_COPY_AND_ASSIGN(VertexArray);
+
+	virtual void Release() override;
+
+	/**
+	 * ؽ ۸ ε ε ϰ, ̾ƿ Ӽ  ε ε ͸ е մϴ.
+	 *  ؽ ۿ ù ° ؽ ϴ Ʈ ġԴϴ.
+	 */
+	void SetVertexBuffer(uint32_t bindingIndex, VertexBuffer* vertexBuffer, const VertexLayout& layout, uint32_t offset = 0);
+
+	/** ε ۸ ؽ 迭 մϴ. */
+	void SetIndexBuffer(IndexBuffer* indexBuffer);
+
+	/** ؽ 迭 ο εմϴ. */
+	void Bind();
+
+	/** ε ؽ 迭 ε մϴ. */
+	void Unbind();
+
+	/** ؽ 迭 OpenGL Ʈ ID ϴ. */
+	uint32_t GetVertexArrayID() const { return vertexArrayID_; }
+
+	/**  ε ۸ ϴ. */
+	IndexBuffer* GetIndexBuffer() const { return indexBuffer_; }
+
+	/** ε ε  ̾ƿ ID ϴ.  ʾҴٸ 0Դϴ. */
+	uint32_t GetLayoutID(uint32_t bindingIndex) const { return layoutIDs_[bindingIndex]; }
+
+private:
+	/** ٸ ε ε ̾ƿ Ӽ ġ ϴ Ȯմϴ. */
+	bool IsLocationUsedByOtherBinding(uint32_t bindingIndex, uint32_t location) const;
+
+private:
+	uint32_t vertexArrayID_ = 0;
+	IndexBuffer* indexBuffer_ = nullptr;
+
+	/** ε ε Ӽ   ̾ƿ IDԴϴ. */
+	std::array<uint32_t, MAX_VERTEX_BUFFER_BINDINGS> layoutIDs_ = {};
+};
\ No newline at end of file
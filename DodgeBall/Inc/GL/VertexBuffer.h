@@ -3,6 +3,7 @@
 #include <cstdint>
 
 #include "GL/GLResource.h"
+#include "GL/PersistentBufferRing.h"
 
 /**  ο ε  ؽ Դϴ. */
 class VertexBuffer : public GLResource
@@ -15,6 +16,12 @@ public:
 		STREAM  = 0x88E0,
 		STATIC  = 0x88E4,
 		DYNAMIC = 0x88E8,
+
+		/**
+		 * glBufferStorage ϰ    Դϴ. OpenGL    ƴմϴ.
+		 * ۴ byteSize ũ   GLManager::MAX_FRAMES_IN_FLIGHT , ʹ Allocate Ҵ ޸𸮿  մϴ.
+		 */
+		PERSISTENT = 0x0001,
 	};
 
 public:
@@ -33,11 +40,26 @@ public:
 	/** ε ؽ ۸ ε մϴ. */
 	void Unbind();
 
-	/** ؽ  ͸ մϴ. */
+	/** ؽ  ͸ մϴ. ̶, PERSISTENT   ۴ Allocate ؾ մϴ. */
 	void SetBufferData(const void* bufferPtr, uint32_t bufferSize);
 
+	/** ؽ  [offset, offset + bufferSize)  ͸ մϴ. ū ۸  ޽ð    մϴ. */
+	void SetBufferSubData(const void* bufferPtr, uint32_t offset, uint32_t bufferSize);
+
+	/**
+	 * PERSISTENT   ۿ    ޸𸮸 Ҵմϴ.
+	 *  ü  ͸ ϳ ο ϰ, ȯ   ش  մϴ.
+	 */
+	BufferAllocation Allocate(uint32_t byteSize);
+
+	/** ؽ  OpenGL Ʈ ID ϴ. */
+	uint32_t GetVertexBufferID() const { return vertexBufferID_; }
+
 private:
 	uint32_t vertexBufferID_ = 0;
 	uint32_t byteSize_ = 0;
 	EUsage usage_ = EUsage::NONE;
+
+	/** PERSISTENT      Դϴ. */
+	PersistentBufferRing persistentBufferRing_;
 };
\ No newline at end of file
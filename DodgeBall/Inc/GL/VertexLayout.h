@@ -0,0 +1,69 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/** ؽ Ӽ ϳ Դϴ. */
+struct VertexAttribute
+{
+	/** ؽ Ӽ  ŸԴϴ. https://registry.khronos.org/OpenGL-Refpages/gl4/html/glVertexAttribFormat.xhtml */
+	enum class EType
+	{
+		BYTE           = 0x1400,
+		UNSIGNED_BYTE  = 0x1401,
+		SHORT          = 0x1402,
+		UNSIGNED_SHORT = 0x1403,
+		INT            = 0x1404,
+		UNSIGNED_INT   = 0x1405,
+		FLOAT          = 0x1406,
+	};
+
+	/** ̴ Ӽ ġ(layout(location = N))Դϴ. */
+	uint32_t location = 0;
+
+	/**  (1~4) ŸԴϴ. */
+	uint32_t componentCount = 0;
+	EType type = EType::FLOAT;
+
+	/**  Ÿ Ҹ [0, 1] Ǵ [-1, 1]  Ǽ ȭ Դϴ. ȭ ʴ  Ÿ ̴  нϴ. */
+	bool bIsNormalized = false;
+
+	/** ؽ  ġκ Ʈ Դϴ. */
+	uint32_t offset = 0;
+
+	bool operator==(const VertexAttribute& attribute) const
+	{
+		return location == attribute.location
+			&& componentCount == attribute.componentCount
+			&& type == attribute.type
+			&& bIsNormalized == attribute.bIsNormalized
+			&& offset == attribute.offset;
+	}
+};
+
+/**
+ * ؽ  ϳ  ġԴϴ.
+ * (divisor) 0̸ ؽ, 1 ̸̻ νϽ    ͸ нϴ.
+ *  ġ ̾ƿ GLManager::RegisterVertexLayout ϳ ̾ƿ ID ߺ ŵ˴ϴ.
+ */
+struct VertexLayout
+{
+	uint32_t stride = 0;
+	uint32_t divisor = 0;
+	std::vector<VertexAttribute> attributes;
+
+	/** ̾ƿ    64Ʈ FNV-1a ؽ  մϴ. */
+	uint64_t GetHash() const;
+
+	bool operator==(const VertexLayout& layout) const
+	{
+		return stride == layout.stride && divisor == layout.divisor && attributes == layout.attributes;
+	}
+};
+
+/** ؽ ʿ ؽ ̾ƿ Ű ϱ  ؽ Լ üԴϴ. */
+struct VertexLayoutHasher
+{
+	std::size_t operator()(const VertexLayout& layout) const { return static_cast<std::size_t>(layout.GetHash()); }
+};
\ No newline at end of file
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "GLFW/GLFWError.h"
+#include "Utils/Macro.h"
 #include "Utils/Utils.h"
 
 #if defined(DEBUG_MODE) || defined(RELWITHDEBINFO_MODE)
@@ -17,7 +18,7 @@
 	{\
 		DebugPrintF("\nAssertion check point failed!\n> File: %s\n> Line: %d\n> Function: %s\n> Expression: %s\n", __FILE__, __LINE__, __FUNCTION__, #EXP);\
 		DebugPrintF("> Code: %d\n> Error: %s\n> Description: %s\n\n", GLFWError::GetErrorCode(),  GLFWError::GetErrorMessage(),  GLFWError::GetErrorDescription());\
-		__debugbreak();\
+		DEBUG_BREAK();\
 	}\
 }
 #endif
@@ -34,7 +35,7 @@
 	{\
 		DebugPrintF("\nAssertion check point failed!\n> File: %s\n> Line: %d\n> Function: %s\n> Expression: %s\n", __FILE__, __LINE__, __FUNCTION__, #EXP);\
 		DebugPrintF("> Code: %d\n> Error: %s\n> Description: %s\n\n", GLFWError::GetErrorCode(),  GLFWError::GetErrorMessage(),  GLFWError::GetErrorDescription());\
-		__debugbreak();\
+		DEBUG_BREAK();\
 	}\
 }
 #endif
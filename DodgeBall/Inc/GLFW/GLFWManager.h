@@ -4,7 +4,7 @@
 #include <functional>
 #include <string>
 
-#include <glfw/glfw3.h>
+#include <GLFW/glfw3.h>
 #include <glm/glm.hpp>
 
 #include "Utils/Macro.h"
@@ -174,6 +174,17 @@ enum class EWindowEvent
 /**  ̺Ʈ ID Դϴ. */
 using WindowEventID = uint32_t;
 
+/**
+ * GLFW Ŵ  Դϴ.
+ * HEADLESS SIMULATION ÷̳ GPU  ȯ(CI,   ) մϴ.
+ */
+enum class ERunMode
+{
+	WINDOWED   = 0x00, /** ȭ鿡 ̴  OpenGL ؽƮ մϴ. */
+	HEADLESS   = 0x01, /** ȭ鿡  ʴ  OpenGL ؽƮ մϴ. */
+	SIMULATION = 0x02, /**  ý۰ OpenGL ؽƮ  ùķ̼Ǹ մϴ. */
+};
+
 /**
  * GLFW  ó ϴ ŴԴϴ.
  * ̶,  Ŵ Ŭ ̱Դϴ.
@@ -189,8 +200,11 @@ public:
 	/** GLFW Ŵ ̱ ü ͸ ϴ. */
 	static GLFWManager* GetPtr();
 
-	/** GLFW Ŵ ʱȭ մϴ. */
-	void Startup(int32_t width, int32_t height, const char* title, bool bIsWindowCentered);
+	/**
+	 * GLFW Ŵ ʱȭ մϴ.
+	 *  ؽƮ ΰ true OpenGL  ؽƮ ûմϴ.   (GLManager::IsDebugContextRequired) Ϸ true մϴ.
+	 */
+	void Startup(int32_t width, int32_t height, const char* title, bool bIsWindowCentered, const ERunMode& runMode = ERunMode::WINDOWED, bool bIsDebugContext = false);
 
 	/** GLFW Ŵ ʱȭ  մϴ. */
 	void Shutdown();
@@ -198,6 +212,9 @@ public:
 	/**   մϴ. */
 	void Tick();
 
+	/** GLFW Ŵ  带 ϴ. */
+	const ERunMode& GetRunMode() const { return runMode_; }
+
 	/**   ũ⸦ ϴ. */
 	void GetWindowSize(float& outWidth, float& outHeight);
 
@@ -287,6 +304,9 @@ private:
 	/** 콺 ¸ Ʈմϴ. */
 	void UpdateMouseState();
 
+	/** 츦 ǥ ÷̰ ϴ Ȯմϴ. */
+	static bool IsDisplayAvailable();
+
 	/**  ̺Ʈ ׼ մϴ. */
 	void RunWindowEventAction(const EWindowEvent& windowEvent);
 
@@ -294,6 +314,9 @@ private:
 	/** GLFW Ŵ ̱ üԴϴ. */
 	static GLFWManager singleton_;
 
+	/** GLFW Ŵ  Դϴ. */
+	ERunMode runMode_ = ERunMode::WINDOWED;
+
 	/** GLFW Ŵ ϴ  Դϴ. */
 	GLFWwindow* mainWindow_ = nullptr;
 
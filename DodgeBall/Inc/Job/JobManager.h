@@ -0,0 +1,155 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "Job/WorkStealingDeque.h"
+
+#include "Utils/Macro.h"
+#include "Utils/ObjectPool.h"
+
+class JobCounter;
+
+/**  Ŵ  ۾Դϴ. */
+struct Job
+{
+	std::function<void()> function;
+	JobCounter* counter = nullptr; /** ۾ ϷǸ ҽų īԴϴ. */
+};
+
+/**
+ * Ϸ  ۾   īԴϴ.
+ * ۾   ī͸ ϸ īͰ ϰ, ۾ ϷǸ մϴ.
+ * ٸ ۾  ϸ, ϴ ۾ īͰ 0  Ŀ ˴ϴ.
+ * ̶, īʹ   ۾ Ϸ  ıǾ  ˴ϴ.
+ */
+class JobCounter
+{
+public:
+	JobCounter() = default;
+	virtual ~JobCounter() {}
+
+	DISALLOW_COPY_AND_ASSIGN(JobCounter);
+
+	/**   ۾ ϷǾ Ȯմϴ. */
+	bool IsDone() const { return pendingCount_.load(std::memory_order_acquire) == 0; }
+
+private:
+	friend class JobManager;
+
+	/** Ϸ  ۾ Դϴ. */
+	std::atomic<uint32_t> pendingCount_ = { 0 };
+
+	/**  īͰ 0 Ǳ⸦ ٸ ۾ Դϴ. */
+	mutable std::mutex waitingJobsMutex_;
+	std::vector<Job*> waitingJobs_;
+};
+
+/**
+ * Ŀ  Ǯ ۾ ķ ϴ  ŴԴϴ.
+ *  Ŀ   Ŵ ʱȭ ( ) ڽŸ ۾ ġ  ,
+ * ڽ   ٸ   ۾ ļ մϴ.
+ * ̶,  Ŵ Ŭ ̱Դϴ.
+ * ex)
+ * JobCounter counter;
+ * JobManager::GetRef().Submit([&]() { UpdatePhysics(); }, &counter);
+ * JobManager::GetRef().Wait(counter);
+ */
+class JobManager
+{
+public:
+	/** 庰 ۾ ġ  ũԴϴ.    ۾  ť ߰˴ϴ. */
+	static const uint32_t DEQUE_CAPACITY = 4096;
+
+public:
+	DISALLOW_COPY_AND_ASSIGN(JobManager);
+
+	/**  Ŵ ̱ ü ڸ ϴ. */
+	static JobManager& GetRef();
+
+	/**  Ŵ ̱ ü ͸ ϴ. */
+	static JobManager* GetPtr();
+
+	/**
+	 *  Ŵ ʱȭմϴ.  Լ ȣ 尡  尡 ˴ϴ.
+	 * Ŀ   0̶ ϵ   - 1(ּ 1) Ŀ 带 մϴ.
+	 */
+	void Startup(uint32_t workerCount = 0);
+
+	/**  Ŵ ʱȭ մϴ. ̶,  ۾ Ϸ ¿ մϴ. */
+	void Shutdown();
+
+	/**
+	 * ۾ մϴ.
+	 * counter nullptr ƴ϶ ۾ Ϸ  īͰ ϰ,
+	 * dependency nullptr ƴ϶ dependency īͰ 0  Ŀ ۾ ˴ϴ.
+	 */
+	void Submit(const std::function<void()>& function, JobCounter* counter = nullptr, JobCounter* dependency = nullptr);
+
+	/** īͰ 0   մϴ. ϴ  ȣ 嵵 ٸ ۾ մϴ. */
+	void Wait(const JobCounter& counter);
+
+	/**
+	 * [0, count)  batchSize ũ   ķ ϰ,   Ϸ  մϴ.
+	 * Լ  ۰  ε ڷ ޽ϴ.
+	 */
+	void ParallelFor(uint32_t count, uint32_t batchSize, const std::function<void(uint32_t, uint32_t)>& function);
+
+	/** Ŀ   ϴ.    ʽϴ. */
+	uint32_t GetWorkerCount() const { return static_cast<uint32_t>(workers_.size()); }
+
+private:
+	/**
+	 *  Ŵ ⺻ ڿ   ҸԴϴ.
+	 * ̱ ϱ  private ϴ.
+	 */
+	JobManager() = default;
+	virtual ~JobManager() {}
+
+	/** Ŀ   Դϴ. */
+	void RunWorker(uint32_t dequeIndex);
+
+	/**   ۾   Ǵ  ť ߰մϴ. */
+	void Schedule(Job* job);
+
+	/**  ۾ ãϴ. ڽ , ٸ  ,  ť  ãϴ. */
+	Job* FindJob();
+
+	/** ۾ ϰ ī͸ ҽŵϴ. */
+	void Execute(Job* job);
+
+private:
+	/**  Ŵ ̱ üԴϴ. */
+	static JobManager singleton_;
+
+	/** Ŀ  Դϴ. */
+	std::vector<std::thread> workers_;
+
+	/** 庰 ۾ ġ Դϴ. 0   尡 մϴ. */
+	std::vector<std::unique_ptr<WorkStealingDeque<Job>>> deques_;
+
+	/**   尡 ߰ų   á  ϴ  ťԴϴ. */
+	std::mutex globalQueueMutex_;
+	std::deque<Job*> globalQueue_;
+
+	/** ۾ ü Ʈ ǮԴϴ.  忡 ۾ /ıϹǷ   Ǯ մϴ. */
+	ObjectPool<Job, true> jobPool_;
+
+	/**   ·   ۾ Դϴ. Ŀ 尡  Ǵ  մϴ. */
+	std::atomic<uint32_t> queuedJobCount_ = { 0 };
+
+	/**  Ŀ      Դϴ. */
+	std::atomic<uint32_t> sleepingWorkerCount_ = { 0 };
+	std::mutex sleepMutex_;
+	std::condition_variable sleepCondition_;
+
+	/** Ŀ   û Դϴ. */
+	std::atomic<bool> bIsQuit_ = { false };
+};
\ No newline at end of file
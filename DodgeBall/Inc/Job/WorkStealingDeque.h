@@ -0,0 +1,117 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+#include "Utils/Assertion.h"
+#include "Utils/Macro.h"
+
+/**
+ * Chase-Lev ˰   (lock-free) ۾ ġ(work-stealing) Դϴ.
+ *  常 Push/Pop Ʒ(bottom) ϰ, ٸ  Steal (top) Ҹ ϴ.
+ * ޸  "Correct and Efficient Work-Stealing for Weak Memory Models"(Le et al., 2013) ϴ.
+ * ̶,  ũ ̹Ƿ    Push false ȯմϴ.
+ */
+template <typename T>
+class WorkStealingDeque
+{
+public:
+	explicit WorkStealingDeque(uint32_t capacity)
+		: capacity_(capacity)
+		, mask_(static_cast<int64_t>(capacity) - 1)
+		, buffer_(std::make_unique<std::atomic<T*>[]>(capacity))
+	{
+		CHECK(capacity > 0 && (capacity & (capacity - 1)) == 0);
+	}
+
+	virtual ~WorkStealingDeque() {}
+
+	DISALLOW_COPY_AND_ASSIGN(WorkStealingDeque);
+
+	/** Ʒʿ Ҹ ߰մϴ.  常 ȣ  ֽϴ. */
+	bool Push(T* element)
+	{
+		int64_t bottom = bottom_.load(std::memory_order_relaxed);
+		int64_t top = top_.load(std::memory_order_acquire);
+		if (bottom - top >= static_cast<int64_t>(capacity_))
+		{
+			return false;
+		}
+
+		buffer_[bottom & mask_].store(element, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_release);
+		bottom_.store(bottom + 1, std::memory_order_relaxed);
+
+		return true;
+	}
+
+	/** Ʒʿ Ҹ ϴ.   ִٸ nullptr ȯմϴ.  常 ȣ  ֽϴ. */
+	T* Pop()
+	{
+		int64_t bottom = bottom_.load(std::memory_order_relaxed) - 1;
+		bottom_.store(bottom, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		int64_t top = top_.load(std::memory_order_relaxed);
+
+		if (top > bottom)
+		{
+			bottom_.store(bottom + 1, std::memory_order_relaxed);
+			return nullptr;
+		}
+
+		T* element = buffer_[bottom & mask_].load(std::memory_order_relaxed);
+		if (top == bottom)
+		{
+			/**  Ҵ Steal ϹǷ top    մϴ. */
+			if (!top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+			{
+				element = nullptr;
+			}
+			bottom_.store(bottom + 1, std::memory_order_relaxed);
+		}
+
+		return element;
+	}
+
+	/** ʿ Ҹ Ĩϴ.   ְų ٸ  ￡  nullptr ȯմϴ. */
+	T* Steal()
+	{
+		int64_t top = top_.load(std::memory_order_acquire);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		int64_t bottom = bottom_.load(std::memory_order_acquire);
+
+		if (top >= bottom)
+		{
+			return nullptr;
+		}
+
+		T* element = buffer_[top & mask_].load(std::memory_order_relaxed);
+		if (!top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+		{
+			return nullptr;
+		}
+
+		return element;
+	}
+
+	/**    뷫  ϴ. ٸ 尡 ÿ  ̶ Ȯ   ֽϴ. */
+	uint32_t GetApproximateSize() const
+	{
+		int64_t bottom = bottom_.load(std::memory_order_relaxed);
+		int64_t top = top_.load(std::memory_order_relaxed);
+		return (bottom > top) ? static_cast<uint32_t>(bottom - top) : 0;
+	}
+
+private:
+	/**  ũ ε ũԴϴ.  ũ 2 ŵԴϴ. */
+	uint32_t capacity_ = 0;
+	int64_t mask_ = 0;
+
+	/** Ҹ ϴ  Դϴ. */
+	std::unique_ptr<std::atomic<T*>[]> buffer_;
+
+	/**   ġ 尡  ٸ ĳ ο ϵ иմϴ. */
+	alignas(64) std::atomic<int64_t> top_ = { 0 };
+	alignas(64) std::atomic<int64_t> bottom_ = { 0 };
+};
\ No newline at end of file
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "Utils/Macro.h"
+
+class InstancedMeshRenderer;
+class MeshBatch;
+class Shader;
+class ShaderCompileBatch;
+
+/**
+ *     ȿ ƨ νϽ  Ʈ Դϴ.
+ * ùķ̼ FrameLoop   ܿ ķ ϰ,     ġ ؼ
+ * νϽ    ۿ ķ     νϽ ׸ ȣ ׸ϴ.
+ *  Ʒ  ٴ Ÿϸ  ޽, ޽ ġ Ƽ    ׸ ȣ ׸ϴ.
+ * ex)
+ * BallStressScene scene(100000, true);
+ * frameLoop.SetSimulateFunction([&](double stepSeconds) { scene.Simulate(stepSeconds); });
+ * frameLoop.SetPublishFunction([&]() { scene.Publish(); });
+ * ...
+ * GLManager::GetRef().BeginFrame(...);
+ * scene.Render(frameLoop.GetAlpha());
+ * GLManager::GetRef().EndFrame();
+ */
+class BallStressScene
+{
+public:
+	/**    θ մϴ. OpenGL ؽƮ   忡  ʾƾ մϴ. */
+	BallStressScene(uint32_t ballCount, bool bIsRenderable);
+	virtual ~BallStressScene();
+
+	DISALLOW_COPY_AND_ASSIGN(BallStressScene);
+
+	/** ùķ̼  ϳ մϴ. */
+	void Simulate(double stepSeconds);
+
+	/** ùķ̼   · մϴ. */
+	void Publish();
+
+	/**   ¸    ؼ ׸ϴ.  ̴    ƹ͵ ׸ ʽϴ. */
+	void Render(double alpha);
+
+	/**   ϴ. */
+	uint32_t GetBallCount() const { return ballCount_; }
+
+private:
+	/**  ٴ Ÿ ޽ø ؼ ޽ ġ ߰մϴ. */
+	void CreateArena();
+
+	/**  ׸ϴ. */
+	void RenderArena(const glm::mat4& viewProjection, const glm::vec3& lightDirection);
+
+private:
+	uint32_t ballCount_ = 0;
+
+	/** ùķ̼ Դϴ.   ġ   մϴ. */
+	std::vector<glm::vec3> prevPositions_;
+	std::vector<glm::vec3> currPositions_;
+	std::vector<glm::vec3> velocities_;
+
+	/**  ʴ  ӼԴϴ. */
+	std::vector<float> radii_;
+	std::vector<uint32_t> colors_;
+
+	/**   Դϴ. */
+	std::vector<glm::vec3> renderPrevPositions_;
+	std::vector<glm::vec3> renderCurrPositions_;
+
+	std::unique_ptr<InstancedMeshRenderer> renderer_;
+
+	/**   ƮԴϴ. */
+	std::unique_ptr<MeshBatch> arenaBatch_;
+	Shader* arenaShader_ = nullptr;
+
+	/**  ̴ ϴ ġԴϴ.  ̴   մϴ. */
+	std::unique_ptr<ShaderCompileBatch> shaderCompileBatch_;
+	uint64_t shaderSubmitTicks_ = 0;
+	uint64_t shaderLoadingFrameCount_ = 0;
+};
\ No newline at end of file
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "Utils/Macro.h"
+
+#include "GL/RenderQueue.h"
+
+class IndexBuffer;
+class Shader;
+class ShaderCompileBatch;
+class Texture2D;
+class UniformBuffer;
+class VertexArray;
+
+/**
+ * ؽó       Ȯϴ ؽó Ʈ Դϴ.
+ * ī޶ ѷ   ؽó  г , ī޶     ȸմϴ.
+ * ȭ  г ȭ鿡 ϴ ũ⸦ ؽó  ڿ ˸,  ť ؽó   ؼ ׸Ƿ,  ü ؽó 
+ * þ߿  г ؽó ū   , ٽ þ߿  г ؽó ʿ   մϴ.
+ * ؽó ӽ ͸   ̹  ؽó δ ҷɴϴ.
+ * ex)
+ * TextureStreamScene scene(32);
+ * ...
+ * GLManager::GetRef().BeginFrame(...);
+ * TextureLoader::GetRef().Tick();
+ * TextureResidencyManager::GetRef().Tick();
+ * scene.Render();
+ * GLManager::GetRef().EndFrame();
+ */
+class TextureStreamScene
+{
+public:
+	/** г(ؽó)  մϴ. OpenGL ؽƮ ִ  忡 ؾ մϴ. */
+	explicit TextureStreamScene(uint32_t textureCount);
+	virtual ~TextureStreamScene();
+
+	DISALLOW_COPY_AND_ASSIGN(TextureStreamScene);
+
+	/** ī޶ ȸϰ, ȭ  г ׸ϴ.  ̴    ƹ͵ ׸ ʽϴ. */
+	void Render();
+
+	/** г(ؽó)  ϴ. */
+	uint32_t GetTextureCount() const { return static_cast<uint32_t>(textures_.size()); }
+
+	/**  ӿ  ť г ׸  ߻   踦 ϴ. */
+	const RenderQueueStatistics& GetRenderQueueStatistics() const { return renderQueue_->GetStatistics(); }
+
+private:
+	/** г ؽó ߽ ġԴϴ. */
+	std::vector<Texture2D*> textures_;
+	std::vector<glm::vec3> panelCenters_;
+
+	/** г ׸ ̴ ε ۸  ؽ 迭Դϴ. г  ̴ gl_VertexID ϴ. */
+	Shader* panelShader_ = nullptr;
+	IndexBuffer* panelIndexBuffer_ = nullptr;
+	VertexArray* vertexArray_ = nullptr;
+
+	/** гκ     ۿ г  Ʈ Դϴ.  ť ׸⸶ г  εմϴ. */
+	UniformBuffer* panelUniformBuffer_ = nullptr;
+	uint32_t panelUniformStride_ = 0;
+
+	/** ȭ  г ׸  ϰ ϴ  ťԴϴ. */
+	std::unique_ptr<RenderQueue> renderQueue_;
+
+	/**  ̴ ϴ ġԴϴ.   մϴ. */
+	std::unique_ptr<ShaderCompileBatch> shaderCompileBatch_;
+
+	/** ī޶ ȸ ()Դϴ. */
+	float cameraYawDegrees_ = 0.0f;
+};
\ No newline at end of file
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "Utils/Macro.h"
 #include "Utils/Utils.h"
 
 #if defined(DEBUG_MODE) || defined(RELWITHDEBINFO_MODE)
@@ -15,7 +16,7 @@
 	if (!(bool)(EXP))\
 	{\
 		DebugPrintF("\nAssertion check point failed!\n> File: %s\n> Line: %d\n> Function: %s\n> Expression: %s\n\n", __FILE__, __LINE__, __FUNCTION__, #EXP);\
-		__debugbreak();\
+		DEBUG_BREAK();\
 	}\
 }
 #endif
@@ -33,7 +34,7 @@
 		DebugPrintF("\nAssertion check point failed!\n> File: %s\n> Line: %d\n> Function: %s\n> Expression: %s\n> Description: ", __FILE__, __LINE__, __FUNCTION__, #EXP);\
 		DebugPrintF(__VA_ARGS__);\
 		DebugPrintF("\n\n");\
-		__debugbreak();\
+		DEBUG_BREAK();\
 	}\
 }
 #endif
@@ -0,0 +1,208 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <utility>
+#include <vector>
+
+/**
+ *  Ž(linear probing)   巹 ؽ Դϴ.
+ *  Ű  ϳ ӵ 迭 ϹǷ,   std::map/std::unordered_map ȸ  ĳ ̽ ϴ.
+ *  ÿ 轺(tombstone)  ʰ ڵ Ҹ ܿ(backward shift)  մϴ.
+ * ̶, ԰    ͸ ȿȭ  ֽϴ.
+ */
+template <typename TKey, typename TValue, typename THasher = std::hash<TKey>>
+class FlatHashMap
+{
+public:
+	FlatHashMap() = default;
+	virtual ~FlatHashMap() {}
+
+	/** Ű ϴ  ϴ. Ű   nullptr ȯմϴ. */
+	TValue* Find(const TKey& key)
+	{
+		uint32_t index = FindIndex(key);
+		return (index == INVALID_INDEX) ? nullptr : &slots_[index].value;
+	}
+
+	const TValue* Find(const TKey& key) const
+	{
+		uint32_t index = FindIndex(key);
+		return (index == INVALID_INDEX) ? nullptr : &slots_[index].value;
+	}
+
+	/** Ű ϴ Ȯմϴ. */
+	bool Contains(const TKey& key) const
+	{
+		return FindIndex(key) != INVALID_INDEX;
+	}
+
+	/** Ű  մϴ. Ű ̹ Ѵٸ  ʰ false ȯմϴ. */
+	bool Insert(const TKey& key, const TValue& value)
+	{
+		if ((size_ + 1) * MAX_LOAD_DENOMINATOR > static_cast<uint32_t>(slots_.size()) * MAX_LOAD_NUMERATOR)
+		{
+			Rehash(slots_.empty() ? MIN_CAPACITY : static_cast<uint32_t>(slots_.size()) * 2);
+		}
+
+		uint32_t mask = static_cast<uint32_t>(slots_.size()) - 1;
+		for (uint32_t index = GetHomeIndex(key); ; index = (index + 1) & mask)
+		{
+			Slot& slot = slots_[index];
+			if (!slot.bIsOccupied)
+			{
+				slot.key = key;
+				slot.value = value;
+				slot.bIsOccupied = true;
+				++size_;
+				return true;
+			}
+
+			if (slot.key == key)
+			{
+				return false;
+			}
+		}
+	}
+
+	/** Ű մϴ. Ű   false ȯմϴ. */
+	bool Erase(const TKey& key)
+	{
+		uint32_t index = FindIndex(key);
+		if (index == INVALID_INDEX)
+		{
+			return false;
+		}
+
+		uint32_t mask = static_cast<uint32_t>(slots_.size()) - 1;
+		uint32_t next = (index + 1) & mask;
+		while (slots_[next].bIsOccupied)
+		{
+			uint32_t home = GetHomeIndex(slots_[next].key);
+
+			/**    ġ (index, next]  ۿ ִٸ  ڸ ܿ͵ Ž ΰ  ʽϴ. */
+			if (((next - home) & mask) >= ((next - index) & mask))
+			{
+				slots_[index] = std::move(slots_[next]);
+				index = next;
+			}
+
+			next = (next + 1) & mask;
+		}
+
+		slots_[index] = Slot();
+		--size_;
+		return true;
+	}
+
+	/**  Ҹ մϴ. Ҵ ޸𸮴 մϴ. */
+	void Clear()
+	{
+		for (auto& slot : slots_)
+		{
+			slot = Slot();
+		}
+		size_ = 0;
+	}
+
+	/**  Ҹ ȸմϴ. */
+	template <typename TFunction>
+	void ForEach(const TFunction& function) const
+	{
+		for (const auto& slot : slots_)
+		{
+			if (slot.bIsOccupied)
+			{
+				function(slot.key, slot.value);
+			}
+		}
+	}
+
+	/**   ϴ. */
+	uint32_t GetSize() const { return size_; }
+
+	/**  迭 ũ⸦ ϴ. */
+	uint32_t GetCapacity() const { return static_cast<uint32_t>(slots_.size()); }
+
+private:
+	/**  迭 ּ ũԴϴ.  迭 ũ ׻ 2 ŵԴϴ. */
+	static const uint32_t MIN_CAPACITY = 16;
+
+	/** ִ (7/8)Դϴ.      迭 ũ⸦   øϴ. */
+	static const uint32_t MAX_LOAD_NUMERATOR = 7;
+	static const uint32_t MAX_LOAD_DENOMINATOR = 8;
+
+	/** Ű ã  Ÿ εԴϴ. */
+	static const uint32_t INVALID_INDEX = 0xFFFFFFFF;
+
+	/** Ű  ϴ Դϴ. */
+	struct Slot
+	{
+		TKey key = TKey();
+		TValue value = TValue();
+		bool bIsOccupied = false;
+	};
+
+	/** Ű ؽ  ϴ  ε ϴ. ؽ   Ʈ  ϵ Ǻġ ؽ մϴ. */
+	uint32_t GetHomeIndex(const TKey& key) const
+	{
+		uint64_t hash = static_cast<uint64_t>(THasher()(key)) * 0x9E3779B97F4A7C15ULL;
+		return static_cast<uint32_t>(hash >> (64 - capacityBits_));
+	}
+
+	/** Ű   ε ϴ. Ű   INVALID_INDEX ȯմϴ. */
+	uint32_t FindIndex(const TKey& key) const
+	{
+		if (size_ == 0)
+		{
+			return INVALID_INDEX;
+		}
+
+		uint32_t mask = static_cast<uint32_t>(slots_.size()) - 1;
+		for (uint32_t index = GetHomeIndex(key); ; index = (index + 1) & mask)
+		{
+			const Slot& slot = slots_[index];
+			if (!slot.bIsOccupied)
+			{
+				return INVALID_INDEX;
+			}
+
+			if (slot.key == key)
+			{
+				return index;
+			}
+		}
+	}
+
+	/**  迭 ũ⸦ ϰ  Ҹ ٽ մϴ. */
+	void Rehash(uint32_t capacity)
+	{
+		std::vector<Slot> slots(capacity);
+		std::swap(slots_, slots);
+
+		capacityBits_ = 0;
+		while ((1u << capacityBits_) < capacity)
+		{
+			++capacityBits_;
+		}
+
+		size_ = 0;
+		for (auto& slot : slots)
+		{
+			if (slot.bIsOccupied)
+			{
+				Insert(slot.key, slot.value);
+			}
+		}
+	}
+
+private:
+	/** Ű  ϴ  迭Դϴ. */
+	std::vector<Slot> slots_;
+
+	/**  迭 ũ 2 Դϴ. */
+	uint32_t capacityBits_ = 0;
+
+	/**  Դϴ. */
+	uint32_t size_ = 0;
+};
\ No newline at end of file
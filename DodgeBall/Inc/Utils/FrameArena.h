@@ -0,0 +1,158 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "Utils/Macro.h"
+
+/**
+ * ū ޸ Ͽ Ŀ  ̵Ű ޸𸮸 Ҵϴ (bump) ҴԴϴ.
+ *    , Reset ȣϸ Ҵ  ޸𸮸   ȯմϴ.
+ * ̶,  Ŭ   ʽϴ.
+ */
+class LinearArena
+{
+public:
+	/**  ϳ ⺻ Ʈ ũԴϴ. */
+	static const std::size_t DEFAULT_BLOCK_BYTE_SIZE = 256 * 1024;
+
+public:
+	explicit LinearArena(std::size_t blockByteSize = DEFAULT_BLOCK_BYTE_SIZE);
+	virtual ~LinearArena();
+
+	DISALLOW_COPY_AND_ASSIGN(LinearArena);
+
+	/** ޸𸮸 Ҵմϴ. alignment 2 ŵ̾ մϴ. */
+	void* Allocate(std::size_t byteSize, std::size_t alignment = alignof(std::max_align_t));
+
+	/**
+	 * Ҵ  ޸𸮸 ȯմϴ.
+	 *  Ҵ   ߴٸ   ϰ ü ũ  ϳ ٽ ҴϹǷ, Ŀ  ߰  Ҵմϴ.
+	 */
+	void Reset();
+
+	/**  Reset  Ҵ Ʈ ũ⸦ ϴ.    մϴ. */
+	std::size_t GetUsedByteSize() const { return usedByteSize_; }
+
+	/** Reset   ũ  ִ ϴ. */
+	std::size_t GetHighWaterByteSize() const { return highWaterByteSize_; }
+
+	/**  Ҵ   Ʈ ũ⸦ ϴ. */
+	std::size_t GetCapacity() const { return capacity_; }
+
+private:
+	/**   ġ ϴ Դϴ. */
+	struct Block
+	{
+		Block* prevBlock = nullptr;
+		std::size_t byteSize = 0;
+	};
+
+	/** ο  Ҵϰ   մϴ. */
+	void AllocateBlock(std::size_t byteSize);
+
+	/**   մϴ. */
+	void ReleaseBlocks();
+
+private:
+	/** ο  Ҵ  ּ Ʈ ũԴϴ. */
+	std::size_t blockByteSize_ = 0;
+
+	/**  Ҵ  Դϴ.     prevBlock ˴ϴ. */
+	Block* currentBlock_ = nullptr;
+
+	/**  Ͽ  Ҵ  ġ   ġԴϴ. */
+	uint8_t* cursor_ = nullptr;
+	uint8_t* end_ = nullptr;
+
+	/**  Ҵ  Դϴ. */
+	uint32_t blockCount_ = 0;
+
+	std::size_t usedByteSize_ = 0;
+	std::size_t highWaterByteSize_ = 0;
+	std::size_t capacity_ = 0;
+};
+
+/**    Ʒ Դϴ. */
+struct FrameArenaStatistics
+{
+	uint32_t threadCount = 0;         /**  Ʒ    Դϴ. */
+	uint64_t lastFrameByteSize = 0;   /** 庰  Ϸ ӿ  Ʈ ũ Դϴ. */
+	uint64_t highWaterByteSize = 0;   /** 庰  ӿ  ִ Ʈ ũ Դϴ. */
+	uint64_t capacityByteSize = 0;    /** 庰 Ҵ  ũ Դϴ. */
+};
+
+/**
+ *   ȸ ȿ ӽ ޸𸮸 Ҵϴ 庰  ҴԴϴ.
+ *   ڽŸ LinearArena ϹǷ Ҵ  ȭ ߻ ʽϴ.
+ * GL Ŵ    BeginFrame ȣϸ,   Ʒ  Ҵ   ϴ.
+ * ̶,  Ʒ Ҵ ޸𸮸  ӱ ؼ  ˴ϴ.
+ *  尡 ƴ (ùķ̼ ,  Ŵ Ŀ)  ߿  尡 BeginFrame ȣ  Ƿ,
+ *  Ʒ ޸𸮸 ϴ  FrameArenaScope Ʒ ؾ մϴ.     ޸𸮰  Ҵ翡 ˴ϴ.
+ * ex)
+ * FrameVector<uint32_t> visibleIndices;
+ * visibleIndices.reserve(1024);
+ */
+class FrameArena
+{
+public:
+	/**    Ʒ ޸𸮸 Ҵմϴ. */
+	static void* Allocate(std::size_t byteSize, std::size_t alignment = alignof(std::max_align_t));
+
+	/** ο  մϴ.  ӿ Ҵ  ޸𸮴 ȿȭ˴ϴ. */
+	static void BeginFrame();
+
+	/**    Ʒ 踦 ϴ. */
+	static FrameArenaStatistics GetStatistics();
+};
+
+/**
+ *      Ʒ ϴ üԴϴ.  Ʒ BeginFrame ȣǾ  ʽϴ.
+ *  ٱ     ٲٸ Ʒ Ƿ,      谡 ˴ϴ.
+ *   ùķ̼ ܸ  Ƿ, ùķ̼  ȿ    Ʒ   ֽϴ.
+ * ex)
+ * FrameArenaScope frameArenaScope;
+ * FrameVector<uint32_t> contacts;
+ */
+class FrameArenaScope
+{
+public:
+	FrameArenaScope();
+	virtual ~FrameArenaScope();
+
+	DISALLOW_COPY_AND_ASSIGN(FrameArenaScope);
+};
+
+/** ǥ ̳ʰ  Ʒ ϵ ϴ ҴԴϴ.   ƹ ۾  ʽϴ. */
+template <typename T>
+class FrameAllocator
+{
+public:
+	using value_type = T;
+
+	FrameAllocator() = default;
+
+	template <typename U>
+	FrameAllocator(const FrameAllocator<U>&) {}
+
+	T* allocate(std::size_t count)
+	{
+		return static_cast<T*>(FrameArena::Allocate(count * sizeof(T), alignof(T)));
+	}
+
+	void deallocate(T*, std::size_t) {}
+
+	template <typename U>
+	bool operator==(const FrameAllocator<U>&) const { return true; }
+
+	template <typename U>
+	bool operator!=(const FrameAllocator<U>&) const { return false; }
+};
+
+/**  Ʒ ϴ ǥ ̳Դϴ. */
+template <typename T>
+using FrameVector = std::vector<T, FrameAllocator<T>>;
+
+using FrameString = std::basic_string<char, std::char_traits<char>, FrameAllocator<char>>;
\ No newline at end of file
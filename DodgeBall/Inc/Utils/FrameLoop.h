@@ -0,0 +1,110 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+
+#include "Job/JobManager.h"
+
+#include "Utils/Macro.h"
+
+/**
+ *  и  ð (fixed timestep) ùķ̼ Դϴ.
+ * Ӹ   ð ϰ,  ðŭ   ùķ̼  ϹǷ
+ * ùķ̼   ȭ ֻ   ʽϴ.
+ *  GetAlpha     ܰ   ¸ մϴ.
+ *
+ * ùķ̼  忡 BeginFrame ùķ̼  ۾ ϰ EndFrame ϷḦ ϹǷ,
+ *   ùķ̼ Ǵ   ӿ (publish) ¸ մϴ.
+ * ̶,  Լ ׻  忡 ȣǹǷ ùķ̼ ¸  · ϰų üϴ  մϴ.
+ * ex)
+ * FrameLoop frameLoop(60.0, 5, true);
+ * frameLoop.SetSimulateFunction([&](double stepSeconds) { world.Step(stepSeconds); });
+ * frameLoop.SetPublishFunction([&]() { renderState = world.GetState(); });
+ * while (...)
+ * {
+ *     frameLoop.BeginFrame(timer.GetDeltaSeconds());
+ *     Render(renderState, frameLoop.GetAlpha());
+ *     frameLoop.EndFrame();
+ * }
+ */
+class FrameLoop
+{
+public:
+	/** ùķ̼  ԼԴϴ. ڴ ʴ  Դϴ. */
+	using SimulateFunction = std::function<void(double)>;
+
+	/** ùķ̼   ԼԴϴ. */
+	using PublishFunction = std::function<void()>;
+
+public:
+	/**
+	 * ùķ̼ ļ(Hz),  ӿ  ִ  , ùķ̼   θ մϴ.
+	 *  ӿ ִ     з ִٸ  ð ϴ.
+	 */
+	FrameLoop(double simulationHz = 60.0, uint32_t maxCatchUpSteps = 5, bool bIsThreadedSimulation = false);
+	virtual ~FrameLoop();
+
+	DISALLOW_COPY_AND_ASSIGN(FrameLoop);
+
+	/** ùķ̼  Լ մϴ. */
+	void SetSimulateFunction(const SimulateFunction& simulateFunction) { simulateFunction_ = simulateFunction; }
+
+	/** ùķ̼   Լ մϴ. */
+	void SetPublishFunction(const PublishFunction& publishFunction) { publishFunction_ = publishFunction; }
+
+	/**  մϴ. ʴ   ð ϰ ʿ ŭ ùķ̼  (Ǵ )մϴ. */
+	void BeginFrame(double frameSeconds);
+
+	/**  մϴ. ùķ̼   ̹  ùķ̼ Ϸ     մϴ. */
+	void EndFrame();
+
+	/**      ϴ.  [0, 1)Դϴ. */
+	double GetAlpha() const { return publishedAlpha_; }
+
+	/** ʴ ùķ̼   ϴ. */
+	double GetStepSeconds() const { return stepSeconds_; }
+
+	/** ݱ  ü ùķ̼   ϴ. */
+	uint64_t GetStepCount() const { return stepCount_; }
+
+	/** ̹ ӿ  ùķ̼   ϴ. */
+	uint32_t GetFrameStepCount() const { return frameStepCount_; }
+
+	/** ִ   Ѿ   ð() ϴ. */
+	double GetDroppedSeconds() const { return droppedSeconds_; }
+
+	/** ùķ̼   θ Ȯմϴ. */
+	bool IsThreadedSimulation() const { return bIsThreadedSimulation_; }
+
+private:
+	/** ùķ̼  մϴ. */
+	void RunSteps(uint32_t stepCount);
+
+private:
+	/** ʴ ùķ̼  Դϴ. */
+	double stepSeconds_ = 0.0;
+
+	/**  ӿ  ִ  Դϴ. */
+	uint32_t maxCatchUpSteps_ = 0;
+
+	/** ùķ̼   Դϴ. */
+	bool bIsThreadedSimulation_ = false;
+
+	/**  ùķ̼   ð()Դϴ. */
+	double accumulatorSeconds_ = 0.0;
+
+	/** ̹ ӿ       Դϴ. */
+	double pendingAlpha_ = 0.0;
+	double publishedAlpha_ = 0.0;
+
+	uint64_t stepCount_ = 0;
+	uint32_t frameStepCount_ = 0;
+	double droppedSeconds_ = 0.0;
+
+	SimulateFunction simulateFunction_;
+	PublishFunction publishFunction_;
+
+	/** ùķ̼  忡  ùķ̼ ۾ īԴϴ. */
+	JobCounter simulationCounter_;
+	bool bIsSimulationPending_ = false;
+};
\ No newline at end of file
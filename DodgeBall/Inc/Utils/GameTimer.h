@@ -1,14 +1,30 @@
 #pragma once
 
+#include <array>
 #include <string>
 #include <cstdint>
 
+/** ֱ  ð Դϴ.  Դϴ. */
+struct FrameTimeStatistics
+{
+	uint32_t sampleCount = 0;
+	double minSeconds = 0.0;
+	double averageSeconds = 0.0;
+	double p99Seconds = 0.0;
+	double maxSeconds = 0.0;
+};
+
 /**
  *    Ÿ̸Դϴ.
- *  Ÿ̸Ӵ GLFW  Ǿϴ.
+ *  Ÿ̸Ӵ   ð(std::chrono::steady_clock) 64Ʈ  ƽ  Ǿϴ.
+ * ð  ƽ ϹǷ, float     ޸  ð  Ÿ ð е  ʽϴ.
  */
 class GameTimer
 {
+public:
+	/**  ð 踦  ֱ  Դϴ. */
+	static const uint32_t FRAME_TIME_WINDOW_SIZE = 256;
+
 public:
 	/**
 	 * Ÿ̸    ҸԴϴ.
@@ -24,10 +40,19 @@ public:
 	GameTimer& operator=(const GameTimer& instance) noexcept;
 
 	/** ʴ Ÿ ð  ϴ. */
-	float GetDeltaSeconds() const;
+	double GetDeltaSeconds() const;
 
 	/** ʱȭ   ʴ ü ð  ϴ. */
-	float GetTotalSeconds() const;
+	double GetTotalSeconds() const;
+
+	/** ƽ  Ÿ ð  ϴ. */
+	uint64_t GetDeltaTicks() const;
+
+	/** ʱȭ   ƽ  ü ð  ϴ. */
+	uint64_t GetTotalTicks() const;
+
+	/** ֱ FRAME_TIME_WINDOW_SIZE  Ÿ ð (ּ//99 /ִ) ϴ. */
+	FrameTimeStatistics GetFrameTimeStatistics() const;
 
 	/** Ÿ̸Ӹ ʱȭմϴ. */
 	void Reset();
@@ -41,22 +66,38 @@ public:
 	/** Ÿ̸Ӹ Ʈմϴ. */
 	void Tick();
 
+	/**   ð  ƽ  ϴ. */
+	static uint64_t GetCurrentTicks();
+
+	/** 1ʴ ƽ  ϴ. */
+	static uint64_t GetTickFrequency();
+
+	/** ƽ  ð   ȯմϴ. */
+	static double ConvertTicksToSeconds(uint64_t ticks);
+
 private:
 	/** Ÿ̸  Դϴ. */
 	bool bIsStop_ = false;
 
 	/** Ÿ̸ ð    Ǵ ðԴϴ. Reset ȣϸ ʱȭ˴ϴ. */
-	float baseTime_ = 0LL;
+	uint64_t baseTime_ = 0ULL;
 
 	/** Ÿ̸  ðԴϴ. Stop ȣϴ   ʱȭ˴ϴ. */
-	float pausedTime_ = 0LL;
+	uint64_t pausedTime_ = 0ULL;
 
 	/** Ÿ̸  ðԴϴ. Stop ȣϴ   ŵ˴ϴ. */
-	float stopTime_ = 0LL;
+	uint64_t stopTime_ = 0ULL;
 
 	/** Tick ȣϱ  ð Դϴ. */
-	float prevTime_ = 0LL;
+	uint64_t prevTime_ = 0ULL;
 
 	/** Tick ȣ  ð Դϴ. */
-	float currTime_ = 0LL;
+	uint64_t currTime_ = 0ULL;
+
+	/** ֱ  ƽ  Ÿ ð ϴ  Դϴ. */
+	std::array<uint64_t, FRAME_TIME_WINDOW_SIZE> frameTimeTicks_ = { 0ULL, };
+
+	/**  ۿ      ġԴϴ. */
+	uint32_t frameTimeCount_ = 0;
+	uint32_t frameTimeCursor_ = 0;
 };
\ No newline at end of file
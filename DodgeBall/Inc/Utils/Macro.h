@@ -1,5 +1,9 @@
 #pragma once
 
+#if !defined(_MSC_VER)
+#include <csignal>
+#endif
+
 /**
  * Ÿ  ڿ  ڸ  ϴ ũԴϴ.
  *  ũΰ  Ǿ   Ÿ ݵ   ڿ  ڸ ؾ մϴ.
@@ -10,4 +14,16 @@ TypeName(TypeName&&) = delete;\
 TypeName(const TypeName&) = delete;\
 TypeName& operator=(TypeName&&) = delete;\
 TypeName& operator=(const TypeName&) = delete;
+#endif
+
+/**
+ * Ű Ǿ ִٸ  ġ break ̴ϴ.
+ * MSVC ƴ Ϸ(GCC, Clang) SIGTRAP ñ׳ ̿մϴ.
+ */
+#ifndef DEBUG_BREAK
+#if defined(_MSC_VER)
+#define DEBUG_BREAK() __debugbreak()
+#else
+#define DEBUG_BREAK() std::raise(SIGTRAP)
+#endif
 #endif
\ No newline at end of file
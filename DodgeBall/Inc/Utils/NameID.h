@@ -0,0 +1,84 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+
+/**
+ * ڿ ̸ 64Ʈ FNV-1a ؽ  ǥϴ ̸ IDԴϴ.
+ * ڿ ͷκ  ð   Ƿ,   ̸ ȸ  ڿ 񱳿 ӽ ڿ  ߻ ʽϴ.
+ * ex)
+ * static constexpr NameID BASIC_SHADER("BasicShader");
+ * Shader* shader = GLManager::GetRef().GetByName<Shader>(BASIC_SHADER);
+ */
+class NameID
+{
+public:
+	constexpr NameID() = default;
+	constexpr NameID(const char* name) : hash_(Hash(name)) {}
+	NameID(const std::string& name) : hash_(Hash(name.data(), name.size())) {}
+
+	/** ̸ ؽ  ϴ. */
+	constexpr uint64_t GetHash() const { return hash_; }
+
+	/** ̸ ID ȿ Ȯմϴ. ⺻ ڷ  ̸ ID ȿ ʽϴ. */
+	constexpr bool IsValid() const { return hash_ != 0; }
+
+	constexpr bool operator==(const NameID& nameID) const { return hash_ == nameID.hash_; }
+	constexpr bool operator!=(const NameID& nameID) const { return hash_ != nameID.hash_; }
+
+	/** 64Ʈ FNV-1a ؽ    ҼԴϴ.   ϳ ؽ    FNV_OFFSET_BASIS մϴ. */
+	static constexpr uint64_t FNV_OFFSET_BASIS = 0xCBF29CE484222325ULL;
+	static constexpr uint64_t FNV_PRIME = 0x00000100000001B3ULL;
+
+	/**  ڷ  ڿ FNV-1a ؽ  մϴ. */
+	static constexpr uint64_t Hash(const char* name)
+	{
+		uint64_t hash = FNV_OFFSET_BASIS;
+		for (; *name != '\0'; ++name)
+		{
+			hash ^= static_cast<uint8_t>(*name);
+			hash *= FNV_PRIME;
+		}
+
+		return hash;
+	}
+
+	/** ̰ ־ ڿ FNV-1a ؽ  մϴ. */
+	static constexpr uint64_t Hash(const char* name, std::size_t length)
+	{
+		return HashBytes(FNV_OFFSET_BASIS, name, length);
+	}
+
+	/**
+	 * ؽ  Ʈ 迭 ̾  FNV-1a ؽ  մϴ.
+	 * ex)
+	 * uint64_t hash = NameID::FNV_OFFSET_BASIS;
+	 * hash = NameID::HashBytes(hash, reinterpret_cast<const char*>(&value), sizeof(value));
+	 * hash = NameID::HashBytes(hash, source.data(), source.size());
+	 */
+	static constexpr uint64_t HashBytes(uint64_t hash, const char* bytes, std::size_t byteSize)
+	{
+		for (std::size_t index = 0; index < byteSize; ++index)
+		{
+			hash ^= static_cast<uint8_t>(bytes[index]);
+			hash *= FNV_PRIME;
+		}
+
+		return hash;
+	}
+
+private:
+	uint64_t hash_ = 0;
+};
+
+/** ̸ ID ؽ  ̳ Ű   ֵ մϴ. */
+namespace std
+{
+	template <>
+	struct hash<NameID>
+	{
+		std::size_t operator()(const NameID& nameID) const { return static_cast<std::size_t>(nameID.GetHash()); }
+	};
+}
\ No newline at end of file
@@ -0,0 +1,168 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <new>
+#include <utility>
+#include <vector>
+
+#include "Utils/Assertion.h"
+#include "Utils/Macro.h"
+
+/** Ʈ Ǯ Դϴ. ϸ 뵵 մϴ. */
+struct ObjectPoolStatistics
+{
+	uint32_t liveCount = 0;  /**  ִ ü Դϴ. */
+	uint32_t chunkCount = 0; /** Ҵ ûũ Դϴ. */
+	uint32_t capacity = 0;   /** Ҵ ûũ   ִ ü ü Դϴ. */
+};
+
+/**
+ *  Ÿ ü ĳ  ũ ĵ ûũ(slab) ϴ  ũ Ʈ ǮԴϴ.
+ * ı ü ޸𸮴 ü ޸𸮿    ּҸ ϴ ħ(intrusive)  Ʈ ϹǷ,
+ * /ı O(1)̰ Ź  Ҵ ߻ ʽϴ. ûũ   ҴǸ ̵ Ƿ ü ʹ ıǱ  ȿմϴ.
+ * bIsThreadSafe true  Ʈ  ؽ ȣϹǷ  忡 /ı  ֽϴ.
+ * ex)
+ * ObjectPool<Ball> ballPool;
+ * Ball* ball = ballPool.Create(position, velocity);
+ * ballPool.Destroy(ball);
+ */
+template <typename TObject, bool bIsThreadSafe = false>
+class ObjectPool
+{
+public:
+	/** ûũ  ּ  ũԴϴ. */
+	static const std::size_t CACHE_LINE_SIZE = 64;
+
+	/** ûũ ϳ  ü ⺻ Դϴ. */
+	static const uint32_t DEFAULT_CHUNK_OBJECT_COUNT = 256;
+
+public:
+	explicit ObjectPool(uint32_t chunkObjectCount = DEFAULT_CHUNK_OBJECT_COUNT) : chunkObjectCount_(chunkObjectCount)
+	{
+		CHECK(chunkObjectCount_ > 0);
+	}
+
+	virtual ~ObjectPool()
+	{
+		ASSERT(liveCount_ == 0, "Object pool destroyed with live objects. (live: %u)", liveCount_);
+
+		for (auto& chunk : chunks_)
+		{
+			::operator delete(chunk, std::align_val_t(CHUNK_ALIGNMENT));
+		}
+	}
+
+	DISALLOW_COPY_AND_ASSIGN(ObjectPool);
+
+	/** ü մϴ.   ٸ ûũ ߰մϴ. */
+	template <typename... Args>
+	TObject* Create(Args&&... args)
+	{
+		void* slot = nullptr;
+		{
+			std::unique_lock<std::mutex> lock = Lock();
+			if (!freeListHead_)
+			{
+				AllocateChunk();
+			}
+
+			slot = freeListHead_;
+			freeListHead_ = freeListHead_->next;
+			++liveCount_;
+		}
+
+		return new (slot) TObject(std::forward<Args>(args)...);
+	}
+
+	/** ü ıϰ   Ʈ ȯմϴ. ̶,  Ǯ  ü ؾ մϴ. */
+	void Destroy(TObject* object)
+	{
+		CHECK(object != nullptr);
+		object->~TObject();
+
+		std::unique_lock<std::mutex> lock = Lock();
+		FreeSlot* slot = reinterpret_cast<FreeSlot*>(object);
+		slot->next = freeListHead_;
+		freeListHead_ = slot;
+		--liveCount_;
+	}
+
+	/**  ִ ü  ϴ. */
+	uint32_t GetLiveCount() const
+	{
+		std::unique_lock<std::mutex> lock = Lock();
+		return liveCount_;
+	}
+
+	/** Ҵ ûũ  ϴ. */
+	uint32_t GetChunkCount() const
+	{
+		std::unique_lock<std::mutex> lock = Lock();
+		return static_cast<uint32_t>(chunks_.size());
+	}
+
+	/** Ʈ Ǯ 踦 ϴ. */
+	ObjectPoolStatistics GetStatistics() const
+	{
+		std::unique_lock<std::mutex> lock = Lock();
+
+		ObjectPoolStatistics statistics;
+		statistics.liveCount = liveCount_;
+		statistics.chunkCount = static_cast<uint32_t>(chunks_.size());
+		statistics.capacity = statistics.chunkCount * chunkObjectCount_;
+
+		return statistics;
+	}
+
+private:
+	/**  Ʈ   Դϴ.   ޸𸮿  մϴ. */
+	struct FreeSlot
+	{
+		FreeSlot* next;
+	};
+
+	/**   ũ Ʈ ũԴϴ.     ּҸ   ־ մϴ. */
+	static const std::size_t SLOT_ALIGNMENT = (alignof(TObject) > alignof(FreeSlot)) ? alignof(TObject) : alignof(FreeSlot);
+	static const std::size_t SLOT_BYTE_SIZE = (((sizeof(TObject) > sizeof(FreeSlot)) ? sizeof(TObject) : sizeof(FreeSlot)) + SLOT_ALIGNMENT - 1) / SLOT_ALIGNMENT * SLOT_ALIGNMENT;
+
+	/** ûũ  ũԴϴ. */
+	static const std::size_t CHUNK_ALIGNMENT = (SLOT_ALIGNMENT > CACHE_LINE_SIZE) ? SLOT_ALIGNMENT : CACHE_LINE_SIZE;
+
+	/**   Ǯ̶ ؽ ޴ϴ. ׷ ʴٸ ƹ ͵  ʽϴ. */
+	std::unique_lock<std::mutex> Lock() const
+	{
+		return bIsThreadSafe ? std::unique_lock<std::mutex>(mutex_) : std::unique_lock<std::mutex>();
+	}
+
+	/** ûũ Ҵϰ    Ʈ ߰մϴ.  ּ Ժ ϵ  ߰մϴ. */
+	void AllocateChunk()
+	{
+		uint8_t* chunk = reinterpret_cast<uint8_t*>(::operator new(SLOT_BYTE_SIZE * chunkObjectCount_, std::align_val_t(CHUNK_ALIGNMENT)));
+		chunks_.push_back(chunk);
+
+		for (uint32_t index = chunkObjectCount_; index > 0; --index)
+		{
+			FreeSlot* slot = reinterpret_cast<FreeSlot*>(chunk + SLOT_BYTE_SIZE * (index - 1));
+			slot->next = freeListHead_;
+			freeListHead_ = slot;
+		}
+	}
+
+private:
+	/** ûũ ϳ  ü Դϴ. */
+	uint32_t chunkObjectCount_ = 0;
+
+	/** Ҵ ûũ Դϴ. */
+	std::vector<uint8_t*> chunks_;
+
+	/**  Ʈ ù °  Դϴ. */
+	FreeSlot* freeListHead_ = nullptr;
+
+	/**  ִ ü Դϴ. */
+	uint32_t liveCount_ = 0;
+
+	/** bIsThreadSafe true   Ʈ 踦 ȣϴ ؽԴϴ. */
+	mutable std::mutex mutex_;
+};
\ No newline at end of file
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include "Utils/Macro.h"
+
+/**
+ *    ð Ϸ ϴ ũԴϴ.
+ * ̸ α׷  ñ ȿ ڿ(ڿ ͷ)̾ մϴ.
+ * Ϸ ĸó  ƴ϶   ϳ д 븸 ߻մϴ.
+ * ex)
+ * void GLManager::BeginFrame(...)
+ * {
+ *     PROFILE_SCOPE("GLManager::BeginFrame");
+ *     ...
+ * }
+ */
+#ifndef PROFILE_SCOPE
+#define PROFILE_CONCAT_INNER(A, B) A##B
+#define PROFILE_CONCAT(A, B) PROFILE_CONCAT_INNER(A, B)
+#define PROFILE_SCOPE(NAME) ProfileScope PROFILE_CONCAT(profileScope, __LINE__)(NAME)
+#endif
+
+/**
+ *   CPU  ð ϴ ϷԴϴ.
+ *   ڽŸ ̺Ʈ ۿ ϹǷ    ߻ ʽϴ.
+ * ĸó ̺Ʈ Chrome Ʈ̽ JSON    , chrome://tracing Ǵ Perfetto(ui.perfetto.dev) Ȯ  ֽϴ.
+ */
+class Profiler
+{
+public:
+	/** ̺Ʈ ĸó մϴ.  ĸó ̺Ʈ  尡  ̺Ʈ   ϴ. */
+	static void BeginCapture();
+
+	/** ̺Ʈ ĸó մϴ. */
+	static void EndCapture();
+
+	/** ̺Ʈ ĸó  Ȯմϴ. */
+	static bool IsCapturing();
+
+	/**   ̸ մϴ. ̸ Ʈ̽   ̸ ǥõ˴ϴ. */
+	static void SetThreadName(const std::string& threadName);
+
+	/** Ϸ  ̺Ʈ   ̺Ʈ ۿ մϴ. ð  Դϴ. */
+	static void RecordEvent(const char* name, uint64_t beginTicks, uint64_t endTicks);
+
+	/**
+	 *  ð ī    ̺Ʈ ۿ մϴ. ĸó  ƴ϶  ʽϴ.
+	 *  ̸ īʹ Ʈ̽ Ͽ ϳ ī Ʈ ǥõ˴ϴ. ̸ ڿ ͷ̾ մϴ.
+	 */
+	static void RecordCounter(const char* name, int64_t value);
+
+	/**
+	 *  ĸó ̺Ʈ Chrome Ʈ̽ JSON Ϸ մϴ. 忡 ϸ false ȯմϴ.
+	 * ̶, ĸó  Ŀ ȣؾ մϴ.
+	 */
+	static bool WriteChromeTrace(const std::string& path);
+};
+
+/**   Ҹ  ð Ϸ ϴ  üԴϴ. PROFILE_SCOPE ũη մϴ. */
+class ProfileScope
+{
+public:
+	explicit ProfileScope(const char* name);
+	virtual ~ProfileScope();
+
+	DISALLOW_COPY_AND_ASSIGN(ProfileScope);
+
+private:
+	/**  ̸Դϴ. ĸó  ƴϾٸ nullptrԴϴ. */
+	const char* name_ = nullptr;
+
+	/**  ۵ ð()Դϴ. */
+	uint64_t beginTicks_ = 0;
+};
\ No newline at end of file
@@ -1,6 +1,10 @@
 #include <glad/glad.h>
 
 #include "GL/GLError.h"
+#include "Utils/Macro.h"
+#include "Utils/Utils.h"
+
+bool GLError::bIsStrictValidation_ = true;
 
 std::map<uint32_t, std::string> GLError::errorMessages_ =
 {
@@ -20,3 +24,75 @@ const char* GLError::GetMessage(uint32_t code)
 {
 	return errorMessages_.at(code).c_str();
 }
+
+
+/**  ޽ ó ϴ ̸ ϴ. */
+static const char* GetDebugSourceName(GLenum source)
+{
+	switch (source)
+	{
+	case GL_DEBUG_SOURCE_API:             return "API";
+	case GL_DEBUG_SOURCE_WINDOW_SYSTEM:   return "Window System";
+	case GL_DEBUG_SOURCE_SHADER_COMPILER: return "Shader Compiler";
+	case GL_DEBUG_SOURCE_THIRD_PARTY:     return "Third Party";
+	case GL_DEBUG_SOURCE_APPLICATION:     return "Application";
+	default:                              return "Other";
+	}
+}
+
+/**  ޽  ϴ ̸ ϴ. */
+static const char* GetDebugTypeName(GLenum type)
+{
+	switch (type)
+	{
+	case GL_DEBUG_TYPE_ERROR:               return "Error";
+	case GL_DEBUG_TYPE_DEPRECATED_BEHAVIOR: return "Deprecated Behavior";
+	case GL_DEBUG_TYPE_UNDEFINED_BEHAVIOR:  return "Undefined Behavior";
+	case GL_DEBUG_TYPE_PORTABILITY:         return "Portability";
+	case GL_DEBUG_TYPE_PERFORMANCE:         return "Performance";
+	case GL_DEBUG_TYPE_MARKER:              return "Marker";
+	default:                                return "Other";
+	}
+}
+
+/**  ޽ ɰ ϴ ̸ ϴ. */
+static const char* GetDebugSeverityName(GLenum severity)
+{
+	switch (severity)
+	{
+	case GL_DEBUG_SEVERITY_HIGH:   return "High";
+	case GL_DEBUG_SEVERITY_MEDIUM: return "Medium";
+	case GL_DEBUG_SEVERITY_LOW:    return "Low";
+	default:                       return "Notification";
+	}
+}
+
+static void APIENTRY DebugMessageCallback(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei /*length*/, const GLchar* message, const void* /*userParam*/)
+{
+	DebugPrintF("\nOpenGL debug message!\n> Source: %s\n> Type: %s\n> Severity: %s\n> ID: %u\n> Message: %s\n\n", GetDebugSourceName(source), GetDebugTypeName(type), GetDebugSeverityName(severity), id, message);
+
+#if defined(DEBUG_MODE) || defined(RELWITHDEBINFO_MODE)
+	if (type == GL_DEBUG_TYPE_ERROR)
+	{
+		DEBUG_BREAK();
+	}
+#endif
+}
+
+void GLError::EnableDebugOutput(bool bIsSynchronous)
+{
+	glEnable(GL_DEBUG_OUTPUT);
+	if (bIsSynchronous)
+	{
+		glEnable(GL_DEBUG_OUTPUT_SYNCHRONOUS);
+	}
+	else
+	{
+		glDisable(GL_DEBUG_OUTPUT_SYNCHRONOUS);
+	}
+
+	glDebugMessageCallback(DebugMessageCallback, nullptr);
+
+	/** ˸  ޽( ޸ ġ ȳ ) Ӹ ݺǹǷ  ʽϴ. */
+	glDebugMessageControl(GL_DONT_CARE, GL_DONT_CARE, GL_DEBUG_SEVERITY_NOTIFICATION, 0, nullptr, GL_FALSE);
+}
\ No newline at end of file
@@ -11,8 +11,51 @@
 #include "GLFW/GLFWManager.h"
 
 #include "Utils/Assertion.h"
+#include "Utils/FrameArena.h"
+#include "Utils/Profiler.h"
 
 GLManager GLManager::singleton_;
+uint32_t GLManager::resourceTableCount_ = 0;
+
+#if defined(GL_CALLBACK_VALIDATION)
+const EGLValidationMode GLManager::DEFAULT_VALIDATION_MODE = EGLValidationMode::DEBUG_OUTPUT;
+#elif defined(DEBUG_MODE) || defined(RELWITHDEBINFO_MODE)
+const EGLValidationMode GLManager::DEFAULT_VALIDATION_MODE = EGLValidationMode::STRICT;
+#else
+const EGLValidationMode GLManager::DEFAULT_VALIDATION_MODE = EGLValidationMode::NONE;
+#endif
+
+/** GL_KHR_parallel_shader_compile     ԼԴϴ.  Ȯ GLAD δ ԵǾ  Ƿ  ҷɴϴ. */
+typedef void (APIENTRYP PFNGLMAXSHADERCOMPILERTHREADSKHRPROC)(GLuint count);
+
+/**    ̹ ϵ ûϴ Դϴ. */
+static const GLuint MAX_SHADER_COMPILER_THREADS = 0xFFFFFFFF;
+
+/**  潺     ִ ð()Դϴ. */
+static const uint64_t FRAME_FENCE_TIMEOUT = 1000000;
+
+/**  ĳ OpenGL  εԴϴ. */
+static const uint32_t DEPTH_TEST_INDEX = 0;
+static const uint32_t STENCIL_TEST_INDEX = 1;
+static const uint32_t BLEND_INDEX = 2;
+static const uint32_t CULL_FACE_INDEX = 3;
+
+/**  ε  ϴ  ĳ ε ϴ.  ĳð  ʴ ε ̶ -1 ȯմϴ. */
+static int32_t GetBufferTargetIndex(uint32_t target)
+{
+	switch (target)
+	{
+	case GL_ARRAY_BUFFER:          return 0;
+	case GL_ELEMENT_ARRAY_BUFFER:  return 1;
+	case GL_UNIFORM_BUFFER:        return 2;
+	case GL_SHADER_STORAGE_BUFFER: return 3;
+	case GL_DRAW_INDIRECT_BUFFER:  return 4;
+	case GL_PIXEL_UNPACK_BUFFER:   return 5;
+	case GL_PIXEL_PACK_BUFFER:     return 6;
+	case GL_COPY_WRITE_BUFFER:     return 7;
+	default:                       return -1;
+	}
+}
 
 GLManager& GLManager::GetRef()
 {
@@ -24,42 +67,141 @@ GLManager* GLManager::GetPtr()
 	return &singleton_;
 }
 
-void GLManager::Startup()
+bool GLManager::IsDebugContextRequired(const EGLValidationMode& validationMode)
+{
+	EGLValidationMode availableValidationMode = GetAvailableValidationMode(validationMode);
+	return availableValidationMode == EGLValidationMode::DEBUG_OUTPUT || availableValidationMode == EGLValidationMode::DEBUG_OUTPUT_SYNCHRONOUS;
+}
+
+void GLManager::Startup(const EGLValidationMode& validationMode, const std::string& programBinaryCachePath)
 {
 	GLFWManager& glfwManager = GLFWManager::GetRef();
 	renderTargetWindow_ = glfwManager.mainWindow_;
 	windowWidth_ = glfwManager.mainWindowWidth_;
 	windowHeight_ = glfwManager.mainWindowHeight_;
+	runMode_ = glfwManager.runMode_;
+
+	if (runMode_ == ERunMode::SIMULATION)
+	{
+		return; // OpenGL ؽƮ Ƿ OpenGL  ʱȭ  .
+	}
 
 	GLFW_API_CHECK(glfwMakeContextCurrent(renderTargetWindow_));
 
 	ASSERT(gladLoadGLLoader((GLADloadproc)glfwGetProcAddress), "Failed to initialize OpenGL function.");
+
+	validationMode_ = GetAvailableValidationMode(validationMode);
+	if (validationMode_ != validationMode)
+	{
+		DebugPrintF("Strict OpenGL validation is not available in this build. Use debug output validation instead.\n");
+	}
+
+	bool bIsDebugOutput = (validationMode_ == EGLValidationMode::DEBUG_OUTPUT || validationMode_ == EGLValidationMode::DEBUG_OUTPUT_SYNCHRONOUS);
+	if (bIsDebugOutput && glfwGetWindowAttrib(renderTargetWindow_, GLFW_OPENGL_DEBUG_CONTEXT) == GLFW_FALSE)
+	{
+		DebugPrintF("OpenGL debug output validation requires a debug context. OpenGL validation is disabled.\n");
+		validationMode_ = EGLValidationMode::NONE;
+	}
+
+	GLError::bIsStrictValidation_ = (validationMode_ == EGLValidationMode::STRICT);
+	if (validationMode_ == EGLValidationMode::DEBUG_OUTPUT || validationMode_ == EGLValidationMode::DEBUG_OUTPUT_SYNCHRONOUS)
+	{
+		ASSERT(GLAD_GL_VERSION_4_3, "Debug output validation requires OpenGL 4.3 or later.");
+		GLError::EnableDebugOutput(validationMode_ == EGLValidationMode::DEBUG_OUTPUT_SYNCHRONOUS);
+	}
+
+	PFNGLMAXSHADERCOMPILERTHREADSKHRPROC maxShaderCompilerThreads = nullptr;
+	if (glfwExtensionSupported("GL_KHR_parallel_shader_compile"))
+	{
+		maxShaderCompilerThreads = reinterpret_cast<PFNGLMAXSHADERCOMPILERTHREADSKHRPROC>(glfwGetProcAddress("glMaxShaderCompilerThreadsKHR"));
+	}
+	else if (glfwExtensionSupported("GL_ARB_parallel_shader_compile"))
+	{
+		maxShaderCompilerThreads = reinterpret_cast<PFNGLMAXSHADERCOMPILERTHREADSKHRPROC>(glfwGetProcAddress("glMaxShaderCompilerThreadsARB"));
+	}
+
+	bIsParallelShaderCompileSupported_ = (maxShaderCompilerThreads != nullptr);
+	if (bIsParallelShaderCompileSupported_)
+	{
+		GL_API_CHECK(maxShaderCompilerThreads(MAX_SHADER_COMPILER_THREADS));
+	}
+
+	bIsS3TCSupported_ = glfwExtensionSupported("GL_EXT_texture_compression_s3tc");
+
+	if (!programBinaryCachePath.empty())
+	{
+		programBinaryCache_ = std::make_unique<ProgramBinaryCache>(programBinaryCachePath);
+		if (!programBinaryCache_->IsAvailable())
+		{
+			programBinaryCache_.reset();
+		}
+	}
+
 	ASSERT(ImGui_ImplOpenGL3_Init(), "Failed to initialize ImGui for OpenGL.");
+
+	InvalidateStateCache();
 }
 
 void GLManager::Shutdown()
 {
-	ImGui_ImplOpenGL3_Shutdown();
+	if (runMode_ != ERunMode::SIMULATION)
+	{
+		ImGui_ImplOpenGL3_Shutdown();
+	}
 
-	for (uint32_t index = 0; index < resources_.size(); ++index)
+	for (auto& frameFence : frameFences_)
 	{
-		if (resources_[index].first)
+		if (frameFence)
 		{
-			if (resources_[index].first->IsInitialized())
-			{
-				resources_[index].first->Release();
-			}
+			GL_API_CHECK(glDeleteSync(reinterpret_cast<GLsync>(frameFence)));
+			frameFence = nullptr;
+		}
+	}
 
-			resources_[index].first.reset();
-			resources_[index].second = false;
+	for (auto& resourceTable : resourceTables_)
+	{
+		if (resourceTable)
+		{
+			resourceTable->DestroyAll();
 		}
 	}
+	resourceTables_.clear();
+
+	vertexLayouts_.clear();
+	vertexLayoutIDs_.Clear();
+
+	programBinaryCache_.reset();
 
 	renderTargetWindow_ = nullptr;
 }
 
 void GLManager::BeginFrame(float red, float green, float blue, float alpha, float depth, uint8_t stencil)
 {
+	PROFILE_SCOPE("GLManager::BeginFrame");
+
+	FrameArena::BeginFrame();
+
+	if (runMode_ == ERunMode::SIMULATION)
+	{
+		return;
+	}
+
+	/** ̹    MAX_FRAMES_IN_FLIGHT    GPU  Ϸ  մϴ. */
+	void*& frameFence = frameFences_[frameIndex_ % MAX_FRAMES_IN_FLIGHT];
+	if (frameFence)
+	{
+		GLsync sync = reinterpret_cast<GLsync>(frameFence);
+		GLenum waitResult = GL_TIMEOUT_EXPIRED;
+		while (waitResult == GL_TIMEOUT_EXPIRED)
+		{
+			waitResult = glClientWaitSync(sync, GL_SYNC_FLUSH_COMMANDS_BIT, FRAME_FENCE_TIMEOUT);
+		}
+		GL_EXP_CHECK(waitResult != GL_WAIT_FAILED);
+
+		GL_API_CHECK(glDeleteSync(sync));
+		frameFence = nullptr;
+	}
+
 	SetViewport(0, 0, windowWidth_, windowHeight_);
 
 	glClearColor(red, green, blue, alpha);
@@ -71,15 +213,55 @@ void GLManager::BeginFrame(float red, float green, float blue, float alpha, floa
 
 void GLManager::EndFrame()
 {
+	PROFILE_SCOPE("GLManager::EndFrame");
+
 	ImGui::Render();
+
+	/** Ϸ ĸó ߿ ̹    Ƚ ī Ʈ մϴ. */
+	if (Profiler::IsCapturing())
+	{
+		Profiler::RecordCounter("GL Buffer Binds", static_cast<int64_t>(frameStateStatistics_.bufferBindCount));
+		Profiler::RecordCounter("GL Vertex Array Binds", static_cast<int64_t>(frameStateStatistics_.vertexArrayBindCount));
+		Profiler::RecordCounter("GL Program Binds", static_cast<int64_t>(frameStateStatistics_.programBindCount));
+		Profiler::RecordCounter("GL Texture Binds", static_cast<int64_t>(frameStateStatistics_.textureBindCount));
+		Profiler::RecordCounter("GL Vertex Format Calls", static_cast<int64_t>(frameStateStatistics_.vertexFormatCallCount));
+		Profiler::RecordCounter("GL Skipped State Calls", static_cast<int64_t>(frameStateStatistics_.skippedCallCount));
+	}
+
+	lastFrameStateStatistics_ = frameStateStatistics_;
+	frameStateStatistics_ = GLStateStatistics();
+
+	if (runMode_ == ERunMode::SIMULATION)
+	{
+		++frameIndex_;
+		return;
+	}
+
 	ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+	InvalidateStateCache(); // ImGui  ĳø ġ ʰ OpenGL ¸ .
+
+	frameFences_[frameIndex_ % MAX_FRAMES_IN_FLIGHT] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+	GL_EXP_CHECK(frameFences_[frameIndex_ % MAX_FRAMES_IN_FLIGHT] != nullptr);
+	++frameIndex_;
 
-	GLFW_API_CHECK(glfwSwapBuffers(renderTargetWindow_));
+	/**  Ÿ   OpenGL Լ  ( ׽Ʈ ¥ OpenGL) ü ۰ ϴ. */
+	if (renderTargetWindow_)
+	{
+		GLFW_API_CHECK(glfwSwapBuffers(renderTargetWindow_));
+	}
 }
 
 void GLManager::SetViewport(int32_t x, int32_t y, int32_t width, int32_t height)
 {
+	if (viewport_[0] == x && viewport_[1] == y && viewport_[2] == width && viewport_[3] == height)
+	{
+		++frameStateStatistics_.skippedCallCount;
+		return;
+	}
+
 	GL_API_CHECK(glViewport(x, y, width, height));
+	viewport_ = { x, y, width, height };
+	++frameStateStatistics_.issuedCallCount;
 }
 
 void GLManager::SetVsyncMode(bool bIsEnable)
@@ -89,100 +271,299 @@ void GLManager::SetVsyncMode(bool bIsEnable)
 
 void GLManager::SetDepthMode(bool bIsEnable)
 {
-	if (bIsEnable)
+	SetCapability(DEPTH_TEST_INDEX, GL_DEPTH_TEST, bIsEnable);
+}
+
+void GLManager::SetStencilMode(bool bIsEnable)
+{
+	SetCapability(STENCIL_TEST_INDEX, GL_STENCIL_TEST, bIsEnable);
+}
+
+void GLManager::SetAlphaBlendMode(bool bIsEnable)
+{
+	SetCapability(BLEND_INDEX, GL_BLEND, bIsEnable);
+
+	if (bIsEnable && !bIsAlphaBlendFuncSet_)
 	{
-		GL_API_CHECK(glEnable(GL_DEPTH_TEST));
+		GL_API_CHECK(glBlendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ZERO));
+		bIsAlphaBlendFuncSet_ = true;
+		++frameStateStatistics_.issuedCallCount;
 	}
-	else
+}
+
+void GLManager::SetCullFaceMode(bool bIsEnable)
+{
+	SetCapability(CULL_FACE_INDEX, GL_CULL_FACE, bIsEnable);
+}
+
+void GLManager::BindBuffer(uint32_t target, uint32_t bufferID)
+{
+	int32_t targetIndex = GetBufferTargetIndex(target);
+	if (targetIndex >= 0 && boundBuffers_[targetIndex] == bufferID)
 	{
-		GL_API_CHECK(glDisable(GL_DEPTH_TEST));
+		++frameStateStatistics_.skippedCallCount;
+		return;
+	}
+
+	GL_API_CHECK(glBindBuffer(target, bufferID));
+	++frameStateStatistics_.issuedCallCount;
+	++frameStateStatistics_.bufferBindCount;
+
+	if (targetIndex >= 0)
+	{
+		boundBuffers_[targetIndex] = bufferID;
 	}
 }
 
-void GLManager::SetStencilMode(bool bIsEnable)
+void GLManager::BindBufferRange(uint32_t target, uint32_t slot, uint32_t bufferID, uint32_t offset, uint32_t byteSize)
 {
-	if (bIsEnable)
+	bool bIsCached = (target == GL_UNIFORM_BUFFER && slot < MAX_CACHED_UNIFORM_BUFFER_SLOTS);
+	if (bIsCached)
 	{
-		GL_API_CHECK(glEnable(GL_STENCIL_TEST));
+		const BufferRangeBinding& binding = boundUniformBufferRanges_[slot];
+		if (binding.bufferID == bufferID && binding.offset == offset && binding.byteSize == byteSize)
+		{
+			++frameStateStatistics_.skippedCallCount;
+			return;
+		}
+	}
+
+	if (byteSize == 0)
+	{
+		GL_API_CHECK(glBindBufferBase(target, slot, bufferID));
 	}
 	else
 	{
-		GL_API_CHECK(glDisable(GL_STENCIL_TEST));
+		GL_API_CHECK(glBindBufferRange(target, slot, bufferID, static_cast<GLintptr>(offset), static_cast<GLsizeiptr>(byteSize)));
+	}
+	++frameStateStatistics_.issuedCallCount;
+	++frameStateStatistics_.bufferBindCount;
+
+	if (bIsCached)
+	{
+		boundUniformBufferRanges_[slot] = { bufferID, offset, byteSize };
+	}
+
+	int32_t targetIndex = GetBufferTargetIndex(target);
+	if (targetIndex >= 0)
+	{
+		boundBuffers_[targetIndex] = bufferID;
 	}
 }
 
-void GLManager::SetAlphaBlendMode(bool bIsEnable)
+void GLManager::BindVertexArray(uint32_t vertexArrayID)
 {
-	if (bIsEnable)
+	if (boundVertexArray_ == vertexArrayID)
 	{
-		GL_API_CHECK(glEnable(GL_BLEND));
-		GL_API_CHECK(glBlendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ZERO));
+		++frameStateStatistics_.skippedCallCount;
+		return;
 	}
-	else
+
+	GL_API_CHECK(glBindVertexArray(vertexArrayID));
+	boundVertexArray_ = vertexArrayID;
+	++frameStateStatistics_.issuedCallCount;
+	++frameStateStatistics_.vertexArrayBindCount;
+
+	/** ε  ε ؽ 迭 ̹Ƿ, ؽ 迭 ٲ    ° ˴ϴ. */
+	boundBuffers_[GetBufferTargetIndex(GL_ELEMENT_ARRAY_BUFFER)] = UNKNOWN_STATE;
+}
+
+void GLManager::UseProgram(uint32_t programID)
+{
+	if (boundProgram_ == programID)
 	{
-		GL_API_CHECK(glDisable(GL_BLEND));
+		++frameStateStatistics_.skippedCallCount;
+		return;
 	}
+
+	GL_API_CHECK(glUseProgram(programID));
+	boundProgram_ = programID;
+	++frameStateStatistics_.issuedCallCount;
+	++frameStateStatistics_.programBindCount;
 }
 
-void GLManager::SetCullFaceMode(bool bIsEnable)
+void GLManager::BindTexture(uint32_t unit, uint32_t target, uint32_t textureID)
 {
-	if (bIsEnable)
+	bool bIsCached = (unit < MAX_CACHED_TEXTURE_UNITS);
+	if (bIsCached && boundTextures_[unit].target == target && boundTextures_[unit].textureID == textureID)
 	{
-		GL_API_CHECK(glEnable(GL_CULL_FACE));
+		++frameStateStatistics_.skippedCallCount;
+		return;
 	}
-	else
+
+	if (activeTextureUnit_ != unit)
+	{
+		GL_API_CHECK(glActiveTexture(GL_TEXTURE0 + unit));
+		activeTextureUnit_ = unit;
+		++frameStateStatistics_.issuedCallCount;
+	}
+
+	GL_API_CHECK(glBindTexture(target, textureID));
+	++frameStateStatistics_.issuedCallCount;
+	++frameStateStatistics_.textureBindCount;
+
+	if (bIsCached)
 	{
-		GL_API_CHECK(glDisable(GL_CULL_FACE));
+		boundTextures_[unit] = { target, textureID };
 	}
 }
 
-void GLManager::Destroy(const GLResource* resource)
+void GLManager::OnDeleteBuffer(uint32_t bufferID)
 {
-	int32_t resourceID = -1;
-	for (uint32_t index = 0; index < resources_.size(); ++index)
+	for (auto& boundBuffer : boundBuffers_)
 	{
-		GLResource* resourcePtr = resources_[index].first.get();
-		if (resource == resourcePtr)
+		if (boundBuffer == bufferID)
 		{
-			resourceID = static_cast<int32_t>(index);
-			break;
+			boundBuffer = 0;
 		}
 	}
 
-	if (resourceID == -1)
+	for (auto& binding : boundUniformBufferRanges_)
 	{
-		return; // ش ҽ ̹ Ҵ  Ǿų, GLManager ؼ  ҽ ƴ.
+		if (binding.bufferID == bufferID)
+		{
+			binding = { 0, 0, 0 };
+		}
 	}
+}
 
-	if (resources_[resourceID].first)
+void GLManager::OnDeleteVertexArray(uint32_t vertexArrayID)
+{
+	if (boundVertexArray_ == vertexArrayID)
 	{
-		if (resources_[resourceID].first->IsInitialized())
+		boundVertexArray_ = 0;
+		boundBuffers_[GetBufferTargetIndex(GL_ELEMENT_ARRAY_BUFFER)] = UNKNOWN_STATE;
+	}
+}
+
+void GLManager::OnDeleteProgram(uint32_t programID)
+{
+	if (boundProgram_ == programID)
+	{
+		boundProgram_ = UNKNOWN_STATE; //   α׷ ε   ı .
+	}
+}
+
+void GLManager::OnDeleteTexture(uint32_t textureID)
+{
+	for (auto& binding : boundTextures_)
+	{
+		if (binding.textureID == textureID)
 		{
-			resources_[resourceID].first->Release();
+			binding.textureID = 0;
 		}
+	}
+}
+
+void GLManager::OnSetElementBuffer(uint32_t vertexArrayID, uint32_t bufferID)
+{
+	if (boundVertexArray_ == vertexArrayID)
+	{
+		boundBuffers_[GetBufferTargetIndex(GL_ELEMENT_ARRAY_BUFFER)] = bufferID;
+	}
+}
+
+uint32_t GLManager::RegisterVertexLayout(const VertexLayout& layout)
+{
+	const uint32_t* layoutID = vertexLayoutIDs_.Find(layout);
+	if (layoutID)
+	{
+		return *layoutID;
+	}
+
+	vertexLayouts_.push_back(layout);
+
+	uint32_t newLayoutID = static_cast<uint32_t>(vertexLayouts_.size());
+	vertexLayoutIDs_.Insert(layout, newLayoutID);
+	return newLayoutID;
+}
+
+const VertexLayout& GLManager::GetVertexLayout(uint32_t layoutID) const
+{
+	CHECK(layoutID >= 1 && layoutID <= vertexLayouts_.size());
+	return vertexLayouts_[layoutID - 1];
+}
+
+void GLManager::InvalidateStateCache()
+{
+	/** fill ڸ  Ƿ, Ŭ   ؼ մϴ. */
+	uint32_t unknownState = UNKNOWN_STATE;
+
+	boundBuffers_.fill(unknownState);
+	boundUniformBufferRanges_.fill({ unknownState, unknownState, unknownState });
+	boundTextures_.fill({ unknownState, unknownState });
+	capabilities_.fill(unknownState);
+	viewport_ = { -1, -1, -1, -1 };
+	boundVertexArray_ = UNKNOWN_STATE;
+	boundProgram_ = UNKNOWN_STATE;
+	activeTextureUnit_ = UNKNOWN_STATE;
+	bIsAlphaBlendFuncSet_ = false;
+}
 
-		resources_[resourceID].first.reset();
-		resources_[resourceID].second = false;
+EGLValidationMode GLManager::GetAvailableValidationMode(const EGLValidationMode& validationMode)
+{
+#if defined(GL_CALLBACK_VALIDATION) || !(defined(DEBUG_MODE) || defined(RELWITHDEBINFO_MODE))
+	if (validationMode == EGLValidationMode::STRICT)
+	{
+		return EGLValidationMode::DEBUG_OUTPUT;
 	}
+#endif
+
+	return validationMode;
+}
+
+void GLManager::SetCapability(uint32_t capabilityIndex, uint32_t capability, bool bIsEnable)
+{
+	uint32_t state = bIsEnable ? 1 : 0;
+	if (capabilities_[capabilityIndex] == state)
+	{
+		++frameStateStatistics_.skippedCallCount;
+		return;
+	}
+
+	if (bIsEnable)
+	{
+		GL_API_CHECK(glEnable(capability));
+	}
+	else
+	{
+		GL_API_CHECK(glDisable(capability));
+	}
+	capabilities_[capabilityIndex] = state;
+	++frameStateStatistics_.issuedCallCount;
+}
+
+void GLManager::Destroy(const GLResource* resource)
+{
+	if (!resource || resource->resourceTableID_ >= resourceTables_.size() || !resourceTables_[resource->resourceTableID_])
+	{
+		return; // GLManager ؼ  ҽ ƴ.
+	}
+
+	resourceTables_[resource->resourceTableID_]->Destroy(resource->resourceHandle_);
 }
 
 void GLManager::Register(const std::string& name, GLResource* resource)
 {
-	auto it = namedResources_.find(name);
-	ASSERT(it == namedResources_.end(), "Already register '%s'", name.c_str());
+	NameID nameID(name);
+
+	const std::string* registeredName = resourceNames_.Find(nameID);
+	ASSERT(registeredName == nullptr || *registeredName != name, "Already register '%s'", name.c_str());
+	ASSERT(registeredName == nullptr, "Hash collision between '%s' and '%s'", name.c_str(), registeredName->c_str());
 
-	namedResources_.insert({ name, resource });
+	namedResources_.Insert(nameID, resource);
+	resourceNames_.Insert(nameID, name);
 }
 
-bool GLManager::IsRegistration(const std::string& name)
+bool GLManager::IsRegistration(const NameID& name) const
 {
-	return namedResources_.find(name) != namedResources_.end();
+	return namedResources_.Contains(name);
 }
 
-void GLManager::Unregister(const std::string& name)
+void GLManager::Unregister(const NameID& name)
 {
-	auto it = namedResources_.find(name);
-	ASSERT(it != namedResources_.end(), "Can't find '%s' in GLManager.", name.c_str());
+	ASSERT(namedResources_.Contains(name), "Can't find '%llx' in GLManager.", static_cast<unsigned long long>(name.GetHash()));
 
-	namedResources_.erase(it);
+	namedResources_.Erase(name);
+	resourceNames_.Erase(name);
 }
\ No newline at end of file
@@ -1,18 +1,51 @@
+#include <algorithm>
+#include <vector>
+
 #include <glad/glad.h>
 
 #include "GL/GLAssert.h"
+#include "GL/GLManager.h"
 #include "GL/IndexBuffer.h"
 #include "Utils/Assertion.h"
 
-IndexBuffer::IndexBuffer(const void* bufferPtr, uint32_t indexCount)
+/** 32Ʈ ε ε Ÿ 迭 ȯմϴ. */
+template <typename TIndex>
+static std::vector<TIndex> ConvertIndices(const uint32_t* indices, uint32_t indexCount)
+{
+	std::vector<TIndex> convertIndices(indexCount);
+	for (uint32_t index = 0; index < indexCount; ++index)
+	{
+		CHECK(indices[index] <= static_cast<uint32_t>(static_cast<TIndex>(~0u)));
+		convertIndices[index] = static_cast<TIndex>(indices[index]);
+	}
+
+	return convertIndices;
+}
+
+IndexBuffer::IndexBuffer(const uint32_t* indices, uint32_t indexCount)
 	: indexCount_(indexCount)
 {
-	uint32_t indexBufferSize = indexCount_ * sizeof(uint32_t);
+	CHECK(indices != nullptr && indexCount_ > 0);
+
+	type_ = SelectType(*std::max_element(indices, indices + indexCount_));
 
 	GL_API_CHECK(glGenBuffers(1, &indexBufferID_));
-	GL_API_CHECK(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexBufferID_));
-	GL_API_CHECK(glBufferData(GL_ELEMENT_ARRAY_BUFFER, indexBufferSize, bufferPtr, GL_STATIC_DRAW));
-	GL_API_CHECK(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0));
+	/** ε  ε ؽ 迭 ̹Ƿ,  ε ؽ 迭  ʵ   ε  ͸ մϴ. */
+	GLManager::GetRef().BindBuffer(GL_COPY_WRITE_BUFFER, indexBufferID_);
+	GL_API_CHECK(glBufferData(GL_COPY_WRITE_BUFFER, indexCount_ * GetIndexSize(), nullptr, GL_STATIC_DRAW));
+
+	bIsInitialized_ = true;
+
+	SetIndexData(indices, 0, indexCount_);
+}
+
+IndexBuffer::IndexBuffer(uint32_t indexCount, const EType& type)
+	: indexCount_(indexCount)
+	, type_(type)
+{
+	GL_API_CHECK(glGenBuffers(1, &indexBufferID_));
+	GLManager::GetRef().BindBuffer(GL_COPY_WRITE_BUFFER, indexBufferID_);
+	GL_API_CHECK(glBufferData(GL_COPY_WRITE_BUFFER, indexCount_ * GetIndexSize(), nullptr, GL_STATIC_DRAW));
 
 	bIsInitialized_ = true;
 }
@@ -29,6 +62,7 @@ void IndexBuffer::Release()
 {
 	CHECK(bIsInitialized_);
 
+	GLManager::GetRef().OnDeleteBuffer(indexBufferID_);
 	GL_API_CHECK(glDeleteBuffers(1, &indexBufferID_));
 
 	bIsInitialized_ = false;
@@ -36,10 +70,42 @@ void IndexBuffer::Release()
 
 void IndexBuffer::Bind()
 {
-	GL_API_CHECK(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexBufferID_));
+	GLManager::GetRef().BindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexBufferID_);
 }
 
 void IndexBuffer::Unbind()
 {
-	GL_API_CHECK(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0));
+	GLManager::GetRef().BindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+}
+
+void IndexBuffer::SetIndexData(const uint32_t* indices, uint32_t firstIndex, uint32_t indexCount)
+{
+	CHECK(indices != nullptr && firstIndex + indexCount <= indexCount_);
+
+	uint32_t indexSize = GetIndexSize();
+	GLManager::GetRef().BindBuffer(GL_COPY_WRITE_BUFFER, indexBufferID_);
+
+	switch (type_)
+	{
+	case EType::UNSIGNED_BYTE:
+	{
+		std::vector<uint8_t> convertIndices = ConvertIndices<uint8_t>(indices, indexCount);
+		GL_API_CHECK(glBufferSubData(GL_COPY_WRITE_BUFFER, firstIndex * indexSize, indexCount * indexSize, convertIndices.data()));
+	}
+	break;
+
+	case EType::UNSIGNED_SHORT:
+	{
+		std::vector<uint16_t> convertIndices = ConvertIndices<uint16_t>(indices, indexCount);
+		GL_API_CHECK(glBufferSubData(GL_COPY_WRITE_BUFFER, firstIndex * indexSize, indexCount * indexSize, convertIndices.data()));
+	}
+	break;
+
+	case EType::UNSIGNED_INT:
+		GL_API_CHECK(glBufferSubData(GL_COPY_WRITE_BUFFER, firstIndex * indexSize, indexCount * indexSize, indices));
+		break;
+
+	default:
+		ASSERT(false, "Undefined index type.");
+	}
 }
\ No newline at end of file
@@ -0,0 +1,58 @@
+#include <glad/glad.h>
+
+#include "GL/GLAssert.h"
+#include "GL/GLManager.h"
+#include "GL/IndirectBuffer.h"
+#include "Utils/Assertion.h"
+
+IndirectBuffer::IndirectBuffer(uint32_t maxCommandCount)
+	: maxCommandCount_(maxCommandCount)
+{
+	CHECK(maxCommandCount_ > 0);
+
+	uint32_t commandSize = static_cast<uint32_t>(sizeof(DrawElementsIndirectCommand));
+
+	GL_API_CHECK(glGenBuffers(1, &indirectBufferID_));
+	persistentBufferRing_.Initialize(GL_DRAW_INDIRECT_BUFFER, indirectBufferID_, maxCommandCount_ * commandSize, commandSize);
+
+	bIsInitialized_ = true;
+}
+
+IndirectBuffer::~IndirectBuffer()
+{
+	if (bIsInitialized_)
+	{
+		Release();
+	}
+}
+
+void IndirectBuffer::Release()
+{
+	CHECK(bIsInitialized_);
+
+	if (persistentBufferRing_.IsMapped())
+	{
+		persistentBufferRing_.Release();
+	}
+
+	GLManager::GetRef().OnDeleteBuffer(indirectBufferID_);
+	GL_API_CHECK(glDeleteBuffers(1, &indirectBufferID_));
+
+	bIsInitialized_ = false;
+}
+
+void IndirectBuffer::Bind()
+{
+	GLManager::GetRef().BindBuffer(GL_DRAW_INDIRECT_BUFFER, indirectBufferID_);
+}
+
+void IndirectBuffer::Unbind()
+{
+	GLManager::GetRef().BindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+}
+
+BufferAllocation IndirectBuffer::Allocate(uint32_t commandCount)
+{
+	CHECK(commandCount <= maxCommandCount_);
+	return persistentBufferRing_.Allocate(commandCount * static_cast<uint32_t>(sizeof(DrawElementsIndirectCommand)));
+}
\ No newline at end of file
@@ -0,0 +1,176 @@
+#include <cstddef>
+
+#include <glad/glad.h>
+
+#include "GL/GLAssert.h"
+#include "GL/GLManager.h"
+#include "GL/IndexBuffer.h"
+#include "GL/InstancedMeshRenderer.h"
+#include "GL/Shader.h"
+#include "GL/ShaderCompileBatch.h"
+#include "GL/VertexArray.h"
+#include "GL/VertexBuffer.h"
+#include "Utils/Assertion.h"
+#include "Utils/NameID.h"
+#include "Utils/Profiler.h"
+
+/** ޽ ؽ ۿ νϽ ۸  ؽ 迭 ε εԴϴ. */
+static const uint32_t MESH_BINDING_INDEX = 0;
+static const uint32_t INSTANCE_BINDING_INDEX = 1;
+
+/** ̴  ̸Դϴ. */
+static constexpr NameID VIEW_PROJECTION("viewProjection");
+static constexpr NameID LIGHT_DIRECTION("lightDirection");
+
+/** νϽ ޽ ̴Դϴ. νϽ ġ ũ ޽ø ȯϰ, Ɽ ϳ Ȯ  մϴ. */
+static const char* INSTANCED_MESH_VS_SOURCE = R"(
+#version 460 core
+
+layout(location = 0) in vec3 inPosition;
+layout(location = 1) in vec3 inNormal;
+layout(location = 2) in vec4 inInstancePositionScale;
+layout(location = 3) in vec4 inInstanceColor;
+
+uniform mat4 viewProjection;
+
+out vec3 normal;
+out vec4 color;
+
+void main()
+{
+	vec3 worldPosition = inInstancePositionScale.xyz + inPosition * inInstancePositionScale.w;
+	gl_Position = viewProjection * vec4(worldPosition, 1.0f);
+
+	normal = inNormal;
+	color = inInstanceColor;
+}
+)";
+
+static const char* INSTANCED_MESH_FS_SOURCE = R"(
+#version 460 core
+
+in vec3 normal;
+in vec4 color;
+
+uniform vec3 lightDirection;
+
+layout(location = 0) out vec4 outColor;
+
+void main()
+{
+	float diffuse = max(dot(normalize(normal), -lightDirection), 0.0f);
+	outColor = vec4(color.rgb * (0.2f + 0.8f * diffuse), color.a);
+}
+)";
+
+InstancedMeshRenderer::InstancedMeshRenderer(const std::vector<MeshVertex>& vertices, const std::vector<uint32_t>& indices, uint32_t maxInstanceCount, ShaderCompileBatch* shaderCompileBatch)
+	: maxInstanceCount_(maxInstanceCount)
+{
+	CHECK(!vertices.empty() && !indices.empty() && maxInstanceCount_ > 0);
+
+	GLManager& glManager = GLManager::GetRef();
+
+	if (shaderCompileBatch)
+	{
+		shader_ = shaderCompileBatch->Add(INSTANCED_MESH_VS_SOURCE, INSTANCED_MESH_FS_SOURCE);
+	}
+	else
+	{
+		shader_ = glManager.Create<Shader>(INSTANCED_MESH_VS_SOURCE, INSTANCED_MESH_FS_SOURCE);
+	}
+
+	uint32_t meshByteSize = static_cast<uint32_t>(sizeof(MeshVertex) * vertices.size());
+	meshVertexBuffer_ = glManager.Create<VertexBuffer>(vertices.data(), meshByteSize, VertexBuffer::EUsage::STATIC);
+	meshIndexBuffer_ = glManager.Create<IndexBuffer>(indices.data(), static_cast<uint32_t>(indices.size()));
+	instanceBuffer_ = glManager.Create<VertexBuffer>(static_cast<uint32_t>(sizeof(MeshInstance)) * maxInstanceCount_, VertexBuffer::EUsage::PERSISTENT);
+
+	VertexLayout meshLayout;
+	meshLayout.stride = sizeof(MeshVertex);
+	meshLayout.divisor = 0;
+	meshLayout.attributes =
+	{
+		{ 0, 3, VertexAttribute::EType::FLOAT, false, offsetof(MeshVertex, position) },
+		{ 1, 3, VertexAttribute::EType::FLOAT, false, offsetof(MeshVertex, normal) },
+	};
+
+	VertexLayout instanceLayout;
+	instanceLayout.stride = sizeof(MeshInstance);
+	instanceLayout.divisor = 1;
+	instanceLayout.attributes =
+	{
+		{ 2, 4, VertexAttribute::EType::FLOAT, false, offsetof(MeshInstance, positionScale) },
+		{ 3, 4, VertexAttribute::EType::UNSIGNED_BYTE, true, offsetof(MeshInstance, color) },
+	};
+
+	vertexArray_ = glManager.Create<VertexArray>();
+	vertexArray_->SetVertexBuffer(MESH_BINDING_INDEX, meshVertexBuffer_, meshLayout);
+	vertexArray_->SetVertexBuffer(INSTANCE_BINDING_INDEX, instanceBuffer_, instanceLayout);
+	vertexArray_->SetIndexBuffer(meshIndexBuffer_);
+
+	instanceRanges_.reserve(16);
+	frameIndex_ = glManager.GetFrameIndex();
+}
+
+InstancedMeshRenderer::~InstancedMeshRenderer()
+{
+	GLManager& glManager = GLManager::GetRef();
+
+	glManager.Destroy(vertexArray_);
+	glManager.Destroy(instanceBuffer_);
+	glManager.Destroy(meshIndexBuffer_);
+	glManager.Destroy(meshVertexBuffer_);
+	glManager.Destroy(shader_);
+}
+
+MeshInstance* InstancedMeshRenderer::AllocateInstances(uint32_t instanceCount)
+{
+	CHECK(instanceCount > 0);
+
+	uint64_t frameIndex = GLManager::GetRef().GetFrameIndex();
+	if (frameIndex_ != frameIndex)
+	{
+		frameIndex_ = frameIndex;
+		instanceRanges_.clear();
+	}
+
+	BufferAllocation allocation = instanceBuffer_->Allocate(static_cast<uint32_t>(sizeof(MeshInstance)) * instanceCount);
+	CHECK((allocation.offset % sizeof(MeshInstance)) == 0);
+
+	uint32_t baseInstance = allocation.offset / static_cast<uint32_t>(sizeof(MeshInstance));
+	if (!instanceRanges_.empty() && instanceRanges_.back().baseInstance + instanceRanges_.back().instanceCount == baseInstance)
+	{
+		instanceRanges_.back().instanceCount += instanceCount;
+	}
+	else
+	{
+		instanceRanges_.push_back({ baseInstance, instanceCount });
+	}
+
+	return reinterpret_cast<MeshInstance*>(allocation.bufferPtr);
+}
+
+void InstancedMeshRenderer::Draw(const glm::mat4& viewProjection, const glm::vec3& lightDirection)
+{
+	PROFILE_SCOPE("InstancedMeshRenderer::Draw");
+
+	if (frameIndex_ != GLManager::GetRef().GetFrameIndex() || instanceRanges_.empty())
+	{
+		return;
+	}
+
+	shader_->SetUniform(VIEW_PROJECTION, viewProjection);
+	shader_->SetUniform(LIGHT_DIRECTION, lightDirection);
+
+	shader_->Bind();
+	vertexArray_->Bind();
+
+	/** νϽ Ӽ  ġ baseInstance űǷ,   ٲ ؽ 迭 ٽ  ʽϴ. */
+	GLsizei indexCount = static_cast<GLsizei>(meshIndexBuffer_->GetIndexCount());
+	GLenum indexType = static_cast<GLenum>(meshIndexBuffer_->GetType());
+	for (const auto& instanceRange : instanceRanges_)
+	{
+		GL_API_CHECK(glDrawElementsInstancedBaseInstance(GL_TRIANGLES, indexCount, indexType, nullptr, static_cast<GLsizei>(instanceRange.instanceCount), instanceRange.baseInstance));
+	}
+
+	instanceRanges_.clear();
+}
\ No newline at end of file
@@ -0,0 +1,99 @@
+#include <cstring>
+
+#include <glad/glad.h>
+
+#include "GL/GLAssert.h"
+#include "GL/GLManager.h"
+#include "GL/IndexBuffer.h"
+#include "GL/MeshBatch.h"
+#include "GL/VertexBuffer.h"
+#include "Utils/Assertion.h"
+#include "Utils/Profiler.h"
+
+MeshBatch::MeshBatch(const VertexLayout& layout, uint32_t maxVertexCount, uint32_t maxIndexCount, uint32_t maxCommandCount)
+	: layout_(layout)
+	, maxVertexCount_(maxVertexCount)
+	, maxIndexCount_(maxIndexCount)
+{
+	CHECK(layout_.stride > 0 && layout_.divisor == 0 && maxVertexCount_ > 0 && maxIndexCount_ > 0);
+
+	GLManager& glManager = GLManager::GetRef();
+
+	vertexBuffer_ = glManager.Create<VertexBuffer>(maxVertexCount_ * layout_.stride, VertexBuffer::EUsage::STATIC);
+	/** ޽ ε ޽ ù ° ؽ  ϹǷ, ִ ؽ  ε Ÿ   ֽϴ. */
+	indexBuffer_ = glManager.Create<IndexBuffer>(maxIndexCount_, IndexBuffer::SelectType(maxVertexCount_ - 1));
+	indirectBuffer_ = glManager.Create<IndirectBuffer>(maxCommandCount);
+
+	vertexArray_ = glManager.Create<VertexArray>();
+	vertexArray_->SetVertexBuffer(0, vertexBuffer_, layout_);
+	vertexArray_->SetIndexBuffer(indexBuffer_);
+
+	commands_.reserve(maxCommandCount);
+}
+
+MeshBatch::~MeshBatch()
+{
+	GLManager& glManager = GLManager::GetRef();
+
+	glManager.Destroy(vertexArray_);
+	glManager.Destroy(indirectBuffer_);
+	glManager.Destroy(indexBuffer_);
+	glManager.Destroy(vertexBuffer_);
+}
+
+uint32_t MeshBatch::AddMesh(const void* vertices, uint32_t vertexCount, const uint32_t* indices, uint32_t indexCount)
+{
+	CHECK(vertices != nullptr && indices != nullptr && vertexCount > 0 && indexCount > 0);
+	ASSERT(vertexCount_ + vertexCount <= maxVertexCount_, "Mesh batch vertex overflow. (request: %u, remain: %u)", vertexCount, maxVertexCount_ - vertexCount_);
+	ASSERT(indexCount_ + indexCount <= maxIndexCount_, "Mesh batch index overflow. (request: %u, remain: %u)", indexCount, maxIndexCount_ - indexCount_);
+
+	vertexBuffer_->SetBufferSubData(vertices, vertexCount_ * layout_.stride, vertexCount * layout_.stride);
+	indexBuffer_->SetIndexData(indices, indexCount_, indexCount);
+
+	MeshRange mesh;
+	mesh.firstIndex = indexCount_;
+	mesh.indexCount = indexCount;
+	mesh.baseVertex = static_cast<int32_t>(vertexCount_);
+	meshes_.push_back(mesh);
+
+	vertexCount_ += vertexCount;
+	indexCount_ += indexCount;
+
+	return static_cast<uint32_t>(meshes_.size() - 1);
+}
+
+void MeshBatch::Submit(uint32_t meshIndex, uint32_t instanceCount, uint32_t baseInstance)
+{
+	CHECK(meshIndex < meshes_.size());
+	ASSERT(commands_.size() < indirectBuffer_->GetMaxCommandCount(), "Mesh batch command overflow. (max: %u)", indirectBuffer_->GetMaxCommandCount());
+
+	const MeshRange& mesh = meshes_[meshIndex];
+	commands_.push_back({ mesh.indexCount, instanceCount, mesh.firstIndex, mesh.baseVertex, baseInstance });
+}
+
+void MeshBatch::Draw()
+{
+	PROFILE_SCOPE("MeshBatch::Draw");
+
+	statistics_ = MeshBatchStatistics();
+	if (commands_.empty())
+	{
+		return;
+	}
+
+	uint32_t commandCount = static_cast<uint32_t>(commands_.size());
+	BufferAllocation allocation = indirectBuffer_->Allocate(commandCount);
+	std::memcpy(allocation.bufferPtr, commands_.data(), allocation.byteSize);
+
+	vertexArray_->Bind();
+	indirectBuffer_->Bind();
+
+	const void* indirect = reinterpret_cast<const void*>(static_cast<uintptr_t>(allocation.offset));
+	GLenum indexType = static_cast<GLenum>(indexBuffer_->GetType());
+	GL_API_CHECK(glMultiDrawElementsIndirect(GL_TRIANGLES, indexType, indirect, static_cast<GLsizei>(commandCount), 0));
+
+	statistics_.commandCount = commandCount;
+	statistics_.drawCallCount = 1;
+
+	commands_.clear();
+}
\ No newline at end of file
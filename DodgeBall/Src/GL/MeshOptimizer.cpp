@@ -0,0 +1,249 @@
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+#include "GL/MeshOptimizer.h"
+#include "Utils/Assertion.h"
+
+/** ؽ ĳ ȭ ϴ LRU ĳ ũ  Լ Դϴ.  Forsyth  ϴ. */
+static const uint32_t OPTIMIZE_CACHE_SIZE = 32;
+static const float CACHE_DECAY_POWER = 1.5f;
+static const float LAST_TRIANGLE_SCORE = 0.75f;
+static const float VALENCE_BOOST_SCALE = 2.0f;
+static const float VALENCE_BOOST_POWER = 0.5f;
+
+/** ε ĳ ġ  Ÿ Դϴ. */
+static const uint32_t INVALID_INDEX = 0xFFFFFFFF;
+
+/**
+ * ؽ  մϴ. ĳÿ ֱ  ؽϼ,  ﰢ  ؽϼ  ϴ.
+ *  ﰢ ؽ(ĳ ġ 0~2)  ﰢ 찡  ̾ ʵ   ޽ϴ.
+ */
+static float ComputeVertexScore(uint32_t cachePosition, uint32_t remainTriangleCount)
+{
+	if (remainTriangleCount == 0)
+	{
+		return -1.0f;
+	}
+
+	float score = 0.0f;
+	if (cachePosition < 3)
+	{
+		score = LAST_TRIANGLE_SCORE;
+	}
+	else if (cachePosition < OPTIMIZE_CACHE_SIZE)
+	{
+		float scale = 1.0f / static_cast<float>(OPTIMIZE_CACHE_SIZE - 3);
+		score = std::pow(1.0f - static_cast<float>(cachePosition - 3) * scale, CACHE_DECAY_POWER);
+	}
+
+	score += VALENCE_BOOST_SCALE * std::pow(static_cast<float>(remainTriangleCount), -VALENCE_BOOST_POWER);
+	return score;
+}
+
+float MeshOptimizer::ComputeACMR(const uint32_t* indices, uint32_t indexCount, uint32_t vertexCount, uint32_t cacheSize)
+{
+	CHECK(indexCount % 3 == 0 && cacheSize > 0);
+
+	if (indexCount == 0)
+	{
+		return 0.0f;
+	}
+
+	/** ؽ ĳÿ   մϴ.   ̰ ĳ ũ⺸ ũ ̹ ĳÿ з ؽԴϴ. */
+	std::vector<uint32_t> timestamps(vertexCount, 0);
+	uint32_t time = cacheSize + 1;
+	uint32_t missCount = 0;
+
+	for (uint32_t index = 0; index < indexCount; ++index)
+	{
+		uint32_t vertex = indices[index];
+		CHECK(vertex < vertexCount);
+
+		if (time - timestamps[vertex] > cacheSize)
+		{
+			timestamps[vertex] = time++;
+			++missCount;
+		}
+	}
+
+	return static_cast<float>(missCount) / static_cast<float>(indexCount / 3);
+}
+
+void MeshOptimizer::OptimizeVertexCache(uint32_t* indices, uint32_t indexCount, uint32_t vertexCount)
+{
+	CHECK(indexCount % 3 == 0);
+
+	uint32_t triangleCount = indexCount / 3;
+	if (triangleCount == 0)
+	{
+		return;
+	}
+
+	/** ؽ  ﰢ  ϴ.   remainTriangleCounts[vertex]    ﰢԴϴ. */
+	std::vector<uint32_t> remainTriangleCounts(vertexCount, 0);
+	for (uint32_t index = 0; index < indexCount; ++index)
+	{
+		CHECK(indices[index] < vertexCount);
+		++remainTriangleCounts[indices[index]];
+	}
+
+	std::vector<uint32_t> triangleOffsets(vertexCount + 1, 0);
+	for (uint32_t vertex = 0; vertex < vertexCount; ++vertex)
+	{
+		triangleOffsets[vertex + 1] = triangleOffsets[vertex] + remainTriangleCounts[vertex];
+	}
+
+	std::vector<uint32_t> vertexTriangles(indexCount);
+	std::vector<uint32_t> writeOffsets(triangleOffsets.begin(), triangleOffsets.end() - 1);
+	for (uint32_t index = 0; index < indexCount; ++index)
+	{
+		vertexTriangles[writeOffsets[indices[index]]++] = index / 3;
+	}
+
+	std::vector<uint32_t> cachePositions(vertexCount, INVALID_INDEX);
+	std::vector<float> vertexScores(vertexCount);
+	for (uint32_t vertex = 0; vertex < vertexCount; ++vertex)
+	{
+		vertexScores[vertex] = ComputeVertexScore(INVALID_INDEX, remainTriangleCounts[vertex]);
+	}
+
+	std::vector<float> triangleScores(triangleCount);
+	std::vector<uint8_t> bIsEmitted(triangleCount, 0);
+	uint32_t bestTriangle = 0;
+	for (uint32_t triangle = 0; triangle < triangleCount; ++triangle)
+	{
+		const uint32_t* triangleIndices = indices + triangle * 3;
+		triangleScores[triangle] = vertexScores[triangleIndices[0]] + vertexScores[triangleIndices[1]] + vertexScores[triangleIndices[2]];
+		bestTriangle = (triangleScores[triangle] > triangleScores[bestTriangle]) ? triangle : bestTriangle;
+	}
+
+	/** ĳô ũ⺸ 3    ־  ﰢ ؽ տ ߰  з ؽ    ֽϴ. */
+	std::array<uint32_t, OPTIMIZE_CACHE_SIZE + 3> cache;
+	std::array<uint32_t, OPTIMIZE_CACHE_SIZE + 3> newCache;
+	uint32_t cacheCount = 0;
+
+	std::vector<uint32_t> outputIndices(indexCount);
+	uint32_t scanTriangle = 0;
+
+	for (uint32_t outputTriangle = 0; outputTriangle < triangleCount; ++outputTriangle)
+	{
+		/** ĳ ؽ  ﰢ   ʴٸ,     ﰢ ٽ մϴ. */
+		if (bestTriangle == INVALID_INDEX)
+		{
+			while (bIsEmitted[scanTriangle])
+			{
+				++scanTriangle;
+			}
+			bestTriangle = scanTriangle;
+		}
+
+		const uint32_t* triangleIndices = indices + bestTriangle * 3;
+		std::memcpy(&outputIndices[outputTriangle * 3], triangleIndices, sizeof(uint32_t) * 3);
+		bIsEmitted[bestTriangle] = 1;
+
+		/**  ﰢ  ؽ  ﰢ Ͽ մϴ. */
+		uint32_t newCacheCount = 0;
+		for (uint32_t corner = 0; corner < 3; ++corner)
+		{
+			uint32_t vertex = triangleIndices[corner];
+
+			uint32_t* triangles = &vertexTriangles[triangleOffsets[vertex]];
+			uint32_t& remainTriangleCount = remainTriangleCounts[vertex];
+			uint32_t* found = std::find(triangles, triangles + remainTriangleCount, bestTriangle);
+			if (found != triangles + remainTriangleCount)
+			{
+				std::swap(*found, triangles[remainTriangleCount - 1]);
+				--remainTriangleCount;
+			}
+
+			if (std::find(newCache.begin(), newCache.begin() + newCacheCount, vertex) == newCache.begin() + newCacheCount)
+			{
+				newCache[newCacheCount++] = vertex;
+			}
+		}
+
+		for (uint32_t cacheIndex = 0; cacheIndex < cacheCount; ++cacheIndex)
+		{
+			uint32_t vertex = cache[cacheIndex];
+			if (vertex != triangleIndices[0] && vertex != triangleIndices[1] && vertex != triangleIndices[2])
+			{
+				newCache[newCacheCount++] = vertex;
+			}
+		}
+
+		/** ĳ ġ ٲ ؽ  մϴ. ĳ ũ⸦ Ѵ ؽ ĳÿ зϴ. */
+		for (uint32_t cacheIndex = 0; cacheIndex < newCacheCount; ++cacheIndex)
+		{
+			uint32_t vertex = newCache[cacheIndex];
+			cachePositions[vertex] = (cacheIndex < OPTIMIZE_CACHE_SIZE) ? cacheIndex : INVALID_INDEX;
+			vertexScores[vertex] = ComputeVertexScore(cachePositions[vertex], remainTriangleCounts[vertex]);
+		}
+
+		/**  ٲ ؽ  ﰢ  ϰ, ĳ  ؽ  ﰢ     ﰢ  մϴ. */
+		bestTriangle = INVALID_INDEX;
+		float bestScore = -1.0f;
+		for (uint32_t cacheIndex = 0; cacheIndex < newCacheCount; ++cacheIndex)
+		{
+			uint32_t vertex = newCache[cacheIndex];
+			const uint32_t* triangles = &vertexTriangles[triangleOffsets[vertex]];
+			for (uint32_t triangleIndex = 0; triangleIndex < remainTriangleCounts[vertex]; ++triangleIndex)
+			{
+				uint32_t triangle = triangles[triangleIndex];
+				const uint32_t* adjacentIndices = indices + triangle * 3;
+
+				float score = vertexScores[adjacentIndices[0]] + vertexScores[adjacentIndices[1]] + vertexScores[adjacentIndices[2]];
+				triangleScores[triangle] = score;
+
+				if (cacheIndex < OPTIMIZE_CACHE_SIZE && score > bestScore)
+				{
+					bestScore = score;
+					bestTriangle = triangle;
+				}
+			}
+		}
+
+		cacheCount = std::min(newCacheCount, OPTIMIZE_CACHE_SIZE);
+		std::copy(newCache.begin(), newCache.begin() + cacheCount, cache.begin());
+	}
+
+	std::memcpy(indices, outputIndices.data(), sizeof(uint32_t) * indexCount);
+}
+
+uint32_t MeshOptimizer::OptimizeVertexFetch(void* vertices, uint32_t vertexCount, uint32_t vertexStride, uint32_t* indices, uint32_t indexCount)
+{
+	CHECK(vertices != nullptr && vertexStride > 0);
+
+	/** ε ó ϴ   ؽ ȣ οմϴ. */
+	std::vector<uint32_t> remap(vertexCount, INVALID_INDEX);
+	uint32_t usedVertexCount = 0;
+	for (uint32_t index = 0; index < indexCount; ++index)
+	{
+		uint32_t& newVertex = remap[indices[index]];
+		if (newVertex == INVALID_INDEX)
+		{
+			newVertex = usedVertexCount++;
+		}
+		indices[index] = newVertex;
+	}
+
+	/**  ʴ ؽ Ǵ ؽ ڿ   Ӵϴ. */
+	uint32_t unusedVertex = usedVertexCount;
+	for (auto& newVertex : remap)
+	{
+		if (newVertex == INVALID_INDEX)
+		{
+			newVertex = unusedVertex++;
+		}
+	}
+
+	std::vector<uint8_t> sourceVertices(static_cast<uint8_t*>(vertices), static_cast<uint8_t*>(vertices) + static_cast<size_t>(vertexCount) * vertexStride);
+	for (uint32_t vertex = 0; vertex < vertexCount; ++vertex)
+	{
+		std::memcpy(static_cast<uint8_t*>(vertices) + static_cast<size_t>(remap[vertex]) * vertexStride, &sourceVertices[static_cast<size_t>(vertex) * vertexStride], vertexStride);
+	}
+
+	return usedVertexCount;
+}
\ No newline at end of file
@@ -0,0 +1,64 @@
+#include <glad/glad.h>
+
+#include "GL/GLAssert.h"
+#include "GL/GLManager.h"
+#include "GL/PersistentBufferRing.h"
+#include "Utils/Assertion.h"
+
+/**         ÷Դϴ. */
+static const GLbitfield PERSISTENT_MAP_FLAGS = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+
+void PersistentBufferRing::Initialize(uint32_t target, uint32_t bufferID, uint32_t regionByteSize, uint32_t alignment)
+{
+	CHECK(!IsMapped() && alignment > 0);
+
+	target_ = target;
+	bufferID_ = bufferID;
+	alignment_ = alignment;
+	regionByteSize_ = ((regionByteSize + alignment_ - 1) / alignment_) * alignment_;
+	frameIndex_ = GLManager::GetRef().GetFrameIndex();
+	regionOffset_ = 0;
+
+	GLsizeiptr bufferSize = static_cast<GLsizeiptr>(regionByteSize_) * GLManager::MAX_FRAMES_IN_FLIGHT;
+
+	GLManager::GetRef().BindBuffer(target_, bufferID_);
+	GL_API_CHECK(glBufferStorage(target_, bufferSize, nullptr, PERSISTENT_MAP_FLAGS));
+
+	mappedBufferPtr_ = reinterpret_cast<uint8_t*>(glMapBufferRange(target_, 0, bufferSize, PERSISTENT_MAP_FLAGS));
+	GL_EXP_CHECK(mappedBufferPtr_ != nullptr);
+}
+
+void PersistentBufferRing::Release()
+{
+	CHECK(IsMapped());
+
+	GLManager::GetRef().BindBuffer(target_, bufferID_);
+	GL_EXP_CHECK(glUnmapBuffer(target_));
+
+	mappedBufferPtr_ = nullptr;
+}
+
+BufferAllocation PersistentBufferRing::Allocate(uint32_t byteSize)
+{
+	CHECK(IsMapped());
+
+	uint64_t frameIndex = GLManager::GetRef().GetFrameIndex();
+	if (frameIndex_ != frameIndex)
+	{
+		frameIndex_ = frameIndex;
+		regionOffset_ = 0;
+	}
+
+	uint32_t alignedOffset = ((regionOffset_ + alignment_ - 1) / alignment_) * alignment_;
+	ASSERT(alignedOffset + byteSize <= regionByteSize_, "Persistent buffer region overflow. (request: %u, remain: %u)", byteSize, regionByteSize_ - regionOffset_);
+
+	uint32_t region = static_cast<uint32_t>(frameIndex_ % GLManager::MAX_FRAMES_IN_FLIGHT);
+
+	BufferAllocation allocation;
+	allocation.offset = region * regionByteSize_ + alignedOffset;
+	allocation.bufferPtr = mappedBufferPtr_ + allocation.offset;
+	allocation.byteSize = byteSize;
+
+	regionOffset_ = alignedOffset + byteSize;
+	return allocation;
+}
\ No newline at end of file
@@ -0,0 +1,193 @@
+#include <algorithm>
+#include <cstdio>
+#include <filesystem>
+#include <system_error>
+
+#include <glad/glad.h>
+
+#include "GL/GLAssert.h"
+#include "GL/ProgramBinaryCache.h"
+#include "Utils/Assertion.h"
+#include "Utils/NameID.h"
+#include "Utils/Profiler.h"
+#include "Utils/Utils.h"
+
+/** ĳ  ĺ (DBPB)  Դϴ.   ٲٸ  ÷   մϴ. */
+static const uint32_t CACHE_FILE_MAGIC = 0x42504244;
+static const uint32_t CACHE_FILE_VERSION = 1;
+
+/** ĳ  Դϴ.  ڿ binaryByteSize ũ α׷ ̳ʸ ̾ϴ. */
+struct ProgramBinaryFileHeader
+{
+	uint32_t magic;
+	uint32_t version;
+	uint64_t key;
+	uint64_t driverHash;
+	uint32_t binaryFormat;
+	uint32_t binaryByteSize;
+};
+
+/** Ʈ 迭 ؽ  մϴ. */
+static void HashBytes(uint64_t& hash, const void* bytes, std::size_t byteSize)
+{
+	hash = NameID::HashBytes(hash, reinterpret_cast<const char*>(bytes), byteSize);
+}
+
+/** OpenGL ڿ ؽ  մϴ. ڿ  踦 ϵ  ڱ մϴ. */
+static void HashGLString(uint64_t& hash, GLenum name)
+{
+	const char* string = reinterpret_cast<const char*>(glGetString(name));
+	string = string ? string : "";
+
+	HashBytes(hash, string, std::char_traits<char>::length(string) + 1);
+}
+
+ProgramBinaryCache::ProgramBinaryCache(const std::string& directoryPath)
+	: directoryPath_(directoryPath)
+{
+	int32_t binaryFormatCount = 0;
+	GL_API_CHECK(glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &binaryFormatCount));
+	if (binaryFormatCount <= 0)
+	{
+		DebugPrintF("Program binary cache is not available. The driver supports no program binary format.\n");
+		return;
+	}
+
+	binaryFormats_.resize(binaryFormatCount);
+	GL_API_CHECK(glGetIntegerv(GL_PROGRAM_BINARY_FORMATS, binaryFormats_.data()));
+
+	driverHash_ = NameID::FNV_OFFSET_BASIS;
+	HashGLString(driverHash_, GL_VENDOR);
+	HashGLString(driverHash_, GL_RENDERER);
+	HashGLString(driverHash_, GL_VERSION);
+
+	std::error_code errorCode;
+	std::filesystem::create_directories(directoryPath_, errorCode);
+	if (errorCode)
+	{
+		DebugPrintF("Failed to create program binary cache directory. (path: %s)\n", directoryPath_.c_str());
+		binaryFormats_.clear();
+	}
+}
+
+ProgramBinaryCache::~ProgramBinaryCache()
+{
+}
+
+uint64_t ProgramBinaryCache::ComputeKey(const std::vector<ShaderStageSource>& stages) const
+{
+	uint64_t key = driverHash_;
+	for (const auto& stage : stages)
+	{
+		CHECK(stage.source != nullptr);
+
+		uint64_t sourceSize = static_cast<uint64_t>(stage.source->size());
+		HashBytes(key, &stage.type, sizeof(stage.type));
+		HashBytes(key, &sourceSize, sizeof(sourceSize));
+		HashBytes(key, stage.source->data(), stage.source->size());
+	}
+
+	return key;
+}
+
+uint32_t ProgramBinaryCache::Load(uint64_t key)
+{
+	PROFILE_SCOPE("ProgramBinaryCache::Load");
+
+	std::string path = GetFilePath(key);
+	FILE* file = std::fopen(path.c_str(), "rb");
+	if (!file)
+	{
+		++statistics_.missCount;
+		return 0;
+	}
+
+	ProgramBinaryFileHeader header;
+	std::vector<uint8_t> binary;
+
+	bool bIsValid = std::fread(&header, sizeof(header), 1, file) == 1
+		&& header.magic == CACHE_FILE_MAGIC
+		&& header.version == CACHE_FILE_VERSION
+		&& header.key == key
+		&& header.driverHash == driverHash_
+		&& header.binaryByteSize > 0
+		&& std::find(binaryFormats_.begin(), binaryFormats_.end(), static_cast<int32_t>(header.binaryFormat)) != binaryFormats_.end();
+	if (bIsValid)
+	{
+		binary.resize(header.binaryByteSize);
+		bIsValid = std::fread(binary.data(), binary.size(), 1, file) == 1;
+	}
+	std::fclose(file);
+
+	uint32_t programID = 0;
+	if (bIsValid)
+	{
+		programID = glCreateProgram();
+		GL_EXP_CHECK(programID != 0);
+
+		/** ̹ ̳ʸ źϸ GL   ũ ¸ ϹǷ, ũ ·  θ Ǵմϴ. */
+		GL_API_CHECK(glProgramBinary(programID, static_cast<GLenum>(header.binaryFormat), binary.data(), static_cast<GLsizei>(binary.size())));
+
+		int32_t status = 0;
+		GL_API_CHECK(glGetProgramiv(programID, GL_LINK_STATUS, &status));
+		if (!status)
+		{
+			GL_API_CHECK(glDeleteProgram(programID));
+			programID = 0;
+		}
+	}
+
+	if (!programID)
+	{
+		DebugPrintF("Program binary cache file is rejected. (path: %s)\n", path.c_str());
+		std::remove(path.c_str());
+		++statistics_.rejectCount;
+		return 0;
+	}
+
+	++statistics_.hitCount;
+	return programID;
+}
+
+bool ProgramBinaryCache::Store(uint64_t key, uint32_t programID)
+{
+	PROFILE_SCOPE("ProgramBinaryCache::Store");
+
+	int32_t binaryByteSize = 0;
+	GL_API_CHECK(glGetProgramiv(programID, GL_PROGRAM_BINARY_LENGTH, &binaryByteSize));
+	if (binaryByteSize <= 0)
+	{
+		return false;
+	}
+
+	std::vector<uint8_t> binary(binaryByteSize);
+	GLenum binaryFormat = 0;
+	GL_API_CHECK(glGetProgramBinary(programID, binaryByteSize, &binaryByteSize, &binaryFormat, binary.data()));
+
+	std::string path = GetFilePath(key);
+	FILE* file = std::fopen(path.c_str(), "wb");
+	if (!file)
+	{
+		DebugPrintF("Failed to open program binary cache file. (path: %s)\n", path.c_str());
+		return false;
+	}
+
+	ProgramBinaryFileHeader header = { CACHE_FILE_MAGIC, CACHE_FILE_VERSION, key, driverHash_, binaryFormat, static_cast<uint32_t>(binaryByteSize) };
+	bool bIsWritten = std::fwrite(&header, sizeof(header), 1, file) == 1 && std::fwrite(binary.data(), binaryByteSize, 1, file) == 1;
+	bIsWritten = (std::fclose(file) == 0) && bIsWritten;
+
+	if (!bIsWritten)
+	{
+		/** Ϻθ ϵ   ࿡ źε, ʿ б⸦ ϱ  ٷ մϴ. */
+		std::remove(path.c_str());
+		return false;
+	}
+
+	++statistics_.storeCount;
+	return true;
+}
+
+std::string ProgramBinaryCache::GetFilePath(uint64_t key) const
+{
+	return PrintF("%s/%016llx.bin", directoryPath_.c_str(), static_cast<unsigned long long>(key));
+}
\ No newline at end of file
@@ -0,0 +1,202 @@
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+
+#include <glad/glad.h>
+
+#include "GL/GLAssert.h"
+#include "GL/GLManager.h"
+#include "GL/RenderQueue.h"
+
+#include "Utils/Profiler.h"
+
+/**    ڸ ϴ Ʈ  ڸ Դϴ. 64Ʈ Ű 8Ʈ 8  մϴ. */
+static const uint32_t RADIX_BITS = 8;
+static const uint32_t RADIX_SIZE = (1u << RADIX_BITS);
+static const uint32_t RADIX_PASS_COUNT = 64 / RADIX_BITS;
+
+/** ݱ ߱  ť IDԴϴ. */
+static std::atomic<uint64_t> renderQueueCount = { 0 };
+
+/**  尡     ť ID  Դϴ. */
+struct ThreadCommandBufferCache
+{
+	uint64_t queueID = 0;
+	void* commandBuffer = nullptr;
+};
+
+static thread_local ThreadCommandBufferCache threadCommandBufferCache;
+
+RenderQueue::RenderQueue()
+	: queueID_(renderQueueCount.fetch_add(1) + 1)
+{
+}
+
+RenderQueue::~RenderQueue()
+{
+}
+
+void RenderQueue::Submit(const RenderCommand& command)
+{
+	GetThreadCommandBuffer().commands.push_back(command);
+}
+
+void RenderQueue::Sort()
+{
+	PROFILE_SCOPE("RenderQueue::Sort");
+
+	commands_.clear();
+	for (const auto& threadCommandBuffer : threadCommandBuffers_)
+	{
+		commands_.insert(commands_.end(), threadCommandBuffer->commands.begin(), threadCommandBuffer->commands.end());
+	}
+
+	uint32_t commandCount = static_cast<uint32_t>(commands_.size());
+	sortEntries_.resize(commandCount);
+	sortBuffer_.resize(commandCount);
+
+	/**  ڸ ׷   ȸ մϴ. */
+	std::array<std::array<uint32_t, RADIX_SIZE>, RADIX_PASS_COUNT> histograms;
+	std::memset(histograms.data(), 0, sizeof(histograms));
+
+	for (uint32_t index = 0; index < commandCount; ++index)
+	{
+		uint64_t sortKey = commands_[index].sortKey;
+		sortEntries_[index] = { sortKey, index };
+
+		for (uint32_t pass = 0; pass < RADIX_PASS_COUNT; ++pass)
+		{
+			++histograms[pass][(sortKey >> (pass * RADIX_BITS)) & (RADIX_SIZE - 1)];
+		}
+	}
+
+	/**  ڸ  (LSD)մϴ.  Ű   ڸ(: κ   н) ǳʶݴϴ. */
+	SortEntry* source = sortEntries_.data();
+	SortEntry* destination = sortBuffer_.data();
+	for (uint32_t pass = 0; pass < RADIX_PASS_COUNT && commandCount > 0; ++pass)
+	{
+		std::array<uint32_t, RADIX_SIZE>& histogram = histograms[pass];
+		uint32_t shift = pass * RADIX_BITS;
+
+		if (histogram[(source[0].sortKey >> shift) & (RADIX_SIZE - 1)] == commandCount)
+		{
+			continue;
+		}
+
+		uint32_t offset = 0;
+		for (auto& count : histogram)
+		{
+			uint32_t bucketCount = count;
+			count = offset;
+			offset += bucketCount;
+		}
+
+		for (uint32_t index = 0; index < commandCount; ++index)
+		{
+			const SortEntry& entry = source[index];
+			destination[histogram[(entry.sortKey >> shift) & (RADIX_SIZE - 1)]++] = entry;
+		}
+
+		std::swap(source, destination);
+	}
+
+	if (source != sortEntries_.data())
+	{
+		sortEntries_.swap(sortBuffer_);
+	}
+}
+
+void RenderQueue::Execute()
+{
+	PROFILE_SCOPE("RenderQueue::Execute");
+
+	GLManager& glManager = GLManager::GetRef();
+
+	statistics_ = RenderQueueStatistics();
+	statistics_.commandCount = GetCommandCount();
+
+	const RenderCommand* prevCommand = nullptr;
+	for (const auto& entry : sortEntries_)
+	{
+		const RenderCommand& command = commands_[entry.commandIndex];
+
+		if (!prevCommand || prevCommand->programID != command.programID)
+		{
+			glManager.UseProgram(command.programID);
+			++statistics_.programChangeCount;
+		}
+
+		if (!prevCommand || prevCommand->vertexArrayID != command.vertexArrayID)
+		{
+			glManager.BindVertexArray(command.vertexArrayID);
+			++statistics_.vertexArrayChangeCount;
+		}
+
+		if (command.textureID != 0 && (!prevCommand || prevCommand->textureID != command.textureID))
+		{
+			glManager.BindTexture(0, GL_TEXTURE_2D, command.textureID);
+			++statistics_.textureChangeCount;
+		}
+
+		bool bIsUniformBufferChanged = !prevCommand
+			|| prevCommand->uniformBufferID != command.uniformBufferID
+			|| prevCommand->uniformOffset != command.uniformOffset
+			|| prevCommand->uniformByteSize != command.uniformByteSize;
+		if (command.uniformByteSize > 0 && bIsUniformBufferChanged)
+		{
+			glManager.BindBufferRange(GL_UNIFORM_BUFFER, DRAW_UNIFORM_BUFFER_SLOT, command.uniformBufferID, command.uniformOffset, command.uniformByteSize);
+			++statistics_.uniformBufferChangeCount;
+		}
+
+		const void* indexOffset = reinterpret_cast<const void*>(static_cast<uintptr_t>(command.firstIndex) * IndexBuffer::GetIndexSize(command.indexType));
+		GL_API_CHECK(glDrawElementsInstancedBaseVertex(GL_TRIANGLES, static_cast<GLsizei>(command.indexCount), static_cast<GLenum>(command.indexType), indexOffset, static_cast<GLsizei>(command.instanceCount), command.baseVertex));
+
+		prevCommand = &command;
+	}
+}
+
+void RenderQueue::Reset()
+{
+	for (auto& threadCommandBuffer : threadCommandBuffers_)
+	{
+		threadCommandBuffer->commands.clear();
+	}
+
+	commands_.clear();
+	sortEntries_.clear();
+}
+
+RenderQueue::ThreadCommandBuffer& RenderQueue::GetThreadCommandBuffer()
+{
+	if (threadCommandBufferCache.queueID == queueID_)
+	{
+		return *reinterpret_cast<ThreadCommandBuffer*>(threadCommandBufferCache.commandBuffer);
+	}
+
+	std::thread::id threadID = std::this_thread::get_id();
+	ThreadCommandBuffer* commandBuffer = nullptr;
+	{
+		std::lock_guard<std::mutex> lock(threadCommandBuffersMutex_);
+		for (auto& threadCommandBuffer : threadCommandBuffers_)
+		{
+			if (threadCommandBuffer->threadID == threadID)
+			{
+				commandBuffer = threadCommandBuffer.get();
+				break;
+			}
+		}
+
+		if (!commandBuffer)
+		{
+			threadCommandBuffers_.push_back(std::make_unique<ThreadCommandBuffer>());
+			commandBuffer = threadCommandBuffers_.back().get();
+			commandBuffer->threadID = threadID;
+		}
+	}
+
+	threadCommandBufferCache.queueID = queueID_;
+	threadCommandBufferCache.commandBuffer = commandBuffer;
+	return *commandBuffer;
+}
\ No newline at end of file
@@ -1,63 +1,45 @@
 #include <glad/glad.h>
+#include <glm/gtc/type_ptr.hpp>
 
 #include "GL/GLAssert.h"
+#include "GL/GLManager.h"
+#include "GL/ProgramBinaryCache.h"
 #include "GL/Shader.h"
 #include "Utils/Assertion.h"
+#include "Utils/Profiler.h"
+
+/** GL_KHR_parallel_shader_compile Ϸ  ȸ Դϴ. GL_ARB_parallel_shader_compile GL_COMPLETION_STATUS_ARB  Դϴ. */
+#if !defined(GL_COMPLETION_STATUS_KHR)
+#define GL_COMPLETION_STATUS_KHR 0x91B1
+#endif
 
 static const uint32_t MAX_STRING_BUFFER = 1024;
 
 Shader::Shader(const std::string& csSource)
 {
-	uint32_t csID = CreateShader(EType::COMPUTE, reinterpret_cast<const char*>(csSource.data()));
-	GL_EXP_CHECK(csID != 0);
-
-	std::vector<uint32_t> shaderIDs = { csID };
-	programID_ = CreateProgram(shaderIDs);
-	GL_EXP_CHECK(programID_ != 0);
-
-	GL_API_CHECK(glDeleteShader(csID));
-
-	bIsInitialized_ = true;
+	Submit({ { static_cast<uint32_t>(EType::COMPUTE), &csSource } });
+	WaitCompletion();
 }
 
 Shader::Shader(const std::string& vsSource, const std::string& fsSource)
 {
-	uint32_t vsID = CreateShader(EType::VERTEX, reinterpret_cast<const char*>(vsSource.data()));
-	GL_EXP_CHECK(vsID != 0);
-
-	uint32_t fsID = CreateShader(EType::FRAGMENT, reinterpret_cast<const char*>(fsSource.data()));
-	GL_EXP_CHECK(fsID != 0);
-
-	std::vector<uint32_t> shaderIDs = { vsID, fsID };
-	programID_ = CreateProgram(shaderIDs);
-	GL_EXP_CHECK(programID_ != 0);
-
-	GL_API_CHECK(glDeleteShader(vsID));
-	GL_API_CHECK(glDeleteShader(fsID));
-
-	bIsInitialized_ = true;
+	Submit({ { static_cast<uint32_t>(EType::VERTEX), &vsSource }, { static_cast<uint32_t>(EType::FRAGMENT), &fsSource } });
+	WaitCompletion();
 }
 
 Shader::Shader(const std::string& vsSource, const std::string& gsSource, const std::string& fsSource)
 {
-	uint32_t vsID = CreateShader(EType::VERTEX, reinterpret_cast<const char*>(vsSource.data()));
-	GL_EXP_CHECK(vsID != 0);
-
-	uint32_t gsID = CreateShader(EType::GEOMETRY, reinterpret_cast<const char*>(gsSource.data()));
-	GL_EXP_CHECK(gsID != 0);
-
-	uint32_t fsID = CreateShader(EType::FRAGMENT, reinterpret_cast<const char*>(fsSource.data()));
-	GL_EXP_CHECK(fsID != 0);
-
-	std::vector<uint32_t> shaderIDs = { vsID, gsID, fsID };
-	programID_ = CreateProgram(shaderIDs);
-	GL_EXP_CHECK(programID_ != 0);
-
-	GL_API_CHECK(glDeleteShader(vsID));
-	GL_API_CHECK(glDeleteShader(gsID));
-	GL_API_CHECK(glDeleteShader(fsID));
+	Submit({ { static_cast<uint32_t>(EType::VERTEX), &vsSource }, { static_cast<uint32_t>(EType::GEOMETRY), &gsSource }, { static_cast<uint32_t>(EType::FRAGMENT), &fsSource } });
+	WaitCompletion();
+}
 
-	bIsInitialized_ = true;
+Shader::Shader(const std::vector<ShaderStageSource>& stages, const ECompileMode& compileMode)
+{
+	Submit(stages);
+	if (compileMode == ECompileMode::SYNCHRONOUS)
+	{
+		WaitCompletion();
+	}
 }
 
 Shader::~Shader()
@@ -72,68 +54,339 @@ void Shader::Release()
 {
 	CHECK(bIsInitialized_);
 
+	for (const uint32_t shaderID : shaderIDs_) /**    ϴ . */
+	{
+		GL_API_CHECK(glDeleteShader(shaderID));
+	}
+	shaderIDs_.clear();
+
 	if (programID_) /** ̴ α׷ Ҵ翡 ߴٸ 0 ƴ  Ҵ. */
 	{
+		GLManager::GetRef().OnDeleteProgram(programID_);
 		GL_API_CHECK(glDeleteProgram(programID_));
 		programID_ = 0;
 	}
 
+	uniforms_.Clear();
+	uniformBlocks_.Clear();
+	storageBlocks_.Clear();
+
+	bIsReady_ = false;
 	bIsInitialized_ = false;
 }
 
 void Shader::Bind()
 {
-	GL_API_CHECK(glUseProgram(programID_));
+	WaitCompletion();
+	GLManager::GetRef().UseProgram(programID_);
 }
 
 void Shader::Unbind()
 {
-	GL_API_CHECK(glUseProgram(0));
+	GLManager::GetRef().UseProgram(0);
 }
 
-uint32_t Shader::CreateShader(const EType& type, const char* sourcePtr)
+const ShaderUniform* Shader::FindUniform(const NameID& name) const
 {
-	uint32_t shaderID = glCreateShader(static_cast<GLenum>(type));
-	GL_EXP_CHECK(shaderID != 0);
+	CHECK(bIsReady_);
+	return uniforms_.Find(name);
+}
 
-	GL_API_CHECK(glShaderSource(shaderID, 1, &sourcePtr, nullptr));
-	GL_API_CHECK(glCompileShader(shaderID));
+const ShaderBlock* Shader::FindUniformBlock(const NameID& name) const
+{
+	CHECK(bIsReady_);
+	return uniformBlocks_.Find(name);
+}
+
+const ShaderBlock* Shader::FindStorageBlock(const NameID& name) const
+{
+	CHECK(bIsReady_);
+	return storageBlocks_.Find(name);
+}
+
+int32_t Shader::GetUniformLocation(const NameID& name) const
+{
+	const ShaderUniform* uniform = FindUniform(name);
+	return uniform ? uniform->location : -1;
+}
+
+void Shader::SetUniformBlockBinding(const NameID& name, uint32_t binding)
+{
+	ShaderBlock* block = uniformBlocks_.Find(name);
+	if (block && block->binding != binding)
+	{
+		GL_API_CHECK(glUniformBlockBinding(programID_, block->index, binding));
+		block->binding = binding;
+	}
+}
+
+void Shader::SetStorageBlockBinding(const NameID& name, uint32_t binding)
+{
+	ShaderBlock* block = storageBlocks_.Find(name);
+	if (block && block->binding != binding)
+	{
+		GL_API_CHECK(glShaderStorageBlockBinding(programID_, block->index, binding));
+		block->binding = binding;
+	}
+}
+
+void Shader::SetUniform(const NameID& name, int32_t value)
+{
+	int32_t location = GetUniformLocation(name);
+	if (location >= 0)
+	{
+		GL_API_CHECK(glProgramUniform1i(programID_, location, value));
+	}
+}
+
+void Shader::SetUniform(const NameID& name, uint32_t value)
+{
+	int32_t location = GetUniformLocation(name);
+	if (location >= 0)
+	{
+		GL_API_CHECK(glProgramUniform1ui(programID_, location, value));
+	}
+}
+
+void Shader::SetUniform(const NameID& name, float value)
+{
+	int32_t location = GetUniformLocation(name);
+	if (location >= 0)
+	{
+		GL_API_CHECK(glProgramUniform1f(programID_, location, value));
+	}
+}
+
+void Shader::SetUniform(const NameID& name, const glm::vec2& value)
+{
+	int32_t location = GetUniformLocation(name);
+	if (location >= 0)
+	{
+		GL_API_CHECK(glProgramUniform2fv(programID_, location, 1, glm::value_ptr(value)));
+	}
+}
+
+void Shader::SetUniform(const NameID& name, const glm::vec3& value)
+{
+	int32_t location = GetUniformLocation(name);
+	if (location >= 0)
+	{
+		GL_API_CHECK(glProgramUniform3fv(programID_, location, 1, glm::value_ptr(value)));
+	}
+}
+
+void Shader::SetUniform(const NameID& name, const glm::vec4& value)
+{
+	int32_t location = GetUniformLocation(name);
+	if (location >= 0)
+	{
+		GL_API_CHECK(glProgramUniform4fv(programID_, location, 1, glm::value_ptr(value)));
+	}
+}
+
+void Shader::SetUniform(const NameID& name, const glm::mat3& value)
+{
+	int32_t location = GetUniformLocation(name);
+	if (location >= 0)
+	{
+		GL_API_CHECK(glProgramUniformMatrix3fv(programID_, location, 1, GL_FALSE, glm::value_ptr(value)));
+	}
+}
+
+void Shader::SetUniform(const NameID& name, const glm::mat4& value)
+{
+	int32_t location = GetUniformLocation(name);
+	if (location >= 0)
+	{
+		GL_API_CHECK(glProgramUniformMatrix4fv(programID_, location, 1, GL_FALSE, glm::value_ptr(value)));
+	}
+}
+
+bool Shader::PollCompletion()
+{
+	if (bIsReady_)
+	{
+		return true;
+	}
+
+	/**    ʴ ̹ Ϸ θ   Ƿ,  ٷ ˻մϴ(ŷ). */
+	if (GLManager::GetRef().IsParallelShaderCompileSupported())
+	{
+		int32_t bIsCompleted = 0;
+		GL_API_CHECK(glGetProgramiv(programID_, GL_COMPLETION_STATUS_KHR, &bIsCompleted));
+		if (!bIsCompleted)
+		{
+			return false;
+		}
+	}
+
+	Finalize();
+	return true;
+}
+
+void Shader::WaitCompletion()
+{
+	if (!bIsReady_)
+	{
+		Finalize();
+	}
+}
+
+void Shader::Submit(const std::vector<ShaderStageSource>& stages)
+{
+	PROFILE_SCOPE("Shader::Submit");
+
+	CHECK(!stages.empty());
+
+	ProgramBinaryCache* programBinaryCache = GLManager::GetRef().GetProgramBinaryCache();
+	if (programBinaryCache)
+	{
+		cacheKey_ = programBinaryCache->ComputeKey(stages);
+		programID_ = programBinaryCache->Load(cacheKey_);
+	}
+
+	bIsInitialized_ = true;
+
+	if (programID_) /** ĳõ ̳ʸ  α׷  ʿ ϴ. */
+	{
+		Reflect();
+		bIsReady_ = true;
+		return;
+	}
+
+	for (const auto& stage : stages)
+	{
+		uint32_t shaderID = CreateShader(static_cast<EType>(stage.type), stage.source->c_str());
+		GL_EXP_CHECK(shaderID != 0);
+
+		shaderIDs_.push_back(shaderID);
+	}
+
+	programID_ = CreateProgram(shaderIDs_, programBinaryCache != nullptr);
+	GL_EXP_CHECK(programID_ != 0);
+}
+
+void Shader::Finalize()
+{
+	PROFILE_SCOPE("Shader::Finalize");
 
 	int32_t status;
-	GL_API_CHECK(glGetShaderiv(shaderID, GL_COMPILE_STATUS, &status));
+	for (const uint32_t shaderID : shaderIDs_)
+	{
+		GL_API_CHECK(glGetShaderiv(shaderID, GL_COMPILE_STATUS, &status));
+		if (!status)
+		{
+			char buffer[MAX_STRING_BUFFER];
+
+			GL_API_CHECK(glGetShaderInfoLog(shaderID, MAX_STRING_BUFFER, nullptr, buffer));
+			ASSERT(false, "Failed to compile shader\n%s", buffer);
+		}
+	}
+
+	GL_API_CHECK(glGetProgramiv(programID_, GL_LINK_STATUS, &status));
 	if (!status)
 	{
 		char buffer[MAX_STRING_BUFFER];
 
-		GL_API_CHECK(glGetShaderInfoLog(shaderID, MAX_STRING_BUFFER, nullptr, buffer));
-		ASSERT(false, "Failed to compile shader\n%s", buffer);
+		GL_API_CHECK(glGetProgramInfoLog(programID_, MAX_STRING_BUFFER, nullptr, buffer));
+		ASSERT(false, "Failed to link shader program\n%s", buffer);
+	}
+
+	for (const uint32_t shaderID : shaderIDs_)
+	{
+		GL_API_CHECK(glDeleteShader(shaderID));
 	}
+	shaderIDs_.clear();
+
+	if (ProgramBinaryCache* programBinaryCache = GLManager::GetRef().GetProgramBinaryCache())
+	{
+		programBinaryCache->Store(cacheKey_, programID_);
+	}
+
+	Reflect();
+	bIsReady_ = true;
+}
+
+void Shader::Reflect()
+{
+	PROFILE_SCOPE("Shader::Reflect");
+
+	char name[MAX_STRING_BUFFER];
+
+	/** ⺻   ġ Ƿ, Ͽ  ( ε -1 ƴ ) մϴ. */
+	int32_t uniformCount = 0;
+	GL_API_CHECK(glGetProgramInterfaceiv(programID_, GL_UNIFORM, GL_ACTIVE_RESOURCES, &uniformCount));
+	for (int32_t index = 0; index < uniformCount; ++index)
+	{
+		static const GLenum UNIFORM_PROPERTIES[] = { GL_BLOCK_INDEX, GL_LOCATION, GL_TYPE, GL_ARRAY_SIZE };
+		int32_t values[4];
+		GL_API_CHECK(glGetProgramResourceiv(programID_, GL_UNIFORM, index, 4, UNIFORM_PROPERTIES, 4, nullptr, values));
+		if (values[0] != -1 || values[1] < 0)
+		{
+			continue;
+		}
+
+		GL_API_CHECK(glGetProgramResourceName(programID_, GL_UNIFORM, index, MAX_STRING_BUFFER, nullptr, name));
+
+		ShaderUniform uniform = { values[1], static_cast<uint32_t>(values[2]), values[3] };
+		std::string uniformName = name;
+		uniforms_.Insert(NameID(uniformName), uniform);
+
+		/** 迭  ̸ "name[0]"̹Ƿ, 迭 ̸ε ã  ֵ Բ մϴ. */
+		static const std::string ARRAY_SUFFIX = "[0]";
+		if (uniformName.size() > ARRAY_SUFFIX.size() && uniformName.compare(uniformName.size() - ARRAY_SUFFIX.size(), ARRAY_SUFFIX.size(), ARRAY_SUFFIX) == 0)
+		{
+			uniforms_.Insert(NameID(uniformName.substr(0, uniformName.size() - ARRAY_SUFFIX.size())), uniform);
+		}
+	}
+
+	static const GLenum BLOCK_PROPERTIES[] = { GL_BUFFER_BINDING, GL_BUFFER_DATA_SIZE };
+	static const GLenum BLOCK_INTERFACES[] = { GL_UNIFORM_BLOCK, GL_SHADER_STORAGE_BLOCK };
+	for (const GLenum blockInterface : BLOCK_INTERFACES)
+	{
+		FlatHashMap<NameID, ShaderBlock>& blocks = (blockInterface == GL_UNIFORM_BLOCK) ? uniformBlocks_ : storageBlocks_;
+
+		int32_t blockCount = 0;
+		GL_API_CHECK(glGetProgramInterfaceiv(programID_, blockInterface, GL_ACTIVE_RESOURCES, &blockCount));
+		for (int32_t index = 0; index < blockCount; ++index)
+		{
+			int32_t values[2];
+			GL_API_CHECK(glGetProgramResourceiv(programID_, blockInterface, index, 2, BLOCK_PROPERTIES, 2, nullptr, values));
+			GL_API_CHECK(glGetProgramResourceName(programID_, blockInterface, index, MAX_STRING_BUFFER, nullptr, name));
+
+			blocks.Insert(NameID(std::string(name)), { static_cast<uint32_t>(index), static_cast<uint32_t>(values[0]), static_cast<uint32_t>(values[1]) });
+		}
+	}
+}
+
+uint32_t Shader::CreateShader(const EType& type, const char* sourcePtr)
+{
+	uint32_t shaderID = glCreateShader(static_cast<GLenum>(type));
+	GL_EXP_CHECK(shaderID != 0);
+
+	GL_API_CHECK(glShaderSource(shaderID, 1, &sourcePtr, nullptr));
+	GL_API_CHECK(glCompileShader(shaderID));
 
 	return shaderID;
 }
 
-uint32_t Shader::CreateProgram(const std::vector<uint32_t>& shaderIDs)
+uint32_t Shader::CreateProgram(const std::vector<uint32_t>& shaderIDs, bool bIsRetrievable)
 {
 	CHECK(shaderIDs.size() > 0);
 
 	uint32_t programID = glCreateProgram();
 	GL_EXP_CHECK(programID != 0);
 
-	for (const uint32_t shaderID : shaderIDs)
+	if (bIsRetrievable) /** Ϻ ̹ ũ   Ʈ ؾ glGetProgramBinary ̳ʸ   ֽϴ. */
 	{
-		GL_API_CHECK(glAttachShader(programID, shaderID));
+		GL_API_CHECK(glProgramParameteri(programID, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE));
 	}
-	GL_API_CHECK(glLinkProgram(programID));
 
-	int32_t status;
-	GL_API_CHECK(glGetProgramiv(programID, GL_LINK_STATUS, &status));
-	if (!status)
+	for (const uint32_t shaderID : shaderIDs)
 	{
-		char buffer[MAX_STRING_BUFFER];
-
-		GL_API_CHECK(glGetProgramInfoLog(programID_, MAX_STRING_BUFFER, nullptr, buffer));
-		ASSERT(false, "Failed to link shader program\n%s", buffer);
+		GL_API_CHECK(glAttachShader(programID, shaderID));
 	}
+	GL_API_CHECK(glLinkProgram(programID));
 
 	return programID;
 }
\ No newline at end of file
@@ -0,0 +1,69 @@
+#include <glad/glad.h>
+
+#include "GL/GLManager.h"
+#include "GL/ShaderCompileBatch.h"
+#include "Utils/Profiler.h"
+
+Shader* ShaderCompileBatch::Add(const std::vector<ShaderStageSource>& stages)
+{
+	GLManager& glManager = GLManager::GetRef();
+
+	GLHandle<Shader> handle = glManager.CreateHandle<Shader>(stages, Shader::ECompileMode::ASYNCHRONOUS);
+	Shader* shader = glManager.Get(handle);
+	if (!shader->IsReady()) /** α׷ ̳ʸ ĳ÷  ̴ ̹ Ϸ Դϴ. */
+	{
+		pendingShaders_.push_back(handle);
+	}
+
+	++shaderCount_;
+	return shader;
+}
+
+Shader* ShaderCompileBatch::Add(const std::string& vsSource, const std::string& fsSource)
+{
+	return Add({ { GL_VERTEX_SHADER, &vsSource }, { GL_FRAGMENT_SHADER, &fsSource } });
+}
+
+bool ShaderCompileBatch::Poll()
+{
+	PROFILE_SCOPE("ShaderCompileBatch::Poll");
+
+	GLManager& glManager = GLManager::GetRef();
+	bool bIsParallelShaderCompileSupported = glManager.IsParallelShaderCompileSupported();
+
+	for (std::size_t index = 0; index < pendingShaders_.size();)
+	{
+		Shader* shader = glManager.Get(pendingShaders_[index]);
+		if (shader && !shader->PollCompletion())
+		{
+			++index;
+			continue;
+		}
+
+		pendingShaders_[index] = pendingShaders_.back();
+		pendingShaders_.pop_back();
+
+		if (shader && !bIsParallelShaderCompileSupported)
+		{
+			break; //  ٷ ϷǷ,  α׷  ӿ Ȯ.
+		}
+	}
+
+	return pendingShaders_.empty();
+}
+
+void ShaderCompileBatch::Wait()
+{
+	PROFILE_SCOPE("ShaderCompileBatch::Wait");
+
+	GLManager& glManager = GLManager::GetRef();
+	for (const auto& handle : pendingShaders_)
+	{
+		if (Shader* shader = glManager.Get(handle))
+		{
+			shader->WaitCompletion();
+		}
+	}
+
+	pendingShaders_.clear();
+}
\ No newline at end of file
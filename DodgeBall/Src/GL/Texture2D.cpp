@@ -1,14 +1,16 @@
 #pragma warning(push)
 #pragma warning(disable: 26451)
 
-#include <map>
-#include <vector>
+#include <algorithm>
 
 #include <glad/glad.h>
 #include <stb_image.h>
 
 #include "GL/GLAssert.h"
+#include "GL/GLManager.h"
 #include "GL/Texture2D.h"
+#include "GL/TextureContainer.h"
+#include "GL/TextureLoader.h"
 #include "Utils/Assertion.h"
 #include "Utils/Utils.h"
 
@@ -17,8 +19,41 @@
 #define PIXEL_FORMAT_RGB  3
 #define PIXEL_FORMAT_RGBA 4
 
+/** S3TC ھ  ƴϾ glad  ǵǾ  Ƿ, Ȯ    մϴ. */
+#ifndef GL_COMPRESSED_RGB_S3TC_DXT1_EXT
+#define GL_COMPRESSED_RGB_S3TC_DXT1_EXT  0x83F0
+#endif
+#ifndef GL_COMPRESSED_RGBA_S3TC_DXT5_EXT
+#define GL_COMPRESSED_RGBA_S3TC_DXT5_EXT 0x83F3
+#endif
+
+/** ä  ϴ Һ    İ ȼ  Դϴ. ε ä  - 1Դϴ. */
+static const GLenum INTERNAL_FORMATS[] = { GL_R8, GL_RG8, GL_RGB8, GL_RGBA8 };
+static const GLenum PIXEL_FORMATS[] = { GL_RED, GL_RG, GL_RGB, GL_RGBA };
+
+/**   (ECompressedFormat) ϴ   Դϴ. ε   - 1Դϴ. */
+static const GLenum COMPRESSED_INTERNAL_FORMATS[] = { GL_COMPRESSED_RGB_S3TC_DXT1_EXT, GL_COMPRESSED_RGBA_S3TC_DXT5_EXT, GL_COMPRESSED_RED_RGTC1, GL_COMPRESSED_RG_RGTC2 };
+
 Texture2D::Texture2D(const std::string& path, const EFilter& filter)
-	: textureID_(CreateTextureFromImage(path, filter))
+	: filter_(filter)
+	, path_(path)
+{
+	std::string extension = TextureContainer::FILE_EXTENSION;
+	if (path.size() > extension.size() && path.compare(path.size() - extension.size(), extension.size(), extension) == 0)
+	{
+		CreateTextureFromContainer(path);
+	}
+	else
+	{
+		CreateTextureFromImage(path);
+	}
+
+	bIsResident_ = true;
+	bIsInitialized_ = true;
+}
+
+Texture2D::Texture2D(const EFilter& filter)
+	: filter_(filter)
 {
 	bIsInitialized_ = true;
 }
@@ -35,55 +70,202 @@ void Texture2D::Release()
 {
 	CHECK(bIsInitialized_);
 
-	GL_API_CHECK(glDeleteTextures(1, &textureID_));
+	if (textureID_) /** 񵿱 ε  ؽó      . */
+	{
+		GLManager::GetRef().OnDeleteTexture(textureID_);
+		GL_API_CHECK(glDeleteTextures(1, &textureID_));
+		textureID_ = 0;
+	}
 
+	bIsResident_ = false;
 	bIsInitialized_ = false;
 }
 
 void Texture2D::Active(uint32_t unit) const
 {
-	GL_API_CHECK(glActiveTexture(GL_TEXTURE0 + unit));
-	GL_API_CHECK(glBindTexture(GL_TEXTURE_2D, textureID_));
+	GLManager::GetRef().BindTexture(unit, GL_TEXTURE_2D, GetBindingTextureID());
+}
+
+uint32_t Texture2D::GetBindingTextureID() const
+{
+	return bIsResident_ ? textureID_ : TextureLoader::GetRef().GetPlaceholderTextureID();
+}
+
+int32_t Texture2D::GetMipLevelCount(int32_t width, int32_t height)
+{
+	int32_t mipLevelCount = 1;
+	for (int32_t size = std::max(width, height); size > 1; size >>= 1)
+	{
+		++mipLevelCount;
+	}
+
+	return mipLevelCount;
+}
+
+uint64_t Texture2D::GetGPUMemoryByteSize(int32_t residentMipLevel) const
+{
+	/** ̹ 3ä(RGB8) ؼ 4Ʈ ؼ ϹǷ, 4Ʈ մϴ. */
+	uint64_t texelByteSize = (channels_ == PIXEL_FORMAT_RGB) ? 4 : static_cast<uint64_t>(channels_);
+
+	uint64_t byteSize = 0;
+	for (int32_t level = residentMipLevel; level < mipLevelCount_; ++level)
+	{
+		int32_t width = std::max(width_ >> level, 1);
+		int32_t height = std::max(height_ >> level, 1);
+
+		if (bIsCompressed_)
+		{
+			byteSize += TextureContainer::GetLevelByteSize(compressedFormat_, width, height);
+		}
+		else
+		{
+			byteSize += static_cast<uint64_t>(width) * static_cast<uint64_t>(height) * texelByteSize;
+		}
+	}
+
+	return byteSize;
+}
+
+void Texture2D::EvictMipLevels(int32_t residentMipLevel)
+{
+	CHECK(bIsResident_ && residentMipLevel > residentMipLevel_ && residentMipLevel < mipLevelCount_);
+
+	uint32_t textureID = CreateMipLevelStorage(residentMipLevel);
+	CopyMipLevels(textureID_, residentMipLevel_, textureID, residentMipLevel, residentMipLevel, mipLevelCount_);
+
+	GLManager::GetRef().OnDeleteTexture(textureID_);
+	GL_API_CHECK(glDeleteTextures(1, &textureID_));
+
+	textureID_ = textureID;
+	residentMipLevel_ = residentMipLevel;
 }
 
-uint32_t Texture2D::CreateTextureFromImage(const std::string& path, const EFilter& filter)
+void Texture2D::ReplaceMipLevelStorage(uint32_t textureID, int32_t residentMipLevel)
 {
-	uint8_t* imagePtr = stbi_load(path.c_str(), &width_, &height_, &channels_, 0);
+	CHECK(bIsResident_ && textureID != 0 && residentMipLevel >= 0 && residentMipLevel < residentMipLevel_);
+
+	CopyMipLevels(textureID_, residentMipLevel_, textureID, residentMipLevel, residentMipLevel_, mipLevelCount_);
+
+	GLManager::GetRef().OnDeleteTexture(textureID_);
+	GL_API_CHECK(glDeleteTextures(1, &textureID_));
+
+	textureID_ = textureID;
+	residentMipLevel_ = residentMipLevel;
+}
+
+void Texture2D::CreateTextureStorage(int32_t width, int32_t height, int32_t channels)
+{
+	CHECK(channels >= PIXEL_FORMAT_R && channels <= PIXEL_FORMAT_RGBA);
+
+	pixelFormat_ = PIXEL_FORMATS[channels - 1];
+	CreateTextureStorage(width, height, channels, INTERNAL_FORMATS[channels - 1], GetMipLevelCount(width, height));
+}
+
+void Texture2D::CreateTextureStorage(int32_t width, int32_t height, int32_t channels, uint32_t internalFormat, int32_t mipLevelCount)
+{
+	CHECK(textureID_ == 0 && width > 0 && height > 0 && mipLevelCount > 0);
+
+	width_ = width;
+	height_ = height;
+	channels_ = channels;
+	internalFormat_ = internalFormat;
+	mipLevelCount_ = mipLevelCount;
+	residentMipLevel_ = 0;
+
+	textureID_ = CreateMipLevelStorage(residentMipLevel_);
+}
+
+uint32_t Texture2D::CreateMipLevelStorage(int32_t residentMipLevel) const
+{
+	int32_t width = std::max(width_ >> residentMipLevel, 1);
+	int32_t height = std::max(height_ >> residentMipLevel, 1);
+
+	float borderColor[] = { 0.0f, 0.0f, 0.0f, 0.0f };
+
+	/**  ʹ Ӹ ϴ ͷ մϴ. Ӹ  ϸ ָ ִ ؽó Դϴ. */
+	GLint minFilter = (filter_ == EFilter::NEAREST) ? GL_NEAREST_MIPMAP_NEAREST : GL_LINEAR_MIPMAP_LINEAR;
+
+	uint32_t textureID = 0;
+	GL_API_CHECK(glCreateTextures(GL_TEXTURE_2D, 1, &textureID));
+	GL_API_CHECK(glTextureStorage2D(textureID, mipLevelCount_ - residentMipLevel, internalFormat_, width, height));
+	GL_API_CHECK(glTextureParameteri(textureID, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_BORDER));
+	GL_API_CHECK(glTextureParameteri(textureID, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_BORDER));
+	GL_API_CHECK(glTextureParameterfv(textureID, GL_TEXTURE_BORDER_COLOR, borderColor));
+	GL_API_CHECK(glTextureParameteri(textureID, GL_TEXTURE_MIN_FILTER, minFilter));
+	GL_API_CHECK(glTextureParameteri(textureID, GL_TEXTURE_MAG_FILTER, static_cast<GLint>(filter_)));
+
+	return textureID;
+}
+
+void Texture2D::CopyMipLevels(uint32_t sourceID, int32_t sourceBaseLevel, uint32_t destinationID, int32_t destinationBaseLevel, int32_t beginLevel, int32_t endLevel) const
+{
+	for (int32_t level = beginLevel; level < endLevel; ++level)
+	{
+		int32_t width = std::max(width_ >> level, 1);
+		int32_t height = std::max(height_ >> level, 1);
+		GL_API_CHECK(glCopyImageSubData(sourceID, GL_TEXTURE_2D, level - sourceBaseLevel, 0, 0, 0, destinationID, GL_TEXTURE_2D, level - destinationBaseLevel, 0, 0, 0, width, height, 1));
+	}
+}
+
+void Texture2D::CreateTextureFromImage(const std::string& path)
+{
+	/** ڵ   ʰ ٷ εϹǷ, ڵ ̹    ߰ ޸𸮸  ʽϴ. */
+	int32_t width = 0;
+	int32_t height = 0;
+	int32_t channels = 0;
+	uint8_t* imagePtr = stbi_load(path.c_str(), &width, &height, &channels, 0);
 	ASSERT(imagePtr != nullptr, "Failed to load %s file.", path.c_str());
 
-	std::size_t bufferSize = static_cast<std::size_t>(width_ * height_ * channels_);
-	std::vector<uint8_t> buffer(bufferSize);
-	std::copy(imagePtr, imagePtr + bufferSize, buffer.data());
+	CreateTextureStorage(width, height, channels);
+	UploadImage(textureID_, imagePtr);
 
 	stbi_image_free(imagePtr);
 	imagePtr = nullptr;
 
-	static std::map<uint32_t, uint32_t> formats =
+	GL_API_CHECK(glGenerateTextureMipmap(textureID_));
+}
+
+void Texture2D::UploadImage(uint32_t textureID, const uint8_t* imagePtr) const
+{
+	GLManager::GetRef().BindBuffer(GL_PIXEL_UNPACK_BUFFER, 0); // Ŭ̾Ʈ ޸𸮿 ε.
+
+	/** stb_image   ̿  Ƿ,  ũⰡ 4  ƴϸ   1 ϴ. */
+	bool bIsUnaligned = ((width_ * channels_) % 4) != 0;
+	if (bIsUnaligned)
 	{
-		{ PIXEL_FORMAT_R,    GL_RED  },
-		{ PIXEL_FORMAT_RG,   GL_RG   },
-		{ PIXEL_FORMAT_RGB,  GL_RGB  },
-		{ PIXEL_FORMAT_RGBA, GL_RGBA },
-	};
-
-	GLenum format = formats.at(channels_);
-	const void* bufferPtr = reinterpret_cast<const void*>(buffer.data());
-	uint32_t textureID = 0;
+		GL_API_CHECK(glPixelStorei(GL_UNPACK_ALIGNMENT, 1));
+	}
 
-	float borderColor[] = { 0.0f, 0.0f, 0.0f, 0.0f };
+	GL_API_CHECK(glTextureSubImage2D(textureID, 0, 0, 0, width_, height_, pixelFormat_, GL_UNSIGNED_BYTE, imagePtr));
 
-	GL_API_CHECK(glGenTextures(1, &textureID));
-	GL_API_CHECK(glBindTexture(GL_TEXTURE_2D, textureID));
-	GL_API_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_BORDER));
-	GL_API_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_BORDER));
-	GL_API_CHECK(glTexParameterfv(GL_TEXTURE_2D, GL_TEXTURE_BORDER_COLOR, borderColor));
-	GL_API_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, static_cast<GLint>(filter)));
-	GL_API_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, static_cast<GLint>(filter)));
-	GL_API_CHECK(glTexImage2D(GL_TEXTURE_2D, 0, format, width_, height_, 0, format, GL_UNSIGNED_BYTE, bufferPtr));
-	GL_API_CHECK(glGenerateMipmap(GL_TEXTURE_2D));
-	GL_API_CHECK(glBindTexture(GL_TEXTURE_2D, 0));
+	if (bIsUnaligned)
+	{
+		GL_API_CHECK(glPixelStorei(GL_UNPACK_ALIGNMENT, 4));
+	}
+}
 
-	return textureID;
+void Texture2D::CreateTextureFromContainer(const std::string& path)
+{
+	TextureContainer container;
+	bool bIsLoaded = container.Load(path);
+	ASSERT(bIsLoaded, "Failed to load %s file.", path.c_str());
+
+	ECompressedFormat format = container.GetFormat();
+	bool bIsS3TC = (format == ECompressedFormat::BC1 || format == ECompressedFormat::BC3);
+	ASSERT(!bIsS3TC || GLManager::GetRef().IsS3TCSupported(), "S3TC texture compression is not supported. (path: %s)", path.c_str());
+
+	/** Ŀ  ü  ϹǷ, Ӹ  ʰ   ͸ ״ εմϴ. */
+	uint32_t internalFormat = COMPRESSED_INTERNAL_FORMATS[static_cast<uint32_t>(format) - 1];
+	bIsCompressed_ = true;
+	compressedFormat_ = format;
+	CreateTextureStorage(container.GetWidth(), container.GetHeight(), TextureContainer::GetChannelCount(format), internalFormat, container.GetMipLevelCount());
+
+	GLManager::GetRef().BindBuffer(GL_PIXEL_UNPACK_BUFFER, 0); // Ŭ̾Ʈ ޸𸮿 ε.
+	for (int32_t level = 0; level < container.GetMipLevelCount(); ++level)
+	{
+		const TextureContainerLevel& mipLevel = container.GetLevel(level);
+		GL_API_CHECK(glCompressedTextureSubImage2D(textureID_, level, 0, 0, mipLevel.width, mipLevel.height, internalFormat, static_cast<GLsizei>(mipLevel.data.size()), mipLevel.data.data()));
+	}
 }
 
 #pragma warning(pop)
\ No newline at end of file
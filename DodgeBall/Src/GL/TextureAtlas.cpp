@@ -0,0 +1,224 @@
+#include <algorithm>
+
+#include <glad/glad.h>
+#include <stb_image.h>
+#include <stb_rect_pack.h>
+
+#include "GL/GLAssert.h"
+#include "GL/GLManager.h"
+#include "GL/TextureAtlas.h"
+#include "Utils/Assertion.h"
+#include "Utils/Profiler.h"
+
+struct TextureAtlas::AtlasPage
+{
+	uint32_t textureID = 0;
+
+	/** ī̶ Ŀ Դϴ. ؽƮ  迭 ŰǷ,    ̵ ʽϴ. */
+	stbrp_context context;
+	std::vector<stbrp_node> nodes;
+};
+
+TextureAtlas::TextureAtlas(int32_t pageSize, const ITexture::EFilter& filter, int32_t padding)
+	: pageSize_(pageSize)
+	, filter_(filter)
+	, padding_(padding)
+{
+	CHECK(pageSize_ > 0 && padding_ >= 0);
+
+	bIsInitialized_ = true;
+}
+
+TextureAtlas::~TextureAtlas()
+{
+	if (bIsInitialized_)
+	{
+		Release();
+	}
+}
+
+void TextureAtlas::Release()
+{
+	CHECK(bIsInitialized_);
+
+	for (auto& page : pages_)
+	{
+		GLManager::GetRef().OnDeleteTexture(page->textureID);
+		GL_API_CHECK(glDeleteTextures(1, &page->textureID));
+	}
+
+	pages_.clear();
+	regions_.Clear();
+	packedArea_ = 0;
+	bIsInitialized_ = false;
+}
+
+uint32_t TextureAtlas::Add(const std::vector<TextureAtlasImage>& images)
+{
+	PROFILE_SCOPE("TextureAtlas::Add");
+
+	/** Ŀ  簢Դϴ. id ̹ 迭 εԴϴ. */
+	std::vector<stbrp_rect> rects;
+	FlatHashMap<NameID, uint32_t> batchNames;
+	for (uint32_t index = 0; index < images.size(); ++index)
+	{
+		const TextureAtlasImage& image = images[index];
+		CHECK(image.pixels != nullptr && image.channels >= 1 && image.channels <= 4);
+
+		int32_t width = image.width + 2 * padding_;
+		int32_t height = image.height + 2 * padding_;
+		if (regions_.Contains(image.name) || image.width <= 0 || image.height <= 0 || width > pageSize_ || height > pageSize_)
+		{
+			continue;
+		}
+
+		if (batchNames.Insert(image.name, index)) //  ȿ ̸ ߺǸ  ̹ ߰.
+		{
+			stbrp_rect rect = {};
+			rect.id = static_cast<int32_t>(index);
+			rect.w = width;
+			rect.h = height;
+			rects.push_back(rect);
+		}
+	}
+
+	uint32_t addCount = 0;
+
+	/**    ġϰ,  ̹   ġմϴ.   ׻ ϳ ̻ ġǹǷ ݺ ϴ. */
+	for (uint32_t page = 0; !rects.empty(); ++page)
+	{
+		AtlasPage& atlasPage = (page < pages_.size()) ? *pages_[page] : CreatePage();
+
+		stbrp_pack_rects(&atlasPage.context, rects.data(), static_cast<int32_t>(rects.size()));
+
+		std::vector<stbrp_rect> remainRects;
+		for (const auto& rect : rects)
+		{
+			if (!rect.was_packed)
+			{
+				remainRects.push_back(rect);
+				continue;
+			}
+
+			UploadImage(images[rect.id], page, rect.x, rect.y);
+			packedArea_ += static_cast<uint64_t>(rect.w) * static_cast<uint64_t>(rect.h);
+			++addCount;
+		}
+
+		rects.swap(remainRects);
+	}
+
+	return addCount;
+}
+
+bool TextureAtlas::Add(const TextureAtlasImage& image)
+{
+	return Add(std::vector<TextureAtlasImage>{ image }) == 1;
+}
+
+bool TextureAtlas::AddFromFile(const NameID& name, const std::string& path)
+{
+	TextureAtlasImage image;
+	image.name = name;
+
+	uint8_t* imagePtr = stbi_load(path.c_str(), &image.width, &image.height, &image.channels, 0);
+	if (!imagePtr)
+	{
+		return false;
+	}
+
+	image.pixels = imagePtr;
+	bool bIsAdded = Add(image);
+
+	stbi_image_free(imagePtr);
+	return bIsAdded;
+}
+
+void TextureAtlas::Active(uint32_t unit, uint32_t page) const
+{
+	GLManager::GetRef().BindTexture(unit, GL_TEXTURE_2D, GetPageTextureID(page));
+}
+
+uint32_t TextureAtlas::GetPageTextureID(uint32_t page) const
+{
+	CHECK(page < pages_.size());
+	return pages_[page]->textureID;
+}
+
+float TextureAtlas::GetOccupancy() const
+{
+	if (pages_.empty())
+	{
+		return 0.0f;
+	}
+
+	double pageArea = static_cast<double>(pageSize_) * static_cast<double>(pageSize_);
+	return static_cast<float>(static_cast<double>(packedArea_) / (pageArea * static_cast<double>(pages_.size())));
+}
+
+TextureAtlas::AtlasPage& TextureAtlas::CreatePage()
+{
+	std::unique_ptr<AtlasPage> page = std::make_unique<AtlasPage>();
+
+	/**    ʺ ̸̻ Ŀ  ʺ 簢 ġ  ֽϴ. */
+	page->nodes.resize(pageSize_);
+	stbrp_init_target(&page->context, pageSize_, pageSize_, page->nodes.data(), static_cast<int32_t>(page->nodes.size()));
+
+	/** ̹ ϴ ŭ Ƿ,   ϵ     ϴ. */
+	GL_API_CHECK(glCreateTextures(GL_TEXTURE_2D, 1, &page->textureID));
+	GL_API_CHECK(glTextureStorage2D(page->textureID, 1, GL_RGBA8, pageSize_, pageSize_));
+	GL_API_CHECK(glTextureParameteri(page->textureID, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE));
+	GL_API_CHECK(glTextureParameteri(page->textureID, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE));
+	GL_API_CHECK(glTextureParameteri(page->textureID, GL_TEXTURE_MIN_FILTER, static_cast<GLint>(filter_)));
+	GL_API_CHECK(glTextureParameteri(page->textureID, GL_TEXTURE_MAG_FILTER, static_cast<GLint>(filter_)));
+	GL_API_CHECK(glClearTexImage(page->textureID, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr));
+
+	pages_.push_back(std::move(page));
+	return *pages_.back();
+}
+
+void TextureAtlas::UploadImage(const TextureAtlasImage& image, uint32_t page, int32_t x, int32_t y)
+{
+	int32_t width = image.width + 2 * padding_;
+	int32_t height = image.height + 2 * padding_;
+	uploadBuffer_.resize(static_cast<std::size_t>(width) * static_cast<std::size_t>(height) * 4);
+
+	/**    ڸ ؼ մϴ. ȸ ̹ stb_image  RGB մϴ. */
+	for (int32_t row = 0; row < height; ++row)
+	{
+		int32_t sourceY = std::clamp(row - padding_, 0, image.height - 1);
+		for (int32_t column = 0; column < width; ++column)
+		{
+			int32_t sourceX = std::clamp(column - padding_, 0, image.width - 1);
+
+			const uint8_t* source = image.pixels + (static_cast<std::size_t>(sourceY) * image.width + sourceX) * image.channels;
+			uint8_t* destination = uploadBuffer_.data() + (static_cast<std::size_t>(row) * width + column) * 4;
+
+			bool bIsGray = (image.channels <= 2);
+			destination[0] = source[0];
+			destination[1] = bIsGray ? source[0] : source[1];
+			destination[2] = bIsGray ? source[0] : source[2];
+			destination[3] = (image.channels == 2) ? source[1] : ((image.channels == 4) ? source[3] : 255);
+		}
+	}
+
+	uint32_t textureID = pages_[page]->textureID;
+	GLManager::GetRef().BindBuffer(GL_PIXEL_UNPACK_BUFFER, 0); // Ŭ̾Ʈ ޸𸮿 ε.
+	GL_API_CHECK(glTextureSubImage2D(textureID, 0, x, y, width, height, GL_RGBA, GL_UNSIGNED_BYTE, uploadBuffer_.data()));
+
+	float pageSize = static_cast<float>(pageSize_);
+
+	TextureAtlasRegion region;
+	region.page = page;
+	region.textureID = textureID;
+	region.uvRect = glm::vec4(
+		static_cast<float>(x + padding_) / pageSize,
+		static_cast<float>(y + padding_) / pageSize,
+		static_cast<float>(x + padding_ + image.width) / pageSize,
+		static_cast<float>(y + padding_ + image.height) / pageSize
+	);
+	region.width = image.width;
+	region.height = image.height;
+
+	regions_.Insert(image.name, region);
+}
\ No newline at end of file
@@ -0,0 +1,182 @@
+#include <cstdio>
+
+#include "GL/TextureContainer.h"
+
+/** ŷ ؽó  ĺ (DBTX)  Դϴ.   ٲٸ  ÷   źմϴ. */
+static const uint32_t CONTAINER_FILE_MAGIC = 0x58544244;
+static const uint32_t CONTAINER_FILE_VERSION = 1;
+
+/**   ִ ũԴϴ. ջ  ū ޸𸮸 Ҵ ʵ մϴ. */
+static const int32_t MAX_TEXTURE_SIZE = 16384;
+static const int32_t MAX_MIP_LEVEL_COUNT = 15;
+
+/** ŷ ؽó  Դϴ.  ڿ mipLevelCount  Ʈ ũ(uint32_t)  Ͱ ̾ϴ. */
+struct TextureContainerFileHeader
+{
+	uint32_t magic;
+	uint32_t version;
+	uint32_t format;
+	int32_t width;
+	int32_t height;
+	int32_t mipLevelCount;
+};
+
+const char* TextureContainer::FILE_EXTENSION = ".dbtex";
+
+/** ũⰡ 1x1   ̾ ü  ü  Դϴ. ̺   ؽó ҷ   ϴ. */
+static int32_t GetFullMipLevelCount(int32_t width, int32_t height)
+{
+	int32_t mipLevelCount = 1;
+	for (int32_t size = (width > height) ? width : height; size > 1; size >>= 1)
+	{
+		++mipLevelCount;
+	}
+
+	return mipLevelCount;
+}
+
+bool TextureContainer::Load(const std::string& path)
+{
+	levels_.clear();
+
+	FILE* file = std::fopen(path.c_str(), "rb");
+	if (!file)
+	{
+		return false;
+	}
+
+	TextureContainerFileHeader header;
+	bool bIsValid = std::fread(&header, sizeof(header), 1, file) == 1
+		&& header.magic == CONTAINER_FILE_MAGIC
+		&& header.version == CONTAINER_FILE_VERSION
+		&& header.format >= static_cast<uint32_t>(ECompressedFormat::BC1) && header.format <= static_cast<uint32_t>(ECompressedFormat::BC5)
+		&& header.width > 0 && header.width <= MAX_TEXTURE_SIZE
+		&& header.height > 0 && header.height <= MAX_TEXTURE_SIZE
+		&& header.mipLevelCount > 0 && header.mipLevelCount <= MAX_MIP_LEVEL_COUNT
+		&& header.mipLevelCount <= GetFullMipLevelCount(header.width, header.height);
+
+	std::vector<uint32_t> levelByteSizes;
+	if (bIsValid)
+	{
+		levelByteSizes.resize(header.mipLevelCount);
+		bIsValid = std::fread(levelByteSizes.data(), sizeof(uint32_t) * levelByteSizes.size(), 1, file) == 1;
+	}
+
+	if (bIsValid)
+	{
+		Reset(static_cast<ECompressedFormat>(header.format), header.width, header.height);
+
+		int32_t width = width_;
+		int32_t height = height_;
+		for (int32_t level = 0; level < header.mipLevelCount && bIsValid; ++level)
+		{
+			bIsValid = (levelByteSizes[level] == GetLevelByteSize(format_, width, height));
+			if (bIsValid)
+			{
+				std::vector<uint8_t> data(levelByteSizes[level]);
+				bIsValid = std::fread(data.data(), data.size(), 1, file) == 1;
+				AddLevel(width, height, std::move(data));
+			}
+
+			width = (width > 1) ? (width >> 1) : 1;
+			height = (height > 1) ? (height >> 1) : 1;
+		}
+	}
+	std::fclose(file);
+
+	if (!bIsValid)
+	{
+		levels_.clear();
+	}
+
+	return bIsValid;
+}
+
+bool TextureContainer::Save(const std::string& path) const
+{
+	if (levels_.empty())
+	{
+		return false;
+	}
+
+	FILE* file = std::fopen(path.c_str(), "wb");
+	if (!file)
+	{
+		return false;
+	}
+
+	TextureContainerFileHeader header = { CONTAINER_FILE_MAGIC, CONTAINER_FILE_VERSION, static_cast<uint32_t>(format_), width_, height_, GetMipLevelCount() };
+
+	std::vector<uint32_t> levelByteSizes;
+	for (const auto& level : levels_)
+	{
+		levelByteSizes.push_back(static_cast<uint32_t>(level.data.size()));
+	}
+
+	bool bIsWritten = std::fwrite(&header, sizeof(header), 1, file) == 1 && std::fwrite(levelByteSizes.data(), sizeof(uint32_t) * levelByteSizes.size(), 1, file) == 1;
+	for (const auto& level : levels_)
+	{
+		bIsWritten = bIsWritten && std::fwrite(level.data.data(), level.data.size(), 1, file) == 1;
+	}
+	bIsWritten = (std::fclose(file) == 0) && bIsWritten;
+
+	if (!bIsWritten)
+	{
+		std::remove(path.c_str());
+	}
+
+	return bIsWritten;
+}
+
+void TextureContainer::Reset(const ECompressedFormat& format, int32_t width, int32_t height)
+{
+	format_ = format;
+	width_ = width;
+	height_ = height;
+	levels_.clear();
+}
+
+void TextureContainer::AddLevel(int32_t width, int32_t height, std::vector<uint8_t>&& data)
+{
+	TextureContainerLevel level;
+	level.width = width;
+	level.height = height;
+	level.data = std::move(data);
+
+	levels_.push_back(std::move(level));
+}
+
+uint64_t TextureContainer::GetDataByteSize() const
+{
+	uint64_t byteSize = 0;
+	for (const auto& level : levels_)
+	{
+		byteSize += level.data.size();
+	}
+
+	return byteSize;
+}
+
+uint32_t TextureContainer::GetBlockByteSize(const ECompressedFormat& format)
+{
+	return (format == ECompressedFormat::BC1 || format == ECompressedFormat::BC4) ? 8 : 16;
+}
+
+int32_t TextureContainer::GetChannelCount(const ECompressedFormat& format)
+{
+	switch (format)
+	{
+	case ECompressedFormat::BC1: return 3;
+	case ECompressedFormat::BC3: return 4;
+	case ECompressedFormat::BC4: return 1;
+	case ECompressedFormat::BC5: return 2;
+	default: return 0;
+	}
+}
+
+uint32_t TextureContainer::GetLevelByteSize(const ECompressedFormat& format, int32_t width, int32_t height)
+{
+	uint32_t blockCountX = static_cast<uint32_t>((width + 3) / 4);
+	uint32_t blockCountY = static_cast<uint32_t>((height + 3) / 4);
+	return blockCountX * blockCountY * GetBlockByteSize(format);
+}
\ No newline at end of file
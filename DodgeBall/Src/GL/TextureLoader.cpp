@@ -0,0 +1,557 @@
+#include <algorithm>
+#include <cstring>
+
+#include <glad/glad.h>
+#include <stb_image.h>
+
+#include "GL/GLAssert.h"
+#include "GL/GLManager.h"
+#include "GL/Texture2D.h"
+#include "GL/TextureLoader.h"
+#include "GL/TextureResidencyManager.h"
+#include "GLFW/GLFWManager.h"
+#include "Utils/Assertion.h"
+#include "Utils/GameTimer.h"
+#include "Utils/Profiler.h"
+
+TextureLoader TextureLoader::singleton_;
+
+const double TextureLoader::DEFAULT_UPLOAD_MILLISECONDS_PER_FRAME = 2.0;
+
+/** ڸ ǥ ؽó (RGBA8)Դϴ. ε  ؽó   ʵ ߰ ȸ մϴ. */
+static const uint32_t PLACEHOLDER_COLOR = 0xFF808080;
+
+/** ȼ     ũԴϴ. OpenGL ⺻ GL_UNPACK_ALIGNMENT(4) ߾  äǷ, ȼ  ¸  ʽϴ. */
+static const uint32_t UNPACK_ROW_ALIGNMENT = 4;
+
+/**   ϰ εϴ   ִ ũԴϴ. ū ؽó ϳ Ӵ ð  ũ  ʵ  ð Ȯմϴ. */
+static const uint32_t UPLOAD_BATCH_BYTE_SIZE = 256 * 1024;
+
+/**  ȼ     ũ⿡  ũ(Ʈ) ϴ. */
+static uint32_t GetRowPitch(int32_t width, int32_t channels)
+{
+	uint32_t rowByteSize = static_cast<uint32_t>(width * channels);
+	return ((rowByteSize + UNPACK_ROW_ALIGNMENT - 1) / UNPACK_ROW_ALIGNMENT) * UNPACK_ROW_ALIGNMENT;
+}
+
+/**    2x2 ڽ ͷ  ũ մϴ. Ȧ ũ  / ڸ ؼ ݺϸ, ؽó Ŀ  ü  Ϳ ϴ. */
+static TextureContainerLevel DownsampleLevel(const TextureContainerLevel& source, int32_t channels)
+{
+	TextureContainerLevel level;
+	level.width = std::max(source.width >> 1, 1);
+	level.height = std::max(source.height >> 1, 1);
+	level.data.resize(static_cast<std::size_t>(level.width) * level.height * channels);
+
+	std::size_t sourcePitch = static_cast<std::size_t>(source.width) * channels;
+	for (int32_t y = 0; y < level.height; ++y)
+	{
+		const uint8_t* row0 = source.data.data() + std::min(2 * y, source.height - 1) * sourcePitch;
+		const uint8_t* row1 = source.data.data() + std::min(2 * y + 1, source.height - 1) * sourcePitch;
+		uint8_t* outRow = level.data.data() + static_cast<std::size_t>(y) * level.width * channels;
+
+		for (int32_t x = 0; x < level.width; ++x)
+		{
+			int32_t x0 = std::min(2 * x, source.width - 1) * channels;
+			int32_t x1 = std::min(2 * x + 1, source.width - 1) * channels;
+
+			for (int32_t channel = 0; channel < channels; ++channel)
+			{
+				uint32_t sum = row0[x0 + channel] + row0[x1 + channel] + row1[x0 + channel] + row1[x1 + channel];
+				outRow[x * channels + channel] = static_cast<uint8_t>((sum + 2) >> 2);
+			}
+		}
+	}
+
+	return level;
+}
+
+TextureLoader& TextureLoader::GetRef()
+{
+	return singleton_;
+}
+
+TextureLoader* TextureLoader::GetPtr()
+{
+	return &singleton_;
+}
+
+void TextureLoader::Startup(uint32_t uploadBytesPerFrame, double uploadMillisecondsPerFrame)
+{
+	CHECK(decodeThreads_.empty() && uploadBytesPerFrame > 0);
+
+	uploadBytesPerFrame_ = uploadBytesPerFrame;
+	uploadMillisecondsPerFrame_ = uploadMillisecondsPerFrame;
+
+	bIsEnabled_ = (GLFWManager::GetRef().GetRunMode() != ERunMode::SIMULATION);
+	if (!bIsEnabled_)
+	{
+		return; // OpenGL ؽƮ Ƿ ؽó ε  .
+	}
+
+	GL_API_CHECK(glCreateTextures(GL_TEXTURE_2D, 1, &placeholderTextureID_));
+	GL_API_CHECK(glTextureStorage2D(placeholderTextureID_, 1, GL_RGBA8, 1, 1));
+	GL_API_CHECK(glTextureSubImage2D(placeholderTextureID_, 0, 0, 0, 1, 1, GL_RGBA, GL_UNSIGNED_BYTE, &PLACEHOLDER_COLOR));
+
+	GL_API_CHECK(glGenBuffers(1, &pixelUnpackBufferID_));
+	pixelUnpackRing_.Initialize(GL_PIXEL_UNPACK_BUFFER, pixelUnpackBufferID_, uploadBytesPerFrame_, UNPACK_ROW_ALIGNMENT);
+	GLManager::GetRef().BindBuffer(GL_PIXEL_UNPACK_BUFFER, 0); // Ŭ̾Ʈ ޸𸮿 εϴ ٸ ڵ尡 ۸  ʵ ε .
+
+	bIsQuit_ = false;
+	tickFrameIndex_ = UINT64_MAX;
+	for (uint32_t index = 0; index < DECODE_THREAD_COUNT; ++index)
+	{
+		decodeThreads_.emplace_back([this]() { RunDecodeThread(); });
+	}
+}
+
+void TextureLoader::Shutdown()
+{
+	{
+		std::lock_guard<std::mutex> lock(queueMutex_);
+		bIsQuit_ = true;
+		decodeQueue_.clear();
+	}
+	decodeCondition_.notify_all();
+
+	for (auto& decodeThread : decodeThreads_)
+	{
+		decodeThread.join();
+	}
+	decodeThreads_.clear();
+
+	for (auto& request : decodedRequests_)
+	{
+		ReleaseRequest(*request);
+	}
+	decodedRequests_.clear();
+
+	for (auto& request : uploadQueue_)
+	{
+		ReleaseRequest(*request);
+	}
+	uploadQueue_.clear();
+
+	if (!bIsEnabled_)
+	{
+		return;
+	}
+
+	pixelUnpackRing_.Release();
+	GLManager::GetRef().OnDeleteBuffer(pixelUnpackBufferID_);
+	GL_API_CHECK(glDeleteBuffers(1, &pixelUnpackBufferID_));
+	pixelUnpackBufferID_ = 0;
+
+	GLManager::GetRef().OnDeleteTexture(placeholderTextureID_);
+	GL_API_CHECK(glDeleteTextures(1, &placeholderTextureID_));
+	placeholderTextureID_ = 0;
+
+	bIsEnabled_ = false;
+}
+
+Texture2D* TextureLoader::LoadAsync(const std::string& path, const ITexture::EFilter& filter)
+{
+	GLManager& glManager = GLManager::GetRef();
+
+	GLHandle<Texture2D> handle = glManager.CreateHandle<Texture2D>(filter);
+	if (!bIsEnabled_)
+	{
+		return glManager.Get(handle);
+	}
+
+	std::unique_ptr<TextureLoadRequest> request = std::make_unique<TextureLoadRequest>();
+	request->texture = handle;
+	request->path = path;
+
+	{
+		std::lock_guard<std::mutex> lock(queueMutex_);
+		decodeQueue_.push_back(std::move(request));
+	}
+	decodeCondition_.notify_one();
+
+	return glManager.Get(handle);
+}
+
+void TextureLoader::StreamAsync(Texture2D* texture, int32_t residentMipLevel)
+{
+	CHECK(bIsEnabled_ && texture->IsResident() && !texture->GetPath().empty() && residentMipLevel >= 0 && residentMipLevel < texture->GetResidentMipLevel());
+
+	std::unique_ptr<TextureLoadRequest> request = std::make_unique<TextureLoadRequest>();
+	request->texture = GLManager::GetRef().GetHandle(texture);
+	request->path = texture->GetPath();
+	request->bIsStreamRequest = true;
+	request->bIsCompressed = texture->bIsCompressed_;
+	request->beginMipLevel = residentMipLevel;
+	request->endMipLevel = texture->GetResidentMipLevel();
+
+	{
+		std::lock_guard<std::mutex> lock(queueMutex_);
+		decodeQueue_.push_back(std::move(request));
+	}
+	decodeCondition_.notify_one();
+}
+
+void TextureLoader::Tick()
+{
+	GLManager& glManager = GLManager::GetRef();
+	if (!bIsEnabled_ || tickFrameIndex_ == glManager.GetFrameIndex())
+	{
+		return;
+	}
+
+	PROFILE_SCOPE("TextureLoader::Tick");
+
+	tickFrameIndex_ = glManager.GetFrameIndex();
+
+	uint64_t beginTicks = GameTimer::GetCurrentTicks();
+	uint64_t deadlineTicks = beginTicks + static_cast<uint64_t>(uploadMillisecondsPerFrame_ * static_cast<double>(GameTimer::GetTickFrequency()) / 1000.0);
+	uploadByteCount_ = 0;
+
+	{
+		std::lock_guard<std::mutex> lock(queueMutex_);
+		for (auto& request : decodedRequests_)
+		{
+			uploadQueue_.push_back(std::move(request));
+		}
+		decodedRequests_.clear();
+	}
+
+	uint32_t remainByteCount = uploadBytesPerFrame_;
+
+	while (!uploadQueue_.empty() && remainByteCount > 0)
+	{
+		TextureLoadRequest& request = *uploadQueue_.front();
+
+		/** ε尡   ؽó ıǾٸ  ε带 մϴ. */
+		Texture2D* texture = glManager.Get(request.texture);
+		if (texture)
+		{
+			/** ε   û , ؽó ڸ ǥ ؽó(     ) ܵӴϴ. */
+			if (!IsUploadable(request, texture))
+			{
+				if (request.bIsStreamRequest)
+				{
+					TextureResidencyManager::GetRef().OnMipLevelsStreamed(texture, request.endMipLevel, false);
+				}
+				else
+				{
+					++failedCount_;
+				}
+			}
+			else if (!(request.bIsStreamRequest ? UploadMipLevels(request, texture, remainByteCount, deadlineTicks) : Upload(request, texture, remainByteCount, deadlineTicks)))
+			{
+				break; //   .
+			}
+			else if (request.bIsStreamRequest)
+			{
+				TextureResidencyManager::GetRef().OnMipLevelsStreamed(texture, request.endMipLevel, true);
+			}
+			else
+			{
+				TextureResidencyManager::GetRef().Register(texture);
+				++residentCount_;
+			}
+		}
+
+		ReleaseRequest(request);
+		uploadQueue_.pop_front();
+
+		if (GameTimer::GetCurrentTicks() >= deadlineTicks)
+		{
+			break;
+		}
+	}
+
+	if (uploadByteCount_ > 0)
+	{
+		glManager.BindBuffer(GL_PIXEL_UNPACK_BUFFER, 0); // Ŭ̾Ʈ ޸𸮿 εϴ ٸ ڵ尡 ۸  ʵ ε .
+	}
+
+	uploadMilliseconds_ = GameTimer::ConvertTicksToSeconds(GameTimer::GetCurrentTicks() - beginTicks) * 1000.0;
+}
+
+bool TextureLoader::IsIdle() const
+{
+	std::lock_guard<std::mutex> lock(queueMutex_);
+	return decodeQueue_.empty() && decodingCount_ == 0 && decodedRequests_.empty() && uploadQueue_.empty();
+}
+
+TextureLoaderStatistics TextureLoader::GetStatistics() const
+{
+	TextureLoaderStatistics statistics;
+	{
+		std::lock_guard<std::mutex> lock(queueMutex_);
+		statistics.pendingDecodeCount = static_cast<uint32_t>(decodeQueue_.size()) + decodingCount_;
+		statistics.pendingUploadCount = static_cast<uint32_t>(decodedRequests_.size());
+	}
+
+	statistics.pendingUploadCount += static_cast<uint32_t>(uploadQueue_.size());
+	statistics.residentCount = residentCount_;
+	statistics.failedCount = failedCount_;
+	statistics.uploadByteCount = uploadByteCount_;
+	statistics.uploadMilliseconds = uploadMilliseconds_;
+	return statistics;
+}
+
+void TextureLoader::RunDecodeThread()
+{
+	Profiler::SetThreadName("TextureDecode");
+
+	for (;;)
+	{
+		std::unique_ptr<TextureLoadRequest> request;
+		{
+			std::unique_lock<std::mutex> lock(queueMutex_);
+			decodeCondition_.wait(lock, [this]() { return bIsQuit_ || !decodeQueue_.empty(); });
+			if (bIsQuit_)
+			{
+				return;
+			}
+
+			request = std::move(decodeQueue_.front());
+			decodeQueue_.pop_front();
+			++decodingCount_;
+		}
+
+		{
+			PROFILE_SCOPE("TextureLoader::Decode");
+			if (request->bIsStreamRequest)
+			{
+				DecodeMipLevels(*request);
+			}
+			else
+			{
+				request->pixels = stbi_load(request->path.c_str(), &request->width, &request->height, &request->channels, 0);
+			}
+		}
+
+		std::lock_guard<std::mutex> lock(queueMutex_);
+		--decodingCount_;
+
+		if (bIsQuit_)
+		{
+			stbi_image_free(request->pixels);
+			return;
+		}
+
+		decodedRequests_.push_back(std::move(request));
+	}
+}
+
+void TextureLoader::DecodeMipLevels(TextureLoadRequest& request) const
+{
+	/**    ϸ levels  Ƿ,  尡  з óմϴ. */
+	if (request.bIsCompressed)
+	{
+		TextureContainer container;
+		if (!container.Load(request.path) || request.endMipLevel > container.GetMipLevelCount())
+		{
+			return;
+		}
+
+		request.width = container.GetWidth();
+		request.height = container.GetHeight();
+		request.format = container.GetFormat();
+		request.mipLevelCount = container.GetMipLevelCount();
+		for (int32_t mipLevel = request.beginMipLevel; mipLevel < request.endMipLevel; ++mipLevel)
+		{
+			request.levels.push_back(container.GetLevel(mipLevel));
+		}
+		return;
+	}
+
+	uint8_t* imagePtr = stbi_load(request.path.c_str(), &request.width, &request.height, &request.channels, 0);
+	if (imagePtr == nullptr)
+	{
+		return;
+	}
+
+	/** 0  CPU ؼ    Ƿ, GPU ü  ü  ӽ    ʽϴ. */
+	TextureContainerLevel level;
+	level.width = request.width;
+	level.height = request.height;
+	level.data.assign(imagePtr, imagePtr + static_cast<std::size_t>(request.width) * request.height * request.channels);
+	stbi_image_free(imagePtr);
+
+	for (int32_t mipLevel = 0; mipLevel < request.endMipLevel; ++mipLevel)
+	{
+		if (mipLevel > 0)
+		{
+			level = DownsampleLevel(level, request.channels);
+		}
+
+		if (mipLevel >= request.beginMipLevel)
+		{
+			request.levels.push_back(level);
+		}
+	}
+}
+
+bool TextureLoader::IsUploadable(const TextureLoadRequest& request, const Texture2D* texture) const
+{
+	if (request.bIsStreamRequest)
+	{
+		if (request.levels.empty())
+		{
+			DebugPrintF("Failed to reload %s file. (resident mip level: %d)\n", request.path.c_str(), request.endMipLevel);
+			return false;
+		}
+
+		bool bIsSameFormat = request.bIsCompressed ? (request.format == texture->compressedFormat_ && request.mipLevelCount == texture->mipLevelCount_) : (request.channels == texture->channels_);
+		bool bIsSameLevel = (request.width == texture->width_ && request.height == texture->height_ && texture->residentMipLevel_ == request.endMipLevel);
+		if (!bIsSameFormat || !bIsSameLevel)
+		{
+			DebugPrintF("%s file has changed since it was loaded. (resident mip level: %d)\n", request.path.c_str(), request.endMipLevel);
+			return false;
+		}
+
+		const TextureContainerLevel& level = request.levels.front();
+		uint32_t rowPitch = request.bIsCompressed ? TextureContainer::GetLevelByteSize(request.format, level.width, 1) : GetRowPitch(level.width, request.channels);
+		if (rowPitch > uploadBytesPerFrame_)
+		{
+			DebugPrintF("Texture row exceeds the upload budget. (path: %s, row: %u bytes)\n", request.path.c_str(), rowPitch);
+			return false;
+		}
+
+		return true;
+	}
+
+	if (request.pixels == nullptr)
+	{
+		DebugPrintF("Failed to load %s file. The placeholder texture is kept.\n", request.path.c_str());
+		return false;
+	}
+
+	uint32_t rowPitch = GetRowPitch(request.width, request.channels);
+	if (rowPitch > uploadBytesPerFrame_)
+	{
+		DebugPrintF("Texture row exceeds the upload budget. (path: %s, row: %u bytes)\n", request.path.c_str(), rowPitch);
+		return false;
+	}
+
+	return true;
+}
+
+bool TextureLoader::Upload(TextureLoadRequest& request, Texture2D* texture, uint32_t& remainByteCount, uint64_t deadlineTicks)
+{
+	if (texture->textureID_ == 0)
+	{
+		texture->CreateTextureStorage(request.width, request.height, request.channels);
+		texture->path_ = request.path;
+	}
+
+	if (!UploadRows(texture, texture->textureID_, 0, request.pixels, request.width, request.height, request.nextRow, remainByteCount, deadlineTicks))
+	{
+		return false;
+	}
+
+	GL_API_CHECK(glGenerateTextureMipmap(texture->textureID_));
+	texture->bIsResident_ = true;
+	return true;
+}
+
+bool TextureLoader::UploadMipLevels(TextureLoadRequest& request, Texture2D* texture, uint32_t& remainByteCount, uint64_t deadlineTicks)
+{
+	/**    ε带   ϰ, ε尡   ؽó    ε˴ϴ. */
+	if (request.streamTextureID == 0)
+	{
+		request.streamTextureID = texture->CreateMipLevelStorage(request.beginMipLevel);
+	}
+
+	int32_t levelCount = static_cast<int32_t>(request.levels.size());
+	while (request.nextLevel < levelCount)
+	{
+		const TextureContainerLevel& level = request.levels[request.nextLevel];
+		if (!UploadRows(texture, request.streamTextureID, request.nextLevel, level.data.data(), level.width, level.height, request.nextRow, remainByteCount, deadlineTicks))
+		{
+			return false;
+		}
+
+		++request.nextLevel;
+		request.nextRow = 0;
+
+		if (request.nextLevel < levelCount && GameTimer::GetCurrentTicks() >= deadlineTicks)
+		{
+			return false; // ð   .
+		}
+	}
+
+	texture->ReplaceMipLevelStorage(request.streamTextureID, request.beginMipLevel);
+	request.streamTextureID = 0;
+	return true;
+}
+
+bool TextureLoader::UploadRows(const Texture2D* texture, uint32_t textureID, int32_t level, const uint8_t* data, int32_t width, int32_t height, int32_t& nextRow, uint32_t& remainByteCount, uint64_t deadlineTicks)
+{
+	/**  ؽó 4x4      εմϴ.  ũ(8/16Ʈ)   ũ ̹Ƿ  ̿  ϴ. */
+	bool bIsCompressed = texture->bIsCompressed_;
+	int32_t rowTexelCount = bIsCompressed ? 4 : 1;
+	int32_t rowCountTotal = (height + rowTexelCount - 1) / rowTexelCount;
+	uint32_t rowByteSize = bIsCompressed ? TextureContainer::GetLevelByteSize(texture->compressedFormat_, width, 1) : static_cast<uint32_t>(width * texture->channels_);
+	uint32_t rowPitch = bIsCompressed ? rowByteSize : GetRowPitch(width, texture->channels_);
+	int32_t batchRowCount = std::max(1, static_cast<int32_t>(UPLOAD_BATCH_BYTE_SIZE / rowPitch));
+
+	while (nextRow < rowCountTotal)
+	{
+		int32_t rowCount = std::min({ rowCountTotal - nextRow, static_cast<int32_t>(remainByteCount / rowPitch), batchRowCount });
+		if (rowCount <= 0)
+		{
+			break; // Ʈ   .
+		}
+
+		BufferAllocation allocation = pixelUnpackRing_.Allocate(static_cast<uint32_t>(rowCount) * rowPitch);
+
+		const uint8_t* sourcePtr = data + static_cast<std::size_t>(nextRow) * rowByteSize;
+		uint8_t* destinationPtr = reinterpret_cast<uint8_t*>(allocation.bufferPtr);
+		if (rowPitch == rowByteSize)
+		{
+			std::memcpy(destinationPtr, sourcePtr, allocation.byteSize);
+		}
+		else
+		{
+			for (int32_t row = 0; row < rowCount; ++row)
+			{
+				std::memcpy(destinationPtr + row * rowPitch, sourcePtr + row * rowByteSize, rowByteSize);
+			}
+		}
+
+		/** ȼ  ۰ εǾ Ƿ,  ڴ Ŭ̾Ʈ ޸ ּҰ ƴ϶   Դϴ. */
+		const void* offset = reinterpret_cast<const void*>(static_cast<uintptr_t>(allocation.offset));
+		GLManager::GetRef().BindBuffer(GL_PIXEL_UNPACK_BUFFER, pixelUnpackBufferID_);
+		if (bIsCompressed)
+		{
+			int32_t y = nextRow * rowTexelCount;
+			int32_t regionHeight = std::min(rowCount * rowTexelCount, height - y);
+			GL_API_CHECK(glCompressedTextureSubImage2D(textureID, level, 0, y, width, regionHeight, texture->internalFormat_, static_cast<GLsizei>(static_cast<uint32_t>(rowCount) * rowByteSize), offset));
+		}
+		else
+		{
+			GL_API_CHECK(glTextureSubImage2D(textureID, level, 0, nextRow, width, rowCount, texture->pixelFormat_, GL_UNSIGNED_BYTE, offset));
+		}
+
+		nextRow += rowCount;
+		remainByteCount -= allocation.byteSize;
+		uploadByteCount_ += allocation.byteSize;
+
+		if (GameTimer::GetCurrentTicks() >= deadlineTicks)
+		{
+			break; // ð   .
+		}
+	}
+
+	return nextRow >= rowCountTotal;
+}
+
+void TextureLoader::ReleaseRequest(TextureLoadRequest& request)
+{
+	stbi_image_free(request.pixels);
+	request.pixels = nullptr;
+	request.levels.clear();
+
+	/**    εϱ  ؽó ıǾų δ ߴٸ,    մϴ. */
+	if (request.streamTextureID)
+	{
+		GLManager::GetRef().OnDeleteTexture(request.streamTextureID);
+		GL_API_CHECK(glDeleteTextures(1, &request.streamTextureID));
+		request.streamTextureID = 0;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,405 @@
+#include <algorithm>
+#include <cmath>
+
+#include "GL/GLManager.h"
+#include "GL/Texture2D.h"
+#include "GL/TextureLoader.h"
+#include "GL/TextureResidencyManager.h"
+#include "GLFW/GLFWManager.h"
+#include "Utils/Assertion.h"
+#include "Utils/Profiler.h"
+
+TextureResidencyManager TextureResidencyManager::singleton_;
+
+/**         ؽó ֱٿ  ؽó ϴ.   ٰ ٽ ̴ ؽó   ٷ  ʽϴ. */
+static const uint64_t RECENT_USAGE_FRAME_COUNT = 2;
+
+TextureResidencyManager& TextureResidencyManager::GetRef()
+{
+	return singleton_;
+}
+
+TextureResidencyManager* TextureResidencyManager::GetPtr()
+{
+	return &singleton_;
+}
+
+void TextureResidencyManager::Startup(uint64_t budgetByteSize, uint32_t streamTexturesPerFrame)
+{
+	CHECK(residencies_.empty());
+
+	budgetByteSize_ = budgetByteSize;
+	streamTexturesPerFrame_ = streamTexturesPerFrame;
+	tickFrameIndex_ = UINT64_MAX;
+
+	bIsEnabled_ = (GLFWManager::GetRef().GetRunMode() != ERunMode::SIMULATION);
+}
+
+void TextureResidencyManager::Shutdown()
+{
+	residencies_.clear();
+	residencyIndices_.Clear();
+	evictionOrder_.clear();
+	streamOrder_.clear();
+
+	residentByteSize_ = 0;
+	fullByteSize_ = 0;
+	pendingStreamCount_ = 0;
+	reservedByteSize_ = 0;
+	peakByteSize_ = 0;
+	completedStreamLevelCount_ = 0;
+	bIsEnabled_ = false;
+}
+
+void TextureResidencyManager::SetBudget(uint64_t budgetByteSize)
+{
+	budgetByteSize_ = budgetByteSize;
+}
+
+void TextureResidencyManager::Register(Texture2D* texture)
+{
+	if (bIsEnabled_)
+	{
+		FindOrAddResidency(texture);
+	}
+}
+
+void TextureResidencyManager::NotifyUsage(Texture2D* texture, float screenPixelSize)
+{
+	if (!bIsEnabled_)
+	{
+		return;
+	}
+
+	/** ȭ ũ   ̻    Ͱ  Ƿ, ؽó ũ ȭ ũ  ʿ  ū   մϴ. */
+	int32_t textureSize = std::max(texture->GetWidth(), texture->GetHeight());
+	int32_t maxMipLevel = std::max(texture->GetMipLevelCount() - 1, 0);
+
+	int32_t mipLevel = maxMipLevel;
+	if (screenPixelSize >= 1.0f)
+	{
+		float ratio = static_cast<float>(textureSize) / screenPixelSize;
+		mipLevel = (ratio > 1.0f) ? std::min(static_cast<int32_t>(std::floor(std::log2(ratio))), maxMipLevel) : 0;
+	}
+
+	TextureResidency& residency = FindOrAddResidency(texture);
+	uint64_t frameIndex = GLManager::GetRef().GetFrameIndex();
+	if (residency.bIsUsed && residency.lastUsedFrameIndex == frameIndex)
+	{
+		residency.requestedMipLevel = std::min(residency.requestedMipLevel, mipLevel);
+	}
+	else
+	{
+		residency.bIsUsed = true;
+		residency.lastUsedFrameIndex = frameIndex;
+		residency.requestedMipLevel = mipLevel;
+	}
+}
+
+void TextureResidencyManager::Tick()
+{
+	GLManager& glManager = GLManager::GetRef();
+
+	uint64_t frameIndex = glManager.GetFrameIndex();
+	if (!bIsEnabled_ || tickFrameIndex_ == frameIndex)
+	{
+		return;
+	}
+
+	PROFILE_SCOPE("TextureResidencyManager::Tick");
+
+	tickFrameIndex_ = frameIndex;
+	evictedLevelCount_ = 0;
+	streamedLevelCount_ = completedStreamLevelCount_;
+	completedStreamLevelCount_ = 0;
+
+	RemoveDestroyedTextures();
+
+	residentByteSize_ = 0;
+	fullByteSize_ = 0;
+	pendingStreamCount_ = 0;
+	reservedByteSize_ = 0;
+	for (const auto& residency : residencies_)
+	{
+		const Texture2D* texture = glManager.Get(residency.texture);
+		residentByteSize_ += texture->GetGPUMemoryByteSize();
+		fullByteSize_ += texture->GetGPUMemoryByteSize(0);
+
+		if (residency.bIsStreamPending)
+		{
+			++pendingStreamCount_;
+			reservedByteSize_ += texture->GetGPUMemoryByteSize(residency.pendingMipLevel);
+		}
+	}
+
+	peakByteSize_ = residentByteSize_ + reservedByteSize_;
+
+	/**  Ѿٸ ֱٿ     , ׷  ֱٿ  ؽó  Ӵϴ.      ũ 꿡 ϴ. */
+	uint64_t targetByteSize = (reservedByteSize_ < budgetByteSize_) ? budgetByteSize_ - reservedByteSize_ : 0;
+	if (!EvictMipLevels(targetByteSize, false))
+	{
+		EvictMipLevels(targetByteSize, true);
+	}
+
+	streamOrder_.clear();
+	for (uint32_t index = 0; index < static_cast<uint32_t>(residencies_.size()); ++index)
+	{
+		const TextureResidency& residency = residencies_[index];
+		const Texture2D* texture = glManager.Get(residency.texture);
+		if (texture->IsResident() && !texture->GetPath().empty() && !residency.bIsStreamFailed && !residency.bIsStreamPending && IsRecentlyUsed(residency) && residency.requestedMipLevel < texture->GetResidentMipLevel())
+		{
+			streamOrder_.push_back(index);
+		}
+	}
+
+	/**     ؽó,  ȭ鿡  帮 ̴ ؽó մϴ. */
+	std::sort(streamOrder_.begin(), streamOrder_.end(), [&](uint32_t lhs, uint32_t rhs)
+		{
+			int32_t lhsMissingLevelCount = glManager.Get(residencies_[lhs].texture)->GetResidentMipLevel() - residencies_[lhs].requestedMipLevel;
+			int32_t rhsMissingLevelCount = glManager.Get(residencies_[rhs].texture)->GetResidentMipLevel() - residencies_[rhs].requestedMipLevel;
+			return lhsMissingLevelCount > rhsMissingLevelCount;
+		}
+	);
+
+	uint32_t streamCount = std::min(static_cast<uint32_t>(streamOrder_.size()), streamTexturesPerFrame_);
+	for (uint32_t order = 0; order < streamCount; ++order)
+	{
+		TextureResidency& residency = residencies_[streamOrder_[order]];
+		Texture2D* texture = glManager.Get(residency.texture);
+
+		int32_t residentMipLevel = texture->GetResidentMipLevel();
+
+		/**
+		 *          Բ ϹǷ,    ũ ü 꿡  մϴ.
+		 *  ϸ ֱٿ      ڸ , ׷ ϸ ʿ    մϴ.
+		 */
+		int32_t mipLevel = residency.requestedMipLevel;
+		uint64_t stagingByteSize = 0;
+		for (; mipLevel < residentMipLevel; ++mipLevel)
+		{
+			stagingByteSize = texture->GetGPUMemoryByteSize(mipLevel);
+			if (residentByteSize_ + reservedByteSize_ + stagingByteSize <= budgetByteSize_)
+			{
+				break;
+			}
+
+			if (reservedByteSize_ + stagingByteSize <= budgetByteSize_ && EvictMipLevels(budgetByteSize_ - reservedByteSize_ - stagingByteSize, false))
+			{
+				break;
+			}
+		}
+
+		if (mipLevel >= residentMipLevel)
+		{
+			continue;
+		}
+
+		/**       ״ ϹǷ,  ޸𸮴 ؽó δ   ü  Tick ŵ˴ϴ. */
+		TextureLoader::GetRef().StreamAsync(texture, mipLevel);
+		residency.bIsStreamPending = true;
+		residency.pendingMipLevel = mipLevel;
+		++pendingStreamCount_;
+
+		reservedByteSize_ += stagingByteSize;
+		peakByteSize_ = std::max(peakByteSize_, residentByteSize_ + reservedByteSize_);
+	}
+
+	totalEvictedLevelCount_ += evictedLevelCount_;
+	totalStreamedLevelCount_ += streamedLevelCount_;
+}
+
+void TextureResidencyManager::OnMipLevelsStreamed(Texture2D* texture, int32_t previousMipLevel, bool bIsStreamed)
+{
+	if (!bIsEnabled_)
+	{
+		return;
+	}
+
+	uint32_t* index = residencyIndices_.Find(GLManager::GetRef().GetHandle(texture).value);
+	if (index == nullptr || !residencies_[*index].bIsStreamPending)
+	{
+		return;
+	}
+
+	TextureResidency& residency = residencies_[*index];
+	residency.bIsStreamPending = false;
+
+	if (bIsStreamed)
+	{
+		completedStreamLevelCount_ += static_cast<uint32_t>(previousMipLevel - texture->GetResidentMipLevel());
+	}
+	else
+	{
+		residency.bIsStreamFailed = true; //     Ƿ ٽ û .
+		++streamFailedCount_;
+	}
+}
+
+TextureResidencyStatistics TextureResidencyManager::GetStatistics() const
+{
+	TextureResidencyStatistics statistics;
+	statistics.textureCount = static_cast<uint32_t>(residencies_.size());
+	statistics.budgetByteSize = budgetByteSize_;
+	statistics.residentByteSize = residentByteSize_;
+	statistics.fullByteSize = fullByteSize_;
+	statistics.reservedByteSize = reservedByteSize_;
+	statistics.peakByteSize = peakByteSize_;
+	statistics.pendingStreamCount = pendingStreamCount_;
+	statistics.evictedLevelCount = evictedLevelCount_;
+	statistics.streamedLevelCount = streamedLevelCount_;
+	statistics.totalEvictedLevelCount = totalEvictedLevelCount_;
+	statistics.totalStreamedLevelCount = totalStreamedLevelCount_;
+	statistics.streamFailedCount = streamFailedCount_;
+
+	return statistics;
+}
+
+TextureResidencyManager::TextureResidency& TextureResidencyManager::FindOrAddResidency(Texture2D* texture)
+{
+	GLHandle<Texture2D> handle = GLManager::GetRef().GetHandle(texture);
+	ASSERT(!handle.IsNull(), "Texture must be created by GLManager to manage its residency.");
+
+	if (uint32_t* index = residencyIndices_.Find(handle.value))
+	{
+		return residencies_[*index];
+	}
+
+	residencyIndices_.Insert(handle.value, static_cast<uint32_t>(residencies_.size()));
+	residencies_.push_back(TextureResidency());
+	residencies_.back().texture = handle;
+
+	return residencies_.back();
+}
+
+void TextureResidencyManager::RemoveDestroyedTextures()
+{
+	GLManager& glManager = GLManager::GetRef();
+
+	uint32_t index = 0;
+	while (index < static_cast<uint32_t>(residencies_.size()))
+	{
+		if (glManager.Get(residencies_[index].texture))
+		{
+			++index;
+			continue;
+		}
+
+		/**     ڸ űǷ, ű   ε մϴ. */
+		residencyIndices_.Erase(residencies_[index].texture.value);
+		if (index + 1 < static_cast<uint32_t>(residencies_.size()))
+		{
+			residencies_[index] = residencies_.back();
+			*residencyIndices_.Find(residencies_[index].texture.value) = index;
+		}
+		residencies_.pop_back();
+	}
+}
+
+bool TextureResidencyManager::IsRecentlyUsed(const TextureResidency& residency) const
+{
+	return residency.bIsUsed && residency.lastUsedFrameIndex + RECENT_USAGE_FRAME_COUNT >= tickFrameIndex_;
+}
+
+bool TextureResidencyManager::EvictMipLevels(uint64_t targetByteSize, bool bIsUsedTextureEvictable)
+{
+	if (residentByteSize_ <= targetByteSize)
+	{
+		return true;
+	}
+
+	GLManager& glManager = GLManager::GetRef();
+
+	evictionOrder_.resize(residencies_.size());
+	for (uint32_t index = 0; index < static_cast<uint32_t>(residencies_.size()); ++index)
+	{
+		evictionOrder_[index] = index;
+	}
+
+	/**    ؽó,   ؽó  ϴ. */
+	std::sort(evictionOrder_.begin(), evictionOrder_.end(), [&](uint32_t lhs, uint32_t rhs)
+		{
+			const TextureResidency& lhsResidency = residencies_[lhs];
+			const TextureResidency& rhsResidency = residencies_[rhs];
+			if (lhsResidency.bIsUsed != rhsResidency.bIsUsed)
+			{
+				return !lhsResidency.bIsUsed;
+			}
+
+			return lhsResidency.lastUsedFrameIndex < rhsResidency.lastUsedFrameIndex;
+		}
+	);
+
+	for (uint32_t index : evictionOrder_)
+	{
+		const TextureResidency& residency = residencies_[index];
+		Texture2D* texture = glManager.Get(residency.texture);
+		if (!texture->IsResident() || residency.bIsStreamPending)
+		{
+			continue; //   ؽó ؽó δ   ü   .
+		}
+
+		int32_t maxMipLevel = GetMaxResidentMipLevel(texture);
+		if (!bIsUsedTextureEvictable && IsRecentlyUsed(residency))
+		{
+			maxMipLevel = std::min(maxMipLevel, residency.requestedMipLevel);
+		}
+
+		int32_t residentMipLevel = texture->GetResidentMipLevel();
+		if (residentMipLevel >= maxMipLevel)
+		{
+			continue;
+		}
+
+		/**     üϵ, ǥ ũ⿡ ϴ    մϴ. */
+		uint64_t residentByteSize = texture->GetGPUMemoryByteSize();
+		int32_t mipLevel = residentMipLevel + 1;
+		for (; mipLevel < maxMipLevel; ++mipLevel)
+		{
+			if (residentByteSize_ - (residentByteSize - texture->GetGPUMemoryByteSize(mipLevel)) <= targetByteSize)
+			{
+				break;
+			}
+		}
+
+		/**
+		 * ⵵      ڿ    մϴ.
+		 *  ȿ  ڸ  ̶, üϴ ȿ   ʵ    ü , ׷   ؽó Ѿϴ.
+		 */
+		uint64_t usedByteSize = residentByteSize_ + reservedByteSize_;
+		if (usedByteSize <= budgetByteSize_)
+		{
+			while (mipLevel < maxMipLevel && usedByteSize + texture->GetGPUMemoryByteSize(mipLevel) > budgetByteSize_)
+			{
+				++mipLevel;
+			}
+
+			if (usedByteSize + texture->GetGPUMemoryByteSize(mipLevel) > budgetByteSize_)
+			{
+				continue;
+			}
+		}
+
+		peakByteSize_ = std::max(peakByteSize_, usedByteSize + texture->GetGPUMemoryByteSize(mipLevel));
+		texture->EvictMipLevels(mipLevel);
+		residentByteSize_ -= residentByteSize - texture->GetGPUMemoryByteSize();
+		evictedLevelCount_ += static_cast<uint32_t>(mipLevel - residentMipLevel);
+
+		if (residentByteSize_ <= targetByteSize)
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+int32_t TextureResidencyManager::GetMaxResidentMipLevel(const Texture2D* texture)
+{
+	int32_t maxMipLevel = 0;
+	for (int32_t size = std::max(texture->GetWidth(), texture->GetHeight()); size > MIN_RESIDENT_SIZE && maxMipLevel + 1 < texture->GetMipLevelCount(); size >>= 1)
+	{
+		++maxMipLevel;
+	}
+
+	return maxMipLevel;
+}
\ No newline at end of file
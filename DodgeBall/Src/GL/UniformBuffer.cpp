@@ -1,6 +1,9 @@
+#include <cstring>
+
 #include <glad/glad.h>
 
 #include "GL/GLAssert.h"
+#include "GL/GLManager.h"
 #include "GL/UniformBuffer.h"
 #include "Utils/Assertion.h"
 
@@ -9,9 +12,19 @@ UniformBuffer::UniformBuffer(uint32_t byteSize, const EUsage& usage)
 	, usage_(usage)
 {
 	GL_API_CHECK(glGenBuffers(1, &uniformBufferID_));
-	GL_API_CHECK(glBindBuffer(GL_UNIFORM_BUFFER, uniformBufferID_));
-	GL_API_CHECK(glBufferData(GL_UNIFORM_BUFFER, byteSize_, nullptr, static_cast<GLenum>(usage)));
-	GL_API_CHECK(glBindBuffer(GL_UNIFORM_BUFFER, 0));
+
+	if (usage_ == EUsage::PERSISTENT)
+	{
+		GLint alignment = 0;
+		GL_API_CHECK(glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &alignment));
+
+		persistentBufferRing_.Initialize(GL_UNIFORM_BUFFER, uniformBufferID_, byteSize_, static_cast<uint32_t>(alignment));
+	}
+	else
+	{
+		GLManager::GetRef().BindBuffer(GL_UNIFORM_BUFFER, uniformBufferID_);
+		GL_API_CHECK(glBufferData(GL_UNIFORM_BUFFER, byteSize_, nullptr, static_cast<GLenum>(usage)));
+	}
 
 	bIsInitialized_ = true;
 }
@@ -20,10 +33,11 @@ UniformBuffer::UniformBuffer(const void* bufferPtr, uint32_t byteSize, const EUs
 	: byteSize_(byteSize)
 	, usage_(usage)
 {
+	ASSERT(usage_ != EUsage::PERSISTENT, "Persistent buffer must be written through Allocate.");
+
 	GL_API_CHECK(glGenBuffers(1, &uniformBufferID_));
-	GL_API_CHECK(glBindBuffer(GL_UNIFORM_BUFFER, uniformBufferID_));
+	GLManager::GetRef().BindBuffer(GL_UNIFORM_BUFFER, uniformBufferID_);
 	GL_API_CHECK(glBufferData(GL_UNIFORM_BUFFER, byteSize_, bufferPtr, static_cast<GLenum>(usage)));
-	GL_API_CHECK(glBindBuffer(GL_UNIFORM_BUFFER, 0));
 
 	bIsInitialized_ = true;
 }
@@ -40,6 +54,12 @@ void UniformBuffer::Release()
 {
 	CHECK(bIsInitialized_);
 
+	if (persistentBufferRing_.IsMapped())
+	{
+		persistentBufferRing_.Release();
+	}
+
+	GLManager::GetRef().OnDeleteBuffer(uniformBufferID_);
 	GL_API_CHECK(glDeleteBuffers(1, &uniformBufferID_));
 
 	bIsInitialized_ = false;
@@ -47,23 +67,30 @@ void UniformBuffer::Release()
 
 void UniformBuffer::Bind()
 {
-	GL_API_CHECK(glBindBuffer(GL_UNIFORM_BUFFER, uniformBufferID_));
+	GLManager::GetRef().BindBuffer(GL_UNIFORM_BUFFER, uniformBufferID_);
 }
 
 void UniformBuffer::Unbind()
 {
-	GL_API_CHECK(glBindBuffer(GL_UNIFORM_BUFFER, 0));
+	GLManager::GetRef().BindBuffer(GL_UNIFORM_BUFFER, 0);
 }
 
 void UniformBuffer::BindSlot(const uint32_t slot)
 {
-	GL_API_CHECK(glBindBufferBase(GL_UNIFORM_BUFFER, slot, uniformBufferID_));
+	GLManager::GetRef().BindBufferRange(GL_UNIFORM_BUFFER, slot, uniformBufferID_);
+}
+
+void UniformBuffer::BindSlot(const uint32_t slot, uint32_t offset, uint32_t byteSize)
+{
+	GLManager::GetRef().BindBufferRange(GL_UNIFORM_BUFFER, slot, uniformBufferID_, offset, byteSize);
 }
 
 void UniformBuffer::SetBufferData(const void* bufferPtr, uint32_t bufferSize)
 {
 	CHECK(bufferPtr != nullptr && bufferSize <= byteSize_);
+	ASSERT(usage_ != EUsage::PERSISTENT, "Persistent buffer must be written through Allocate.");
 
+	/** ۸ ε ·  ιǷ,  ۸  ϸ ε ȣ ˴ϴ. */
 	UniformBuffer::Bind();
 	{
 		switch (usage_)
@@ -92,5 +119,10 @@ void UniformBuffer::SetBufferData(const void* bufferPtr, uint32_t bufferSize)
 			ASSERT(false, "Undefined buffer usage type.");
 		}
 	}
-	UniformBuffer::Unbind();
+}
+
+BufferAllocation UniformBuffer::Allocate(uint32_t byteSize)
+{
+	CHECK(usage_ == EUsage::PERSISTENT && byteSize <= byteSize_);
+	return persistentBufferRing_.Allocate(byteSize);
 }
\ No newline at end of file
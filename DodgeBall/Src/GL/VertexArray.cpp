@@ -0,0 +1,136 @@
+#include <glad/glad.h>
+
+#include "GL/GLAssert.h"
+#include "GL/GLManager.h"
+#include "GL/IndexBuffer.h"
+#include "GL/VertexArray.h"
+#include "GL/VertexBuffer.h"
+#include "Utils/Assertion.h"
+
+/** ̾ƿ Ӽ ġ ϴ Ӽ ִ Ȯմϴ. */
+static bool IsLocationUsed(const VertexLayout& layout, uint32_t location)
+{
+	for (const auto& attribute : layout.attributes)
+	{
+		if (attribute.location == location)
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+VertexArray::VertexArray()
+{
+	GL_API_CHECK(glCreateVertexArrays(1, &vertexArrayID_));
+
+	bIsInitialized_ = true;
+}
+
+VertexArray::~VertexArray()
+{
+	if (bIsInitialized_)
+	{
+		Release();
+	}
+}
+
+void VertexArray::Release()
+{
+	CHECK(bIsInitialized_);
+
+	GLManager::GetRef().OnDeleteVertexArray(vertexArrayID_);
+	GL_API_CHECK(glDeleteVertexArrays(1, &vertexArrayID_));
+
+	indexBuffer_ = nullptr;
+	layoutIDs_.fill(0);
+	bIsInitialized_ = false;
+}
+
+void VertexArray::SetVertexBuffer(uint32_t bindingIndex, VertexBuffer* vertexBuffer, const VertexLayout& layout, uint32_t offset)
+{
+	CHECK(bindingIndex < MAX_VERTEX_BUFFER_BINDINGS && vertexBuffer != nullptr && layout.stride > 0);
+
+	GLManager& glManager = GLManager::GetRef();
+
+	uint32_t layoutID = glManager.RegisterVertexLayout(layout);
+	if (layoutIDs_[bindingIndex] != layoutID)
+	{
+		/**  ̾ƿ  Ӽ ġ Ȱȭմϴ. Ȱ ·   ε ε  ۸   нϴ. */
+		uint32_t disabledAttributeCount = 0;
+		if (layoutIDs_[bindingIndex] != 0)
+		{
+			const VertexLayout& prevLayout = glManager.GetVertexLayout(layoutIDs_[bindingIndex]);
+			for (const auto& attribute : prevLayout.attributes)
+			{
+				if (IsLocationUsed(layout, attribute.location) || IsLocationUsedByOtherBinding(bindingIndex, attribute.location))
+				{
+					continue;
+				}
+
+				GL_API_CHECK(glDisableVertexArrayAttrib(vertexArrayID_, attribute.location));
+				++disabledAttributeCount;
+			}
+		}
+
+		for (const auto& attribute : layout.attributes)
+		{
+			CHECK(attribute.componentCount >= 1 && attribute.componentCount <= 4);
+
+			GLenum type = static_cast<GLenum>(attribute.type);
+
+			GL_API_CHECK(glEnableVertexArrayAttrib(vertexArrayID_, attribute.location));
+			if (attribute.type != VertexAttribute::EType::FLOAT && !attribute.bIsNormalized)
+			{
+				GL_API_CHECK(glVertexArrayAttribIFormat(vertexArrayID_, attribute.location, attribute.componentCount, type, attribute.offset));
+			}
+			else
+			{
+				GL_API_CHECK(glVertexArrayAttribFormat(vertexArrayID_, attribute.location, attribute.componentCount, type, attribute.bIsNormalized, attribute.offset));
+			}
+			GL_API_CHECK(glVertexArrayAttribBinding(vertexArrayID_, attribute.location, bindingIndex));
+		}
+		GL_API_CHECK(glVertexArrayBindingDivisor(vertexArrayID_, bindingIndex, layout.divisor));
+
+		layoutIDs_[bindingIndex] = layoutID;
+		glManager.AddVertexFormatCallCount(static_cast<uint32_t>(layout.attributes.size()) * 3 + 1 + disabledAttributeCount);
+	}
+
+	GL_API_CHECK(glVertexArrayVertexBuffer(vertexArrayID_, bindingIndex, vertexBuffer->GetVertexBufferID(), static_cast<GLintptr>(offset), static_cast<GLsizei>(layout.stride)));
+}
+
+bool VertexArray::IsLocationUsedByOtherBinding(uint32_t bindingIndex, uint32_t location) const
+{
+	GLManager& glManager = GLManager::GetRef();
+
+	for (uint32_t index = 0; index < MAX_VERTEX_BUFFER_BINDINGS; ++index)
+	{
+		if (index != bindingIndex && layoutIDs_[index] != 0 && IsLocationUsed(glManager.GetVertexLayout(layoutIDs_[index]), location))
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void VertexArray::SetIndexBuffer(IndexBuffer* indexBuffer)
+{
+	CHECK(indexBuffer != nullptr);
+
+	GL_API_CHECK(glVertexArrayElementBuffer(vertexArrayID_, indexBuffer->GetIndexBufferID()));
+	GLManager::GetRef().OnSetElementBuffer(vertexArrayID_, indexBuffer->GetIndexBufferID());
+
+	indexBuffer_ = indexBuffer;
+}
+
+void VertexArray::Bind()
+{
+	GLManager::GetRef().BindVertexArray(vertexArrayID_);
+}
+
+void VertexArray::Unbind()
+{
+	GLManager::GetRef().BindVertexArray(0);
+}
\ No newline at end of file
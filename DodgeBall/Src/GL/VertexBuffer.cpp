@@ -1,6 +1,9 @@
+#include <cstring>
+
 #include <glad/glad.h>
 
 #include "GL/GLAssert.h"
+#include "GL/GLManager.h"
 #include "GL/VertexBuffer.h"
 #include "Utils/Assertion.h"
 
@@ -9,9 +12,16 @@ VertexBuffer::VertexBuffer(uint32_t byteSize, const EUsage& usage)
 	, usage_(usage)
 {
 	GL_API_CHECK(glGenBuffers(1, &vertexBufferID_));
-	GL_API_CHECK(glBindBuffer(GL_ARRAY_BUFFER, vertexBufferID_));
-	GL_API_CHECK(glBufferData(GL_ARRAY_BUFFER, byteSize_, nullptr, static_cast<GLenum>(usage)));
-	GL_API_CHECK(glBindBuffer(GL_ARRAY_BUFFER, 0));
+
+	if (usage_ == EUsage::PERSISTENT)
+	{
+		persistentBufferRing_.Initialize(GL_ARRAY_BUFFER, vertexBufferID_, byteSize_, 1);
+	}
+	else
+	{
+		GLManager::GetRef().BindBuffer(GL_ARRAY_BUFFER, vertexBufferID_);
+		GL_API_CHECK(glBufferData(GL_ARRAY_BUFFER, byteSize_, nullptr, static_cast<GLenum>(usage)));
+	}
 
 	bIsInitialized_ = true;
 }
@@ -20,10 +30,11 @@ VertexBuffer::VertexBuffer(const void* bufferPtr, uint32_t byteSize, const EUsag
 	: byteSize_(byteSize)
 	, usage_(usage)
 {
+	ASSERT(usage_ != EUsage::PERSISTENT, "Persistent buffer must be written through Allocate.");
+
 	GL_API_CHECK(glGenBuffers(1, &vertexBufferID_));
-	GL_API_CHECK(glBindBuffer(GL_ARRAY_BUFFER, vertexBufferID_));
+	GLManager::GetRef().BindBuffer(GL_ARRAY_BUFFER, vertexBufferID_);
 	GL_API_CHECK(glBufferData(GL_ARRAY_BUFFER, byteSize_, bufferPtr, static_cast<GLenum>(usage)));
-	GL_API_CHECK(glBindBuffer(GL_ARRAY_BUFFER, 0));
 
 	bIsInitialized_ = true;
 }
@@ -40,6 +51,12 @@ void VertexBuffer::Release()
 {
 	CHECK(bIsInitialized_);
 
+	if (persistentBufferRing_.IsMapped())
+	{
+		persistentBufferRing_.Release();
+	}
+
+	GLManager::GetRef().OnDeleteBuffer(vertexBufferID_);
 	GL_API_CHECK(glDeleteBuffers(1, &vertexBufferID_));
 
 	bIsInitialized_ = false;
@@ -47,18 +64,20 @@ void VertexBuffer::Release()
 
 void VertexBuffer::Bind()
 {
-	GL_API_CHECK(glBindBuffer(GL_ARRAY_BUFFER, vertexBufferID_));
+	GLManager::GetRef().BindBuffer(GL_ARRAY_BUFFER, vertexBufferID_);
 }
 
 void VertexBuffer::Unbind()
 {
-	GL_API_CHECK(glBindBuffer(GL_ARRAY_BUFFER, 0));
+	GLManager::GetRef().BindBuffer(GL_ARRAY_BUFFER, 0);
 }
 
 void VertexBuffer::SetBufferData(const void* bufferPtr, uint32_t bufferSize)
 {
 	CHECK(bufferPtr != nullptr && bufferSize <= byteSize_);
+	ASSERT(usage_ != EUsage::PERSISTENT, "Persistent buffer must be written through Allocate.");
 
+	/** ۸ ε ·  ιǷ,  ۸  ϸ ε ȣ ˴ϴ. */
 	VertexBuffer::Bind();
 	{
 		switch (usage_)
@@ -87,5 +106,19 @@ void VertexBuffer::SetBufferData(const void* bufferPtr, uint32_t bufferSize)
 			ASSERT(false, "Undefined buffer usage type.");
 		}
 	}
-	VertexBuffer::Unbind();
+}
+
+void VertexBuffer::SetBufferSubData(const void* bufferPtr, uint32_t offset, uint32_t bufferSize)
+{
+	CHECK(bufferPtr != nullptr && offset + bufferSize <= byteSize_);
+	ASSERT(usage_ != EUsage::PERSISTENT, "Persistent buffer must be written through Allocate.");
+
+	VertexBuffer::Bind();
+	GL_API_CHECK(glBufferSubData(GL_ARRAY_BUFFER, offset, bufferSize, bufferPtr));
+}
+
+BufferAllocation VertexBuffer::Allocate(uint32_t byteSize)
+{
+	CHECK(usage_ == EUsage::PERSISTENT && byteSize <= byteSize_);
+	return persistentBufferRing_.Allocate(byteSize);
 }
\ No newline at end of file
@@ -0,0 +1,26 @@
+#include "GL/VertexLayout.h"
+#include "Utils/NameID.h"
+
+/** 32Ʈ  Ʈ ؽ  մϴ. */
+static void HashValue(uint64_t& hash, uint32_t value)
+{
+	hash = NameID::HashBytes(hash, reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+uint64_t VertexLayout::GetHash() const
+{
+	uint64_t hash = NameID::FNV_OFFSET_BASIS;
+
+	HashValue(hash, stride);
+	HashValue(hash, divisor);
+	for (const auto& attribute : attributes)
+	{
+		HashValue(hash, attribute.location);
+		HashValue(hash, attribute.componentCount);
+		HashValue(hash, static_cast<uint32_t>(attribute.type));
+		HashValue(hash, static_cast<uint32_t>(attribute.bIsNormalized));
+		HashValue(hash, attribute.offset);
+	}
+
+	return hash;
+}
\ No newline at end of file
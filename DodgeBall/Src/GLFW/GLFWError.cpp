@@ -1,4 +1,4 @@
-#include <glfw/glfw3.h>
+#include <GLFW/glfw3.h>
 
 #include "GLFW/GLFWError.h"
 
@@ -1,3 +1,5 @@
+#include <cstdlib>
+
 #include <imgui.h>
 #include <imgui_impl_glfw.h>
 #include <imgui_impl_opengl3.h>
@@ -7,6 +9,7 @@
 
 #include "Utils/Assertion.h"
 #include "Utils/MemoryAlloc.h"
+#include "Utils/Profiler.h"
 
 #define GL_MAJOR_VERSION 4
 #define GL_MINOR_VERSION 6
@@ -173,8 +176,10 @@ GLFWManager* GLFWManager::GetPtr()
 }
 
 
-void GLFWManager::Startup(int32_t width, int32_t height, const char* title, bool bIsWindowCentered)
+void GLFWManager::Startup(int32_t width, int32_t height, const char* title, bool bIsWindowCentered, const ERunMode& runMode, bool bIsDebugContext)
 {
+	runMode_ = runMode;
+
 	glfwSetErrorCallback(GLFWError::SetLastError);
 
 	GLFWallocator allocator;
@@ -183,6 +188,12 @@ void GLFWManager::Startup(int32_t width, int32_t height, const char* title, bool
 	allocator.deallocate = MemoryFree;
 
 	GLFW_API_CHECK(glfwInitAllocator(&allocator));
+
+	if (runMode_ == ERunMode::SIMULATION || (runMode_ == ERunMode::HEADLESS && !IsDisplayAvailable()))
+	{
+		GLFW_API_CHECK(glfwInitHint(GLFW_PLATFORM, GLFW_PLATFORM_NULL));
+	}
+
 	GLFW_EXP_CHECK(glfwInit());
 
 	GLFW_API_CHECK(glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, GL_MAJOR_VERSION));
@@ -190,6 +201,35 @@ void GLFWManager::Startup(int32_t width, int32_t height, const char* title, bool
 	GLFW_API_CHECK(glfwWindowHint(GLFW_RESIZABLE, GLFW_FALSE));
 	GLFW_API_CHECK(glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE));
 
+	/**  (KHR_debug) ޽  ؽƮ  ˴ϴ.    İ   ؽƮ մϴ. */
+#if defined(DEBUG_MODE) || defined(RELWITHDEBINFO_MODE) || defined(GL_CALLBACK_VALIDATION)
+	bIsDebugContext = true;
+#endif
+	if (bIsDebugContext)
+	{
+		GLFW_API_CHECK(glfwWindowHint(GLFW_OPENGL_DEBUG_CONTEXT, GLFW_TRUE));
+	}
+
+	switch (runMode_)
+	{
+	case ERunMode::HEADLESS:
+		GLFW_API_CHECK(glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE));
+		if (glfwGetPlatform() == GLFW_PLATFORM_NULL)
+		{
+			/** ÷̰  ȯ濡 OSMesa  ũ ؽƮ մϴ. */
+			GLFW_API_CHECK(glfwWindowHint(GLFW_CONTEXT_CREATION_API, GLFW_OSMESA_CONTEXT_API));
+		}
+		break;
+
+	case ERunMode::SIMULATION:
+		GLFW_API_CHECK(glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE));
+		GLFW_API_CHECK(glfwWindowHint(GLFW_CLIENT_API, GLFW_NO_API));
+		break;
+
+	default:
+		break;
+	}
+
 	mainWindowWidth_ = width;
 	mainWindowHeight_ = height;
 
@@ -222,9 +262,19 @@ void GLFWManager::Startup(int32_t width, int32_t height, const char* title, bool
 	std::fill(prevMouseState_.begin(), prevMouseState_.end(), 0);
 	std::fill(currMouseState_.begin(), currMouseState_.end(), 0);
 
-	ASSERT(ImGui_ImplGlfw_InitForOpenGL(mainWindow_, true), "Failed to initialize ImGui for GLFW");
+	if (runMode_ == ERunMode::SIMULATION)
+	{
+		ASSERT(ImGui_ImplGlfw_InitForOther(mainWindow_, true), "Failed to initialize ImGui for GLFW");
+
+		/** Ʈ Ʋ󽺸   鿣尡 Ƿ  մϴ. */
+		io.Fonts->Build();
+	}
+	else
+	{
+		ASSERT(ImGui_ImplGlfw_InitForOpenGL(mainWindow_, true), "Failed to initialize ImGui for GLFW");
+	}
 
-	if (bIsWindowCentered)
+	if (bIsWindowCentered && runMode_ == ERunMode::WINDOWED)
 	{
 		GLFWmonitor* monitor = glfwGetPrimaryMonitor();
 		const GLFWvidmode* mode = glfwGetVideoMode(monitor);
@@ -255,11 +305,16 @@ void GLFWManager::Shutdown()
 
 void GLFWManager::Tick()
 {
+	PROFILE_SCOPE("GLFWManager::Tick");
+
 	bIsDetectMoveWindow_ = false;
 	prevCursorPos_ = currCursorPos_;
 
 	glfwPollEvents();
-	ImGui_ImplOpenGL3_NewFrame();
+	if (runMode_ != ERunMode::SIMULATION)
+	{
+		ImGui_ImplOpenGL3_NewFrame();
+	}
 	ImGui_ImplGlfw_NewFrame();
 	ImGui::NewFrame();
 
@@ -465,6 +520,18 @@ void GLFWManager::UpdateMouseState()
 	}
 }
 
+bool GLFWManager::IsDisplayAvailable()
+{
+#if defined(_WIN32) || defined(__APPLE__)
+	return true;
+#else
+	const char* x11Display = std::getenv("DISPLAY");
+	const char* waylandDisplay = std::getenv("WAYLAND_DISPLAY");
+
+	return (x11Display && x11Display[0] != '\0') || (waylandDisplay && waylandDisplay[0] != '\0');
+#endif
+}
+
 void GLFWManager::RunWindowEventAction(const EWindowEvent& windowEvent)
 {
 	for (uint32_t index = 0; index < windowEventActionSize_; ++index)
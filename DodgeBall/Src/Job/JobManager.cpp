@@ -0,0 +1,251 @@
+#include <algorithm>
+
+#include "Job/JobManager.h"
+
+#include "Utils/Assertion.h"
+#include "Utils/Profiler.h"
+#include "Utils/Utils.h"
+
+JobManager JobManager::singleton_;
+
+/** ۾ ġ      εԴϴ. */
+static const uint32_t INVALID_DEQUE_INDEX = 0xFFFFFFFF;
+
+/**  尡 ϴ ۾ ġ  εԴϴ. */
+static thread_local uint32_t threadDequeIndex = INVALID_DEQUE_INDEX;
+
+/**  尡 ۾ ĥ    ǻ  Դϴ. */
+static thread_local uint32_t threadRandomState = 0;
+
+JobManager& JobManager::GetRef()
+{
+	return singleton_;
+}
+
+JobManager* JobManager::GetPtr()
+{
+	return &singleton_;
+}
+
+void JobManager::Startup(uint32_t workerCount)
+{
+	CHECK(workers_.empty());
+
+	if (workerCount == 0)
+	{
+		uint32_t hardwareThreadCount = std::thread::hardware_concurrency();
+		workerCount = (hardwareThreadCount > 1) ? hardwareThreadCount - 1 : 1;
+	}
+
+	bIsQuit_.store(false);
+
+	for (uint32_t index = 0; index <= workerCount; ++index)
+	{
+		deques_.push_back(std::unique_ptr<WorkStealingDeque<Job>>(new WorkStealingDeque<Job>(DEQUE_CAPACITY)));
+	}
+
+	threadDequeIndex = 0;
+	threadRandomState = 1;
+
+	for (uint32_t index = 1; index <= workerCount; ++index)
+	{
+		workers_.emplace_back([this, index]() { RunWorker(index); });
+	}
+}
+
+void JobManager::Shutdown()
+{
+	ASSERT(queuedJobCount_.load() == 0, "Shutdown job manager with queued jobs. (queued: %u)", queuedJobCount_.load());
+
+	{
+		std::lock_guard<std::mutex> lock(sleepMutex_);
+		bIsQuit_.store(true);
+	}
+	sleepCondition_.notify_all();
+
+	for (auto& worker : workers_)
+	{
+		worker.join();
+	}
+
+	workers_.clear();
+	deques_.clear();
+
+	threadDequeIndex = INVALID_DEQUE_INDEX;
+}
+
+void JobManager::Submit(const std::function<void()>& function, JobCounter* counter, JobCounter* dependency)
+{
+	Job* job = jobPool_.Create();
+	job->function = function;
+	job->counter = counter;
+
+	if (counter)
+	{
+		counter->pendingCount_.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	if (dependency)
+	{
+		std::lock_guard<std::mutex> lock(dependency->waitingJobsMutex_);
+		if (!dependency->IsDone())
+		{
+			dependency->waitingJobs_.push_back(job);
+			return; // ϴ īͰ 0 Ǹ Execute ٸ.
+		}
+	}
+
+	Schedule(job);
+}
+
+void JobManager::Wait(const JobCounter& counter)
+{
+	while (!counter.IsDone())
+	{
+		Job* job = FindJob();
+		if (job)
+		{
+			Execute(job);
+		}
+		else
+		{
+			std::this_thread::yield();
+		}
+	}
+
+	/**  ۾ Ϸ 尡 īͿ   ĥ  մϴ. Ŀ ī͸ ıص մϴ. */
+	std::lock_guard<std::mutex> lock(counter.waitingJobsMutex_);
+}
+
+void JobManager::ParallelFor(uint32_t count, uint32_t batchSize, const std::function<void(uint32_t, uint32_t)>& function)
+{
+	CHECK(batchSize > 0);
+
+	JobCounter counter;
+	for (uint32_t begin = 0; begin < count; begin += batchSize)
+	{
+		uint32_t end = std::min(count, begin + batchSize);
+		Submit([&function, begin, end]() { function(begin, end); }, &counter);
+	}
+
+	Wait(counter);
+}
+
+void JobManager::RunWorker(uint32_t dequeIndex)
+{
+	threadDequeIndex = dequeIndex;
+	threadRandomState = dequeIndex * 0x9E3779B9u + 1;
+
+	Profiler::SetThreadName(PrintF("Worker %u", dequeIndex));
+
+	while (!bIsQuit_.load(std::memory_order_relaxed))
+	{
+		Job* job = FindJob();
+		if (job)
+		{
+			Execute(job);
+			continue;
+		}
+
+		std::unique_lock<std::mutex> lock(sleepMutex_);
+		sleepingWorkerCount_.fetch_add(1);
+		sleepCondition_.wait(lock, [this]() { return queuedJobCount_.load() > 0 || bIsQuit_.load(); });
+		sleepingWorkerCount_.fetch_sub(1);
+	}
+}
+
+void JobManager::Schedule(Job* job)
+{
+	/** ۾  ߰ϱ  Ѿ ۾  尡 ҽų    ʽϴ. */
+	queuedJobCount_.fetch_add(1);
+
+	uint32_t dequeIndex = threadDequeIndex;
+	if (dequeIndex >= deques_.size() || !deques_[dequeIndex]->Push(job))
+	{
+		std::lock_guard<std::mutex> lock(globalQueueMutex_);
+		globalQueue_.push_back(job);
+	}
+
+	if (sleepingWorkerCount_.load() > 0)
+	{
+		std::lock_guard<std::mutex> lock(sleepMutex_);
+		sleepCondition_.notify_one();
+	}
+}
+
+Job* JobManager::FindJob()
+{
+	Job* job = nullptr;
+	uint32_t dequeIndex = threadDequeIndex;
+	uint32_t dequeCount = static_cast<uint32_t>(deques_.size());
+
+	if (dequeIndex < dequeCount)
+	{
+		job = deques_[dequeIndex]->Pop();
+	}
+
+	if (!job && dequeCount > 0)
+	{
+		/**  尡   ġ  ʵ ǻ  ġ ȸմϴ. */
+		threadRandomState ^= threadRandomState << 13;
+		threadRandomState ^= threadRandomState >> 17;
+		threadRandomState ^= threadRandomState << 5;
+
+		uint32_t victimOffset = threadRandomState % dequeCount;
+		for (uint32_t index = 0; index < dequeCount && !job; ++index)
+		{
+			uint32_t victimIndex = (victimOffset + index) % dequeCount;
+			if (victimIndex != dequeIndex)
+			{
+				job = deques_[victimIndex]->Steal();
+			}
+		}
+	}
+
+	if (!job)
+	{
+		std::lock_guard<std::mutex> lock(globalQueueMutex_);
+		if (!globalQueue_.empty())
+		{
+			job = globalQueue_.front();
+			globalQueue_.pop_front();
+		}
+	}
+
+	if (job)
+	{
+		queuedJobCount_.fetch_sub(1);
+	}
+
+	return job;
+}
+
+void JobManager::Execute(Job* job)
+{
+	{
+		PROFILE_SCOPE("JobManager::Execute");
+		job->function();
+	}
+
+	JobCounter* counter = job->counter;
+	jobPool_.Destroy(job);
+
+	if (!counter)
+	{
+		return;
+	}
+
+	std::vector<Job*> waitingJobs;
+	{
+		std::lock_guard<std::mutex> lock(counter->waitingJobsMutex_);
+		if (counter->pendingCount_.fetch_sub(1, std::memory_order_acq_rel) == 1)
+		{
+			waitingJobs.swap(counter->waitingJobs_);
+		}
+	}
+
+	for (auto& waitingJob : waitingJobs)
+	{
+		Schedule(waitingJob);
+	}
+}
\ No newline at end of file
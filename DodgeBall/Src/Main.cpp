@@ -1,32 +1,288 @@
 #include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <vector>
+
+#if defined(_WIN32)
 #include <Windows.h>
+#endif
 
-#if defined(DEBUG_MODE) || defined(RELEASE_MODE) || defined(RELWITHDEBINFO_MODE)
+#if defined(_WIN32) && (defined(DEBUG_MODE) || defined(RELEASE_MODE) || defined(RELWITHDEBINFO_MODE))
 #include <crtdbg.h>
 #endif
 
 #include <glad/glad.h>
 
 #include "GL/GLManager.h"
+#include "GL/TextureLoader.h"
+#include "GL/TextureResidencyManager.h"
 #include "GLFW/GLFWManager.h"
 
-int32_t WINAPI wWinMain(_In_ HINSTANCE hInstance, _In_opt_ HINSTANCE hPrevInstance, _In_ LPWSTR pCmdLine, _In_ int32_t nCmdShow)
+#include "Job/JobManager.h"
+
+#include "Scene/BallStressScene.h"
+#include "Scene/TextureStreamScene.h"
+
+#include "Utils/FrameLoop.h"
+#include "Utils/GameTimer.h"
+#include "Utils/Profiler.h"
+
+/**
+ *  ڷ ޵  ɼԴϴ.
+ * --headless            : ȭ鿡  ʴ  OpenGL ؽƮ մϴ.
+ * --headless=simulation :  ý۰ OpenGL ؽƮ  ùķ̼Ǹ մϴ.
+ * --frames=N            : N    մϴ. 0̸ 츦   մϴ.
+ * --sim-hz=N            : ùķ̼  ļ(Hz)Դϴ. ⺻  60Դϴ.
+ * --sim-thread          :  尡 ϴ  ùķ̼ Ŀ 忡 մϴ.
+ * --profile=PATH        : ϴ  CPU  ̺Ʈ ĸóϰ,   Chrome Ʈ̽ JSON Ϸ մϴ.
+ * --gl-validation=MODE  : OpenGL API ȣ  Դϴ. none, strict, debug-output, debug-output-sync  ϳԴϴ.
+ * --balls=N             : N  νϽ  ׸ Ʈ  մϴ. 0̸   ʽϴ.
+ * --shader-cache=PATH   : ̴ α׷ ̳ʸ ĳ ͸Դϴ. none̸ ĳø  ʰ Ź ҽ մϴ.
+ * --texture-budget=MB   : ؽó ϴ GPU ޸ (MiB)Դϴ.      ؽó ū   ϴ.
+ * --textures=N          : ȸϴ ī޶  N ؽó г ׸ ؽó Ʈ  մϴ. 0̸   ʽϴ.
+ */
+struct RunOption
+{
+	ERunMode runMode = ERunMode::WINDOWED;
+	uint64_t maxFrameCount = 0;
+	double simulationHz = 60.0;
+	bool bIsThreadedSimulation = false;
+	std::string profilePath;
+	EGLValidationMode validationMode = GLManager::DEFAULT_VALIDATION_MODE;
+	uint32_t ballCount = 0;
+	std::string programBinaryCachePath = "ShaderCache";
+	uint64_t textureBudgetByteSize = TextureResidencyManager::DEFAULT_BUDGET_BYTE_SIZE;
+	uint32_t textureCount = 0;
+};
+
+static RunOption ParseRunOption(const std::vector<std::string>& arguments)
 {
-	GLFWManager::GetRef().Startup(1000, 800, "DodgeBall", true);
-	GLManager::GetRef().Startup();
+	static const std::string FRAMES_OPTION = "--frames=";
+	static const std::string SIMULATION_HZ_OPTION = "--sim-hz=";
+	static const std::string PROFILE_OPTION = "--profile=";
+	static const std::string GL_VALIDATION_OPTION = "--gl-validation=";
+	static const std::string BALLS_OPTION = "--balls=";
+	static const std::string SHADER_CACHE_OPTION = "--shader-cache=";
+	static const std::string TEXTURE_BUDGET_OPTION = "--texture-budget=";
+	static const std::string TEXTURES_OPTION = "--textures=";
+
+	RunOption runOption;
+	for (const auto& argument : arguments)
+	{
+		if (argument == "--headless")
+		{
+			runOption.runMode = ERunMode::HEADLESS;
+		}
+		else if (argument == "--headless=simulation")
+		{
+			runOption.runMode = ERunMode::SIMULATION;
+		}
+		else if (argument.compare(0, FRAMES_OPTION.size(), FRAMES_OPTION) == 0)
+		{
+			runOption.maxFrameCount = std::strtoull(argument.c_str() + FRAMES_OPTION.size(), nullptr, 10);
+		}
+		else if (argument.compare(0, SIMULATION_HZ_OPTION.size(), SIMULATION_HZ_OPTION) == 0)
+		{
+			double simulationHz = std::strtod(argument.c_str() + SIMULATION_HZ_OPTION.size(), nullptr);
+			runOption.simulationHz = (simulationHz > 0.0) ? simulationHz : runOption.simulationHz;
+		}
+		else if (argument == "--sim-thread")
+		{
+			runOption.bIsThreadedSimulation = true;
+		}
+		else if (argument.compare(0, PROFILE_OPTION.size(), PROFILE_OPTION) == 0)
+		{
+			runOption.profilePath = argument.substr(PROFILE_OPTION.size());
+		}
+		else if (argument.compare(0, GL_VALIDATION_OPTION.size(), GL_VALIDATION_OPTION) == 0)
+		{
+			std::string validationMode = argument.substr(GL_VALIDATION_OPTION.size());
+			if (validationMode == "none")
+			{
+				runOption.validationMode = EGLValidationMode::NONE;
+			}
+			else if (validationMode == "strict")
+			{
+				runOption.validationMode = EGLValidationMode::STRICT;
+			}
+			else if (validationMode == "debug-output")
+			{
+				runOption.validationMode = EGLValidationMode::DEBUG_OUTPUT;
+			}
+			else if (validationMode == "debug-output-sync")
+			{
+				runOption.validationMode = EGLValidationMode::DEBUG_OUTPUT_SYNCHRONOUS;
+			}
+		}
+		else if (argument.compare(0, BALLS_OPTION.size(), BALLS_OPTION) == 0)
+		{
+			runOption.ballCount = static_cast<uint32_t>(std::strtoul(argument.c_str() + BALLS_OPTION.size(), nullptr, 10));
+		}
+		else if (argument.compare(0, SHADER_CACHE_OPTION.size(), SHADER_CACHE_OPTION) == 0)
+		{
+			std::string programBinaryCachePath = argument.substr(SHADER_CACHE_OPTION.size());
+			runOption.programBinaryCachePath = (programBinaryCachePath == "none") ? "" : programBinaryCachePath;
+		}
+		else if (argument.compare(0, TEXTURE_BUDGET_OPTION.size(), TEXTURE_BUDGET_OPTION) == 0)
+		{
+			uint64_t textureBudgetMiB = std::strtoull(argument.c_str() + TEXTURE_BUDGET_OPTION.size(), nullptr, 10);
+			runOption.textureBudgetByteSize = (textureBudgetMiB > 0) ? (textureBudgetMiB * 1024 * 1024) : runOption.textureBudgetByteSize;
+		}
+		else if (argument.compare(0, TEXTURES_OPTION.size(), TEXTURES_OPTION) == 0)
+		{
+			runOption.textureCount = static_cast<uint32_t>(std::strtoul(argument.c_str() + TEXTURES_OPTION.size(), nullptr, 10));
+		}
+	}
+
+	return runOption;
+}
+
+static int32_t Run(const RunOption& runOption)
+{
+	Profiler::SetThreadName("Main");
+	if (!runOption.profilePath.empty())
+	{
+		Profiler::BeginCapture();
+	}
+
+	/**  ð  OpenGL ؽƮ   ̴/ҽ Դϴ. α׷ ̳ʸ ĳ ȿ  ð մϴ. */
+	uint64_t startupBeginTicks = GameTimer::GetCurrentTicks();
+
+	GLFWManager::GetRef().Startup(1000, 800, "DodgeBall", true, runOption.runMode, GLManager::IsDebugContextRequired(runOption.validationMode));
+	GLManager::GetRef().Startup(runOption.validationMode, runOption.programBinaryCachePath);
+	JobManager::GetRef().Startup();
+	TextureLoader::GetRef().Startup();
+	TextureResidencyManager::GetRef().Startup(runOption.textureBudgetByteSize);
 
 	bool bIsDone = false;
 	GLFWManager::GetRef().AddWindowEventAction(EWindowEvent::CLOSE_WINDOW, [&]() { bIsDone = true; }, true);
 
+	FrameLoop frameLoop(runOption.simulationHz, 5, runOption.bIsThreadedSimulation);
+
+	std::unique_ptr<BallStressScene> ballStressScene;
+	if (runOption.ballCount > 0)
+	{
+		ballStressScene = std::make_unique<BallStressScene>(runOption.ballCount, runOption.runMode != ERunMode::SIMULATION);
+		frameLoop.SetSimulateFunction([&](double stepSeconds) { ballStressScene->Simulate(stepSeconds); });
+		frameLoop.SetPublishFunction([&]() { ballStressScene->Publish(); });
+	}
+
+	std::unique_ptr<TextureStreamScene> textureStreamScene;
+	if (runOption.textureCount > 0 && runOption.runMode != ERunMode::SIMULATION)
+	{
+		textureStreamScene = std::make_unique<TextureStreamScene>(runOption.textureCount);
+	}
+
+	double startupSeconds = GameTimer::ConvertTicksToSeconds(GameTimer::GetCurrentTicks() - startupBeginTicks);
+
+	GameTimer timer;
+	timer.Reset();
+
+	uint64_t frameCount = 0;
 	while (!bIsDone)
 	{
+		PROFILE_SCOPE("Frame");
+
 		GLFWManager::GetRef().Tick();
 
+		frameLoop.BeginFrame(timer.GetDeltaSeconds());
+
 		GLManager::GetRef().BeginFrame(1.0f, 0.0f, 0.0f, 1.0f);
+		TextureLoader::GetRef().Tick();
+		TextureResidencyManager::GetRef().Tick();
+		if (ballStressScene)
+		{
+			ballStressScene->Render(frameLoop.GetAlpha());
+		}
+		if (textureStreamScene)
+		{
+			textureStreamScene->Render();
+		}
 		GLManager::GetRef().EndFrame();
+
+		frameLoop.EndFrame();
+
+		/**   ڿ Tick ȣؼ,  ð ð   ġϰ     ð  ʵ մϴ. ù  Ÿ ð 0Դϴ. */
+		timer.Tick();
+
+		++frameCount;
+		if (runOption.maxFrameCount != 0 && frameCount >= runOption.maxFrameCount)
+		{
+			bIsDone = true;
+		}
+	}
+
+	if (runOption.runMode != ERunMode::WINDOWED)
+	{
+		double totalSeconds = timer.GetTotalSeconds();
+		std::printf("frames: %llu, total: %.3f s, average: %.3f ms, simulation steps: %llu\n", static_cast<unsigned long long>(frameCount), totalSeconds, 1000.0 * totalSeconds / static_cast<double>(frameCount), static_cast<unsigned long long>(frameLoop.GetStepCount()));
+
+		FrameTimeStatistics statistics = timer.GetFrameTimeStatistics();
+		std::printf("frame time (last %u frames): min: %.3f ms, average: %.3f ms, p99: %.3f ms, max: %.3f ms\n", statistics.sampleCount, 1000.0 * statistics.minSeconds, 1000.0 * statistics.averageSeconds, 1000.0 * statistics.p99Seconds, 1000.0 * statistics.maxSeconds);
+
+		if (runOption.runMode == ERunMode::HEADLESS)
+		{
+			std::printf("startup: %.3f ms", 1000.0 * startupSeconds);
+			if (const ProgramBinaryCache* programBinaryCache = GLManager::GetRef().GetProgramBinaryCache())
+			{
+				const ProgramBinaryCacheStatistics& cacheStatistics = programBinaryCache->GetStatistics();
+				std::printf(", program binary cache: hit: %u, miss: %u, rejected: %u, stored: %u", cacheStatistics.hitCount, cacheStatistics.missCount, cacheStatistics.rejectCount, cacheStatistics.storeCount);
+			}
+			std::printf("\n");
+
+			const GLStateStatistics& stateStatistics = GLManager::GetRef().GetStateStatistics();
+			std::printf("GL state calls (last frame): issued: %llu, skipped: %llu\n", static_cast<unsigned long long>(stateStatistics.issuedCallCount), static_cast<unsigned long long>(stateStatistics.skippedCallCount));
+			std::printf("GL state changes (last frame): buffer: %llu, vertex array: %llu, program: %llu, texture: %llu, vertex format: %llu\n", static_cast<unsigned long long>(stateStatistics.bufferBindCount), static_cast<unsigned long long>(stateStatistics.vertexArrayBindCount), static_cast<unsigned long long>(stateStatistics.programBindCount), static_cast<unsigned long long>(stateStatistics.textureBindCount), static_cast<unsigned long long>(stateStatistics.vertexFormatCallCount));
+
+			TextureLoaderStatistics loaderStatistics = TextureLoader::GetRef().GetStatistics();
+			std::printf("texture loader: resident: %u, failed: %u, pending decode: %u, pending upload: %u, upload (last frame): %llu bytes, %.3f ms\n", loaderStatistics.residentCount, loaderStatistics.failedCount, loaderStatistics.pendingDecodeCount, loaderStatistics.pendingUploadCount, static_cast<unsigned long long>(loaderStatistics.uploadByteCount), loaderStatistics.uploadMilliseconds);
+
+			TextureResidencyStatistics residencyStatistics = TextureResidencyManager::GetRef().GetStatistics();
+			std::printf("texture residency: textures: %u, resident: %.1f / %.1f MiB (full: %.1f MiB, reserved: %.1f MiB, peak: %.1f MiB), evicted levels: %llu, streamed levels: %llu, pending streams: %u, stream failures: %u\n", residencyStatistics.textureCount, static_cast<double>(residencyStatistics.residentByteSize) / (1024.0 * 1024.0), static_cast<double>(residencyStatistics.budgetByteSize) / (1024.0 * 1024.0), static_cast<double>(residencyStatistics.fullByteSize) / (1024.0 * 1024.0), static_cast<double>(residencyStatistics.reservedByteSize) / (1024.0 * 1024.0), static_cast<double>(residencyStatistics.peakByteSize) / (1024.0 * 1024.0), static_cast<unsigned long long>(residencyStatistics.totalEvictedLevelCount), static_cast<unsigned long long>(residencyStatistics.totalStreamedLevelCount), residencyStatistics.pendingStreamCount, residencyStatistics.streamFailedCount);
+
+			if (textureStreamScene)
+			{
+				const RenderQueueStatistics& queueStatistics = textureStreamScene->GetRenderQueueStatistics();
+				std::printf("render queue (last frame): commands: %u, program changes: %u, vertex array changes: %u, texture changes: %u, uniform buffer changes: %u\n", queueStatistics.commandCount, queueStatistics.programChangeCount, queueStatistics.vertexArrayChangeCount, queueStatistics.textureChangeCount, queueStatistics.uniformBufferChangeCount);
+			}
+		}
+	}
+
+	if (!runOption.profilePath.empty())
+	{
+		Profiler::EndCapture();
+		Profiler::WriteChromeTrace(runOption.profilePath);
 	}
-	
+
+	ballStressScene.reset();
+	textureStreamScene.reset();
+
+	TextureResidencyManager::GetRef().Shutdown();
+	TextureLoader::GetRef().Shutdown();
+	JobManager::GetRef().Shutdown();
 	GLManager::GetRef().Shutdown();
 	GLFWManager::GetRef().Shutdown();
 	return 0;
-}
\ No newline at end of file
+}
+
+#if defined(_WIN32)
+int32_t WINAPI wWinMain(_In_ HINSTANCE hInstance, _In_opt_ HINSTANCE hPrevInstance, _In_ LPWSTR pCmdLine, _In_ int32_t nCmdShow)
+{
+	std::vector<std::string> arguments;
+	for (int32_t index = 1; index < __argc; ++index)
+	{
+		std::wstring argument = __wargv[index];
+		arguments.push_back(std::string(argument.begin(), argument.end())); /**  ɼ  ASCII ڿԴϴ. */
+	}
+
+	return Run(ParseRunOption(arguments));
+}
+#else
+int32_t main(int32_t argc, char* argv[])
+{
+	std::vector<std::string> arguments(argv + 1, argv + argc);
+	return Run(ParseRunOption(arguments));
+}
+#endif
\ No newline at end of file
@@ -0,0 +1,360 @@
+#include <cmath>
+#include <cstddef>
+#include <random>
+
+#include <glad/glad.h>
+#include <glm/gtc/matrix_transform.hpp>
+
+#include "GL/GLManager.h"
+#include "GL/InstancedMeshRenderer.h"
+#include "GL/MeshBatch.h"
+#include "GL/MeshOptimizer.h"
+#include "GL/Shader.h"
+#include "GL/ShaderCompileBatch.h"
+#include "GLFW/GLFWManager.h"
+#include "Job/JobManager.h"
+#include "Scene/BallStressScene.h"
+#include "Utils/Assertion.h"
+#include "Utils/GameTimer.h"
+#include "Utils/NameID.h"
+#include "Utils/Profiler.h"
+#include "Utils/Utils.h"
+
+/**  ƨ   ũԴϴ. */
+static const float BOX_HALF_EXTENT = 100.0f;
+
+/**  ּ/ִ  ִ ӷԴϴ. */
+static const float MIN_BALL_RADIUS = 0.3f;
+static const float MAX_BALL_RADIUS = 0.8f;
+static const float MAX_BALL_SPEED = 20.0f;
+
+/**  ۾ ϳ ó  Դϴ. */
+static const uint32_t BALL_BATCH_SIZE = 4096;
+
+/**  ޽(UV ) 浵/  Դϴ. νϽ Ƿ ؽ   մϴ. */
+static const uint32_t SPHERE_SLICE_COUNT = 12;
+static const uint32_t SPHERE_STACK_COUNT = 8;
+
+/**  ٴ Ÿ /  Դϴ. Ÿ   ޽Դϴ. */
+static const uint32_t ARENA_TILE_COUNT = 16;
+static const float ARENA_TILE_HEIGHT = 2.0f;
+
+/**  ̴  ̸Դϴ. */
+static constexpr NameID VIEW_PROJECTION("viewProjection");
+static constexpr NameID LIGHT_DIRECTION("lightDirection");
+static constexpr NameID TILE_COUNT("tileCount");
+
+/**  ̴Դϴ. Ÿ  ׸  (gl_DrawID) üũ ̸ ϴ. */
+static const char* ARENA_VS_SOURCE = R"(
+#version 460 core
+
+layout(location = 0) in vec3 inPosition;
+layout(location = 1) in vec3 inNormal;
+
+uniform mat4 viewProjection;
+
+out vec3 normal;
+flat out int drawID;
+
+void main()
+{
+	gl_Position = viewProjection * vec4(inPosition, 1.0f);
+
+	normal = inNormal;
+	drawID = gl_DrawID;
+}
+)";
+
+static const char* ARENA_FS_SOURCE = R"(
+#version 460 core
+
+in vec3 normal;
+flat in int drawID;
+
+uniform vec3 lightDirection;
+uniform int tileCount;
+
+layout(location = 0) out vec4 outColor;
+
+void main()
+{
+	int row = drawID / tileCount;
+	int column = drawID % tileCount;
+	vec3 color = (((row + column) & 1) == 0) ? vec3(0.35f, 0.35f, 0.4f) : vec3(0.55f, 0.55f, 0.6f);
+
+	float diffuse = max(dot(normalize(normal), -lightDirection), 0.0f);
+	outColor = vec4(color * (0.3f + 0.7f * diffuse), 1.0f);
+}
+)";
+
+/**    ޽ø մϴ. 鸶  ٸǷ ؽ  ʽϴ. */
+static void CreateBoxMesh(const glm::vec3& minPosition, const glm::vec3& maxPosition, std::vector<MeshVertex>& outVertices, std::vector<uint32_t>& outIndices)
+{
+	outVertices.clear();
+	outIndices.clear();
+
+	for (int32_t axis = 0; axis < 3; ++axis)
+	{
+		for (int32_t side = 0; side < 2; ++side)
+		{
+			glm::vec3 normal(0.0f);
+			normal[axis] = (side == 0) ? -1.0f : 1.0f;
+
+			int32_t uAxis = (axis + 1) % 3;
+			int32_t vAxis = (axis + 2) % 3;
+
+			uint32_t baseVertex = static_cast<uint32_t>(outVertices.size());
+			for (int32_t corner = 0; corner < 4; ++corner)
+			{
+				glm::vec3 position;
+				position[axis] = (side == 0) ? minPosition[axis] : maxPosition[axis];
+				position[uAxis] = (corner == 1 || corner == 2) ? maxPosition[uAxis] : minPosition[uAxis];
+				position[vAxis] = (corner >= 2) ? maxPosition[vAxis] : minPosition[vAxis];
+				outVertices.push_back({ position, normal });
+			}
+
+			if (side == 0)
+			{
+				outIndices.insert(outIndices.end(), { baseVertex, baseVertex + 2, baseVertex + 1, baseVertex, baseVertex + 3, baseVertex + 2 });
+			}
+			else
+			{
+				outIndices.insert(outIndices.end(), { baseVertex, baseVertex + 1, baseVertex + 2, baseVertex, baseVertex + 2, baseVertex + 3 });
+			}
+		}
+	}
+}
+
+/**  1 UV  ޽ø մϴ. */
+static void CreateSphereMesh(std::vector<MeshVertex>& outVertices, std::vector<uint32_t>& outIndices)
+{
+	const float pi = 3.14159265358979f;
+
+	outVertices.clear();
+	outIndices.clear();
+
+	for (uint32_t stack = 0; stack <= SPHERE_STACK_COUNT; ++stack)
+	{
+		float phi = pi * static_cast<float>(stack) / static_cast<float>(SPHERE_STACK_COUNT);
+		for (uint32_t slice = 0; slice <= SPHERE_SLICE_COUNT; ++slice)
+		{
+			float theta = 2.0f * pi * static_cast<float>(slice) / static_cast<float>(SPHERE_SLICE_COUNT);
+
+			glm::vec3 normal(std::sin(phi) * std::cos(theta), std::cos(phi), std::sin(phi) * std::sin(theta));
+			outVertices.push_back({ normal, normal });
+		}
+	}
+
+	uint32_t rowVertexCount = SPHERE_SLICE_COUNT + 1;
+	for (uint32_t stack = 0; stack < SPHERE_STACK_COUNT; ++stack)
+	{
+		for (uint32_t slice = 0; slice < SPHERE_SLICE_COUNT; ++slice)
+		{
+			uint32_t topLeft = stack * rowVertexCount + slice;
+			uint32_t bottomLeft = topLeft + rowVertexCount;
+
+			outIndices.insert(outIndices.end(), { topLeft, topLeft + 1, bottomLeft });
+			outIndices.insert(outIndices.end(), { topLeft + 1, bottomLeft + 1, bottomLeft });
+		}
+	}
+}
+
+BallStressScene::BallStressScene(uint32_t ballCount, bool bIsRenderable)
+	: ballCount_(ballCount)
+{
+	CHECK(ballCount_ > 0);
+
+	prevPositions_.resize(ballCount_);
+	currPositions_.resize(ballCount_);
+	velocities_.resize(ballCount_);
+	radii_.resize(ballCount_);
+	colors_.resize(ballCount_);
+
+	/** ึ   򵵷  õ带 մϴ. */
+	std::mt19937 generator(20240917u);
+	std::uniform_real_distribution<float> position(-BOX_HALF_EXTENT + MAX_BALL_RADIUS, BOX_HALF_EXTENT - MAX_BALL_RADIUS);
+	std::uniform_real_distribution<float> velocity(-MAX_BALL_SPEED, MAX_BALL_SPEED);
+	std::uniform_real_distribution<float> radius(MIN_BALL_RADIUS, MAX_BALL_RADIUS);
+	std::uniform_int_distribution<uint32_t> channel(64, 255);
+
+	for (uint32_t index = 0; index < ballCount_; ++index)
+	{
+		currPositions_[index] = glm::vec3(position(generator), position(generator), position(generator));
+		velocities_[index] = glm::vec3(velocity(generator), velocity(generator), velocity(generator));
+		radii_[index] = radius(generator);
+		colors_[index] = channel(generator) | (channel(generator) << 8) | (channel(generator) << 16) | (0xFFu << 24);
+	}
+
+	prevPositions_ = currPositions_;
+	renderPrevPositions_ = currPositions_;
+	renderCurrPositions_ = currPositions_;
+
+	if (bIsRenderable)
+	{
+		std::vector<MeshVertex> vertices;
+		std::vector<uint32_t> indices;
+		CreateSphereMesh(vertices, indices);
+
+		MeshOptimizationStatistics statistics = MeshOptimizer::Optimize(vertices, indices);
+		DebugPrintF("Ball mesh ACMR: %.3f -> %.3f (vertices: %u -> %u)\n", statistics.acmrBefore, statistics.acmrAfter, statistics.vertexCountBefore, statistics.vertexCountAfter);
+
+		/** ̴  񵿱 ϰ,    Render 游 ׸ϴ. */
+		shaderCompileBatch_ = std::make_unique<ShaderCompileBatch>();
+		shaderSubmitTicks_ = GameTimer::GetCurrentTicks();
+
+		renderer_ = std::make_unique<InstancedMeshRenderer>(vertices, indices, ballCount_, shaderCompileBatch_.get());
+
+		CreateArena();
+	}
+}
+
+BallStressScene::~BallStressScene()
+{
+	if (arenaShader_)
+	{
+		GLManager::GetRef().Destroy(arenaShader_);
+	}
+}
+
+void BallStressScene::Simulate(double stepSeconds)
+{
+	PROFILE_SCOPE("BallStressScene::Simulate");
+
+	float deltaSeconds = static_cast<float>(stepSeconds);
+	JobManager::GetRef().ParallelFor(ballCount_, BALL_BATCH_SIZE, [&](uint32_t begin, uint32_t end)
+		{
+			for (uint32_t index = begin; index < end; ++index)
+			{
+				glm::vec3& position = currPositions_[index];
+				glm::vec3& velocity = velocities_[index];
+				float limit = BOX_HALF_EXTENT - radii_[index];
+
+				prevPositions_[index] = position;
+				position += velocity * deltaSeconds;
+
+				for (int32_t axis = 0; axis < 3; ++axis)
+				{
+					if (position[axis] > limit)
+					{
+						position[axis] = 2.0f * limit - position[axis];
+						velocity[axis] = -velocity[axis];
+					}
+					else if (position[axis] < -limit)
+					{
+						position[axis] = -2.0f * limit - position[axis];
+						velocity[axis] = -velocity[axis];
+					}
+				}
+			}
+		}
+	);
+}
+
+void BallStressScene::Publish()
+{
+	renderPrevPositions_ = prevPositions_;
+	renderCurrPositions_ = currPositions_;
+}
+
+void BallStressScene::Render(double alpha)
+{
+	if (!renderer_)
+	{
+		return;
+	}
+
+	PROFILE_SCOPE("BallStressScene::Render");
+
+	if (shaderCompileBatch_)
+	{
+		if (!shaderCompileBatch_->Poll())
+		{
+			++shaderLoadingFrameCount_;
+			return;
+		}
+
+		double loadingSeconds = GameTimer::ConvertTicksToSeconds(GameTimer::GetCurrentTicks() - shaderSubmitTicks_);
+		DebugPrintF("Scene shaders are ready. (programs: %u, %.3f ms, loading frames: %llu)\n", shaderCompileBatch_->GetShaderCount(), 1000.0 * loadingSeconds, static_cast<unsigned long long>(shaderLoadingFrameCount_));
+		shaderCompileBatch_.reset();
+	}
+
+	float t = static_cast<float>(alpha);
+	MeshInstance* instances = renderer_->AllocateInstances(ballCount_);
+	JobManager::GetRef().ParallelFor(ballCount_, BALL_BATCH_SIZE, [&](uint32_t begin, uint32_t end)
+		{
+			for (uint32_t index = begin; index < end; ++index)
+			{
+				glm::vec3 position = glm::mix(renderPrevPositions_[index], renderCurrPositions_[index], t);
+
+				MeshInstance& instance = instances[index];
+				instance.positionScale = glm::vec4(position, radii_[index]);
+				instance.color = colors_[index];
+			}
+		}
+	);
+
+	float width = 0.0f;
+	float height = 0.0f;
+	GLFWManager::GetRef().GetWindowSize(width, height);
+
+	float aspect = (height > 0.0f) ? (width / height) : 1.0f;
+	glm::mat4 projection = glm::perspective(glm::radians(60.0f), aspect, 1.0f, 1000.0f);
+	glm::mat4 view = glm::lookAt(glm::vec3(0.0f, 0.5f * BOX_HALF_EXTENT, 2.5f * BOX_HALF_EXTENT), glm::vec3(0.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+	glm::vec3 lightDirection = glm::normalize(glm::vec3(-0.5f, -1.0f, -0.3f));
+
+	GLManager::GetRef().SetDepthMode(true);
+	renderer_->Draw(projection * view, lightDirection);
+	RenderArena(projection * view, lightDirection);
+}
+
+void BallStressScene::CreateArena()
+{
+	arenaShader_ = shaderCompileBatch_->Add(ARENA_VS_SOURCE, ARENA_FS_SOURCE);
+
+	VertexLayout layout;
+	layout.stride = sizeof(MeshVertex);
+	layout.attributes =
+	{
+		{ 0, 3, VertexAttribute::EType::FLOAT, false, offsetof(MeshVertex, position) },
+		{ 1, 3, VertexAttribute::EType::FLOAT, false, offsetof(MeshVertex, normal) },
+	};
+
+	uint32_t tileCount = ARENA_TILE_COUNT * ARENA_TILE_COUNT;
+	arenaBatch_ = std::make_unique<MeshBatch>(layout, tileCount * 24, tileCount * 36, tileCount);
+
+	std::vector<MeshVertex> vertices;
+	std::vector<uint32_t> indices;
+	float tileSize = 2.0f * BOX_HALF_EXTENT / static_cast<float>(ARENA_TILE_COUNT);
+	for (uint32_t row = 0; row < ARENA_TILE_COUNT; ++row)
+	{
+		for (uint32_t column = 0; column < ARENA_TILE_COUNT; ++column)
+		{
+			/** Ÿϸ ̸ ݾ ٸ ؼ Ÿ 谡 ̵ մϴ. */
+			float height = ARENA_TILE_HEIGHT * (1.0f + 0.25f * static_cast<float>((row * 7 + column * 3) % 4));
+
+			glm::vec3 minPosition(-BOX_HALF_EXTENT + tileSize * static_cast<float>(column), -BOX_HALF_EXTENT - height, -BOX_HALF_EXTENT + tileSize * static_cast<float>(row));
+			glm::vec3 maxPosition(minPosition.x + tileSize, -BOX_HALF_EXTENT, minPosition.z + tileSize);
+
+			CreateBoxMesh(minPosition, maxPosition, vertices, indices);
+			arenaBatch_->AddMesh(vertices.data(), static_cast<uint32_t>(vertices.size()), indices.data(), static_cast<uint32_t>(indices.size()));
+		}
+	}
+}
+
+void BallStressScene::RenderArena(const glm::mat4& viewProjection, const glm::vec3& lightDirection)
+{
+	PROFILE_SCOPE("BallStressScene::RenderArena");
+
+	arenaShader_->SetUniform(VIEW_PROJECTION, viewProjection);
+	arenaShader_->SetUniform(LIGHT_DIRECTION, lightDirection);
+	arenaShader_->SetUniform(TILE_COUNT, static_cast<int32_t>(ARENA_TILE_COUNT));
+
+	/** Ÿ  ̹Ƿ     ϰ,   ̴ gl_DrawID ˴ϴ. */
+	for (uint32_t meshIndex = 0; meshIndex < arenaBatch_->GetMeshCount(); ++meshIndex)
+	{
+		arenaBatch_->Submit(meshIndex);
+	}
+
+	arenaShader_->Bind();
+	arenaBatch_->Draw();
+}
\ No newline at end of file
@@ -0,0 +1,270 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include <glad/glad.h>
+#include <glm/gtc/matrix_transform.hpp>
+
+#include "GL/GLAssert.h"
+#include "GL/GLManager.h"
+#include "GL/IndexBuffer.h"
+#include "GL/RenderQueue.h"
+#include "GL/Shader.h"
+#include "GL/ShaderCompileBatch.h"
+#include "GL/Texture2D.h"
+#include "GL/TextureLoader.h"
+#include "GL/TextureResidencyManager.h"
+#include "GL/UniformBuffer.h"
+#include "GL/VertexArray.h"
+#include "GLFW/GLFWManager.h"
+#include "Scene/TextureStreamScene.h"
+#include "Utils/Assertion.h"
+#include "Utils/NameID.h"
+#include "Utils/Profiler.h"
+#include "Utils/Utils.h"
+
+/** ϴ ؽó ũ(RGB)Դϴ.    ϸ ؽó ϳ  5.3MiB GPU ޸𸮸 մϴ. */
+static const uint32_t TEXTURE_SIZE = 1024;
+static const uint32_t TEXTURE_CHANNELS = 3;
+
+/** г   ̿ ī޶κ ŸԴϴ.  гΰ  г   ʿ    ٸ մϴ. */
+static const float PANEL_SIZE = 4.0f;
+static const float NEAR_PANEL_DISTANCE = 8.0f;
+static const float FAR_PANEL_DISTANCE = 16.0f;
+
+/** ī޶ Ӹ ȸϴ ()  þ߰()Դϴ. 帮 ࿡   򵵷  ð  ȸմϴ. */
+static const float CAMERA_YAW_DEGREES_PER_FRAME = 1.5f;
+static const float CAMERA_FOV_DEGREES = 60.0f;
+static const float CAMERA_NEAR = 0.1f;
+static const float CAMERA_FAR = 100.0f;
+
+/** г ߽ ȭ ۿ ־ г Ϻΰ   Ƿ, Ŭ     þ߸ մϴ. */
+static const float VISIBLE_CLIP_EXTENT = 1.2f;
+
+/** г ̴  ̸Դϴ. */
+static constexpr NameID VIEW_PROJECTION("viewProjection");
+
+/** г 簢 εԴϴ. ε  ״ ̴ gl_VertexID ˴ϴ. */
+static const uint32_t PANEL_INDICES[] = { 0, 1, 2, 2, 1, 3 };
+
+/**
+ * г ̴Դϴ.  gl_VertexID  [-1, 1]  簢Դϴ.
+ * г    ť ׸⸶ εϴ ׸   (RenderQueue::DRAW_UNIFORM_BUFFER_SLOT) нϴ.
+ */
+static const char* PANEL_VS_SOURCE = R"(
+#version 460 core
+
+uniform mat4 viewProjection;
+
+layout(std140, binding = 0) uniform PanelDraw
+{
+	mat4 model;
+};
+
+out vec2 uv;
+
+void main()
+{
+	vec2 corner = vec2(gl_VertexID & 1, gl_VertexID >> 1);
+	gl_Position = viewProjection * model * vec4(2.0f * corner - 1.0f, 0.0f, 1.0f);
+
+	uv = corner;
+}
+)";
+
+static const char* PANEL_FS_SOURCE = R"(
+#version 460 core
+
+in vec2 uv;
+
+uniform sampler2D panelTexture;
+
+layout(location = 0) out vec4 outColor;
+
+void main()
+{
+	outColor = vec4(texture(panelTexture, uv).rgb, 1.0f);
+}
+)";
+
+/**
+ *  TGA ̹  մϴ. ؽó  ٸ üũ ̿  ڸ ļ,    ٸ մϴ.
+ *  ̹ ִٸ ٽ  ʽϴ.
+ */
+static bool WriteTGAFile(const std::string& path, uint32_t textureIndex)
+{
+	if (std::filesystem::exists(path))
+	{
+		return true;
+	}
+
+	FILE* file = std::fopen(path.c_str(), "wb");
+	if (!file)
+	{
+		return false;
+	}
+
+	uint8_t header[18] = {};
+	header[2] = 2; //  Ʈ ÷
+	header[12] = static_cast<uint8_t>(TEXTURE_SIZE & 0xFF);
+	header[13] = static_cast<uint8_t>(TEXTURE_SIZE >> 8);
+	header[14] = static_cast<uint8_t>(TEXTURE_SIZE & 0xFF);
+	header[15] = static_cast<uint8_t>(TEXTURE_SIZE >> 8);
+	header[16] = static_cast<uint8_t>(TEXTURE_CHANNELS * 8);
+	header[17] = 0x20; //   
+	std::fwrite(header, 1, sizeof(header), file);
+
+	uint8_t red = static_cast<uint8_t>(64 + (textureIndex * 97) % 192);
+	uint8_t green = static_cast<uint8_t>(64 + (textureIndex * 57) % 192);
+	uint8_t blue = static_cast<uint8_t>(64 + (textureIndex * 31) % 192);
+
+	std::vector<uint8_t> row(TEXTURE_SIZE * TEXTURE_CHANNELS);
+	for (uint32_t y = 0; y < TEXTURE_SIZE; ++y)
+	{
+		for (uint32_t x = 0; x < TEXTURE_SIZE; ++x)
+		{
+			bool bIsDark = (((x >> 7) ^ (y >> 7)) & 1) != 0;
+			bool bIsGrid = ((x & 15) == 0) || ((y & 15) == 0);
+
+			uint8_t* texel = &row[x * TEXTURE_CHANNELS];
+			texel[0] = bIsGrid ? 255 : (bIsDark ? blue / 2 : blue); // TGA BGR  
+			texel[1] = bIsGrid ? 255 : (bIsDark ? green / 2 : green);
+			texel[2] = bIsGrid ? 255 : (bIsDark ? red / 2 : red);
+		}
+		std::fwrite(row.data(), 1, row.size(), file);
+	}
+
+	std::fclose(file);
+	return true;
+}
+
+TextureStreamScene::TextureStreamScene(uint32_t textureCount)
+{
+	CHECK(textureCount > 0);
+
+	GLManager& glManager = GLManager::GetRef();
+
+	std::filesystem::path directory = std::filesystem::temp_directory_path() / "DodgeBallTextureStream";
+	std::filesystem::create_directories(directory);
+
+	/** г    Ƿ,    Ŀ    մϴ. */
+	int32_t uniformAlignment = 0;
+	GL_API_CHECK(glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &uniformAlignment));
+	uniformAlignment = std::max(uniformAlignment, 1);
+	panelUniformStride_ = ((static_cast<uint32_t>(sizeof(glm::mat4)) + uniformAlignment - 1) / uniformAlignment) * uniformAlignment;
+
+	std::vector<uint8_t> panelUniforms(textureCount * panelUniformStride_);
+
+	const float pi = 3.14159265358979f;
+	for (uint32_t index = 0; index < textureCount; ++index)
+	{
+		std::string path = (directory / ("Texture" + std::to_string(index) + ".tga")).string();
+		bool bIsWritten = WriteTGAFile(path, index);
+		ASSERT(bIsWritten, "Failed to write %s file.", path.c_str());
+
+		textures_.push_back(TextureLoader::GetRef().LoadAsync(path, ITexture::EFilter::LINEAR));
+
+		/** г ī޶() ٶ󺸵 ϴ. г ո(+Z)  մϴ. */
+		float angle = 2.0f * pi * static_cast<float>(index) / static_cast<float>(textureCount);
+		float distance = ((index & 1) == 0) ? NEAR_PANEL_DISTANCE : FAR_PANEL_DISTANCE;
+		glm::vec3 center(distance * std::sin(angle), 0.0f, -distance * std::cos(angle));
+
+		glm::mat4 transform = glm::inverse(glm::lookAt(center, 2.0f * center, glm::vec3(0.0f, 1.0f, 0.0f)));
+		transform = glm::scale(transform, glm::vec3(0.5f * PANEL_SIZE));
+		std::memcpy(&panelUniforms[index * panelUniformStride_], &transform, sizeof(glm::mat4));
+		panelCenters_.push_back(center);
+	}
+
+	panelUniformBuffer_ = glManager.Create<UniformBuffer>(panelUniforms.data(), static_cast<uint32_t>(panelUniforms.size()), UniformBuffer::EUsage::STATIC);
+
+	shaderCompileBatch_ = std::make_unique<ShaderCompileBatch>();
+	panelShader_ = shaderCompileBatch_->Add(PANEL_VS_SOURCE, PANEL_FS_SOURCE);
+
+	panelIndexBuffer_ = glManager.Create<IndexBuffer>(PANEL_INDICES, static_cast<uint32_t>(sizeof(PANEL_INDICES) / sizeof(PANEL_INDICES[0])));
+	vertexArray_ = glManager.Create<VertexArray>();
+	vertexArray_->SetIndexBuffer(panelIndexBuffer_);
+
+	renderQueue_ = std::make_unique<RenderQueue>();
+}
+
+TextureStreamScene::~TextureStreamScene()
+{
+	GLManager& glManager = GLManager::GetRef();
+
+	for (auto& texture : textures_)
+	{
+		glManager.Destroy(texture);
+	}
+
+	glManager.Destroy(vertexArray_);
+	glManager.Destroy(panelIndexBuffer_);
+	glManager.Destroy(panelUniformBuffer_);
+	glManager.Destroy(panelShader_);
+}
+
+void TextureStreamScene::Render()
+{
+	PROFILE_SCOPE("TextureStreamScene::Render");
+
+	if (shaderCompileBatch_)
+	{
+		if (!shaderCompileBatch_->Poll())
+		{
+			return;
+		}
+		shaderCompileBatch_.reset();
+	}
+
+	cameraYawDegrees_ = std::fmod(cameraYawDegrees_ + CAMERA_YAW_DEGREES_PER_FRAME, 360.0f);
+
+	float width = 0.0f;
+	float height = 0.0f;
+	GLFWManager::GetRef().GetWindowSize(width, height);
+
+	float aspect = (height > 0.0f) ? (width / height) : 1.0f;
+	float yaw = glm::radians(cameraYawDegrees_);
+	glm::mat4 projection = glm::perspective(glm::radians(CAMERA_FOV_DEGREES), aspect, CAMERA_NEAR, CAMERA_FAR);
+	glm::mat4 view = glm::lookAt(glm::vec3(0.0f), glm::vec3(std::sin(yaw), 0.0f, -std::cos(yaw)), glm::vec3(0.0f, 1.0f, 0.0f));
+	glm::mat4 viewProjection = projection * view;
+
+	GLManager::GetRef().SetDepthMode(true);
+	panelShader_->SetUniform(VIEW_PROJECTION, viewProjection);
+
+	/**  ؽó ϴ г(:  ڸ ǥ ؽó г)  ׸,  ȿ  гκ ׸ մϴ. */
+	RenderCommand command;
+	command.programID = panelShader_->GetProgramID();
+	command.vertexArrayID = vertexArray_->GetVertexArrayID();
+	command.uniformBufferID = panelUniformBuffer_->GetUniformBufferID();
+	command.uniformByteSize = static_cast<uint32_t>(sizeof(glm::mat4));
+	command.indexType = panelIndexBuffer_->GetType();
+	command.indexCount = panelIndexBuffer_->GetIndexCount();
+
+	TextureResidencyManager& residencyManager = TextureResidencyManager::GetRef();
+	for (uint32_t index = 0; index < static_cast<uint32_t>(textures_.size()); ++index)
+	{
+		glm::vec4 clipPosition = viewProjection * glm::vec4(panelCenters_[index], 1.0f);
+		if (clipPosition.w <= 0.0f || std::abs(clipPosition.x) > VISIBLE_CLIP_EXTENT * clipPosition.w)
+		{
+			continue;
+		}
+
+		/** г   ȭ鿡 ϴ ȼ Դϴ.  ̹Ƿ Ÿ(Ŭ  w) ݺմϴ. */
+		float screenPixelSize = PANEL_SIZE * projection[1][1] * 0.5f * height / clipPosition.w;
+		residencyManager.NotifyUsage(textures_[index], screenPixelSize);
+
+		uint32_t depth = static_cast<uint32_t>(std::min(clipPosition.w / CAMERA_FAR, 1.0f) * static_cast<float>((1u << RenderQueue::DEPTH_BITS) - 1));
+
+		command.textureID = textures_[index]->GetBindingTextureID();
+		command.sortKey = RenderQueue::MakeSortKey(0, 0, command.textureID, depth);
+		command.uniformOffset = index * panelUniformStride_;
+		renderQueue_->Submit(command);
+	}
+
+	renderQueue_->Sort();
+	renderQueue_->Execute();
+	renderQueue_->Reset();
+}
\ No newline at end of file
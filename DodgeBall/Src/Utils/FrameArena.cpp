@@ -0,0 +1,207 @@
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <new>
+#include <vector>
+
+#include "Utils/Assertion.h"
+#include "Utils/FrameArena.h"
+#include "Utils/MemoryAlloc.h"
+
+/**    Ҵ   ֵ  ũ⸦ ִ ⺻  ũ ϴ. */
+static const std::size_t BLOCK_HEADER_BYTE_SIZE = ((sizeof(void*) + sizeof(std::size_t) + alignof(std::max_align_t) - 1) / alignof(std::max_align_t)) * alignof(std::max_align_t);
+
+LinearArena::LinearArena(std::size_t blockByteSize)
+	: blockByteSize_(blockByteSize)
+{
+}
+
+LinearArena::~LinearArena()
+{
+	ReleaseBlocks();
+}
+
+void* LinearArena::Allocate(std::size_t byteSize, std::size_t alignment)
+{
+	CHECK(alignment > 0 && (alignment & (alignment - 1)) == 0);
+
+	uintptr_t address = (reinterpret_cast<uintptr_t>(cursor_) + alignment - 1) & ~(static_cast<uintptr_t>(alignment) - 1);
+	if (cursor_ == nullptr || address + byteSize > reinterpret_cast<uintptr_t>(end_))
+	{
+		AllocateBlock(std::max(blockByteSize_, BLOCK_HEADER_BYTE_SIZE + byteSize + alignment));
+		address = (reinterpret_cast<uintptr_t>(cursor_) + alignment - 1) & ~(static_cast<uintptr_t>(alignment) - 1);
+	}
+
+	uint8_t* allocation = reinterpret_cast<uint8_t*>(address);
+	usedByteSize_ += static_cast<std::size_t>((allocation + byteSize) - cursor_);
+	cursor_ = allocation + byteSize;
+
+	return allocation;
+}
+
+void LinearArena::Reset()
+{
+	highWaterByteSize_ = std::max(highWaterByteSize_, usedByteSize_);
+	usedByteSize_ = 0;
+
+	if (blockCount_ > 1)
+	{
+		std::size_t capacity = capacity_;
+		ReleaseBlocks();
+		AllocateBlock(capacity);
+		return;
+	}
+
+	if (currentBlock_)
+	{
+		cursor_ = reinterpret_cast<uint8_t*>(currentBlock_) + BLOCK_HEADER_BYTE_SIZE;
+	}
+}
+
+void LinearArena::AllocateBlock(std::size_t byteSize)
+{
+	void* memory = MemoryAlloc(byteSize, nullptr);
+	ASSERT(memory != nullptr, "Failed to allocate arena block. (size: %zu)", byteSize);
+
+	Block* block = new (memory) Block();
+	block->prevBlock = currentBlock_;
+	block->byteSize = byteSize;
+
+	currentBlock_ = block;
+	cursor_ = reinterpret_cast<uint8_t*>(memory) + BLOCK_HEADER_BYTE_SIZE;
+	end_ = reinterpret_cast<uint8_t*>(memory) + byteSize;
+
+	++blockCount_;
+	capacity_ += byteSize;
+}
+
+void LinearArena::ReleaseBlocks()
+{
+	while (currentBlock_)
+	{
+		Block* prevBlock = currentBlock_->prevBlock;
+		MemoryFree(currentBlock_, nullptr);
+		currentBlock_ = prevBlock;
+	}
+
+	cursor_ = nullptr;
+	end_ = nullptr;
+	blockCount_ = 0;
+	capacity_ = 0;
+}
+
+/**
+ * 庰  Ʒ Դϴ.
+ *   ٸ 尡 GetStatistics   ֵ   մϴ. frameIndex scopeDepth  常 մϴ.
+ */
+struct ThreadFrameArena
+{
+	ThreadFrameArena();
+	~ThreadFrameArena();
+
+	LinearArena arena;
+	uint64_t frameIndex = 0;
+
+	/** ø FrameArenaScope Դϴ. 0 ũ  ٲ Ʒ  ʽϴ. */
+	uint32_t scopeDepth = 0;
+
+	std::atomic<uint64_t> lastFrameByteSize = { 0 };
+	std::atomic<uint64_t> highWaterByteSize = { 0 };
+	std::atomic<uint64_t> capacityByteSize = { 0 };
+};
+
+/**   εԴϴ. 庰 Ʒ frameIndex ٸ Ʒ ϴ. */
+static std::atomic<uint64_t> globalFrameIndex = { 0 };
+
+/** 踦  ִ    Ʒ մϴ. */
+static std::mutex threadFrameArenasMutex;
+static std::vector<ThreadFrameArena*> threadFrameArenas;
+
+ThreadFrameArena::ThreadFrameArena()
+	: frameIndex(globalFrameIndex.load(std::memory_order_relaxed))
+{
+	std::lock_guard<std::mutex> lock(threadFrameArenasMutex);
+	threadFrameArenas.push_back(this);
+}
+
+ThreadFrameArena::~ThreadFrameArena()
+{
+	std::lock_guard<std::mutex> lock(threadFrameArenasMutex);
+	threadFrameArenas.erase(std::find(threadFrameArenas.begin(), threadFrameArenas.end(), this));
+}
+
+static ThreadFrameArena& GetThreadFrameArena()
+{
+	static thread_local ThreadFrameArena threadFrameArena;
+	return threadFrameArena;
+}
+
+/**  ٲٸ   Ʒ ϴ. */
+static void ResetThreadFrameArenaIfFrameChanged(ThreadFrameArena& threadFrameArena)
+{
+	uint64_t frameIndex = globalFrameIndex.load(std::memory_order_relaxed);
+	if (threadFrameArena.frameIndex == frameIndex)
+	{
+		return;
+	}
+
+	threadFrameArena.frameIndex = frameIndex;
+
+	/**  Ҵ縶  ʰ, Ʒ      մϴ. */
+	threadFrameArena.lastFrameByteSize.store(threadFrameArena.arena.GetUsedByteSize(), std::memory_order_relaxed);
+	threadFrameArena.arena.Reset();
+	threadFrameArena.highWaterByteSize.store(threadFrameArena.arena.GetHighWaterByteSize(), std::memory_order_relaxed);
+	threadFrameArena.capacityByteSize.store(threadFrameArena.arena.GetCapacity(), std::memory_order_relaxed);
+}
+
+void* FrameArena::Allocate(std::size_t byteSize, std::size_t alignment)
+{
+	ThreadFrameArena& threadFrameArena = GetThreadFrameArena();
+	if (threadFrameArena.scopeDepth == 0)
+	{
+		ResetThreadFrameArenaIfFrameChanged(threadFrameArena);
+	}
+
+	return threadFrameArena.arena.Allocate(byteSize, alignment);
+}
+
+void FrameArena::BeginFrame()
+{
+	globalFrameIndex.fetch_add(1, std::memory_order_relaxed);
+}
+
+FrameArenaStatistics FrameArena::GetStatistics()
+{
+	FrameArenaStatistics statistics;
+
+	std::lock_guard<std::mutex> lock(threadFrameArenasMutex);
+	for (const auto& threadFrameArena : threadFrameArenas)
+	{
+		++statistics.threadCount;
+		statistics.lastFrameByteSize += threadFrameArena->lastFrameByteSize.load(std::memory_order_relaxed);
+		statistics.highWaterByteSize += threadFrameArena->highWaterByteSize.load(std::memory_order_relaxed);
+		statistics.capacityByteSize += threadFrameArena->capacityByteSize.load(std::memory_order_relaxed);
+	}
+
+	return statistics;
+}
+
+FrameArenaScope::FrameArenaScope()
+{
+	ThreadFrameArena& threadFrameArena = GetThreadFrameArena();
+	if (threadFrameArena.scopeDepth == 0)
+	{
+		ResetThreadFrameArenaIfFrameChanged(threadFrameArena);
+	}
+
+	++threadFrameArena.scopeDepth;
+}
+
+FrameArenaScope::~FrameArenaScope()
+{
+	ThreadFrameArena& threadFrameArena = GetThreadFrameArena();
+	CHECK(threadFrameArena.scopeDepth > 0);
+
+	--threadFrameArena.scopeDepth;
+}
\ No newline at end of file
@@ -0,0 +1,104 @@
+#include <cmath>
+
+#include "Utils/Assertion.h"
+#include "Utils/FrameArena.h"
+#include "Utils/FrameLoop.h"
+#include "Utils/Profiler.h"
+
+FrameLoop::FrameLoop(double simulationHz, uint32_t maxCatchUpSteps, bool bIsThreadedSimulation)
+	: stepSeconds_(1.0 / simulationHz)
+	, maxCatchUpSteps_(maxCatchUpSteps)
+	, bIsThreadedSimulation_(bIsThreadedSimulation)
+{
+	CHECK(simulationHz > 0.0 && maxCatchUpSteps > 0);
+}
+
+FrameLoop::~FrameLoop()
+{
+	if (bIsSimulationPending_)
+	{
+		JobManager::GetRef().Wait(simulationCounter_);
+	}
+}
+
+void FrameLoop::BeginFrame(double frameSeconds)
+{
+	CHECK(!bIsSimulationPending_);
+
+	accumulatorSeconds_ += (frameSeconds > 0.0) ? frameSeconds : 0.0;
+
+	uint32_t stepCount = 0;
+	while (accumulatorSeconds_ >= stepSeconds_ && stepCount < maxCatchUpSteps_)
+	{
+		accumulatorSeconds_ -= stepSeconds_;
+		++stepCount;
+	}
+
+	/** ִ   Ѿ и ð , ùķ̼  ð      ϴ. */
+	if (accumulatorSeconds_ >= stepSeconds_)
+	{
+		double remainSeconds = std::fmod(accumulatorSeconds_, stepSeconds_);
+		droppedSeconds_ += accumulatorSeconds_ - remainSeconds;
+		accumulatorSeconds_ = remainSeconds;
+	}
+
+	frameStepCount_ = stepCount;
+	stepCount_ += stepCount;
+	pendingAlpha_ = accumulatorSeconds_ / stepSeconds_;
+
+	if (!bIsThreadedSimulation_)
+	{
+		RunSteps(stepCount);
+
+		publishedAlpha_ = pendingAlpha_;
+		if (publishFunction_)
+		{
+			publishFunction_();
+		}
+		return;
+	}
+
+	if (stepCount > 0)
+	{
+		JobManager::GetRef().Submit([this, stepCount]() { RunSteps(stepCount); }, &simulationCounter_);
+		bIsSimulationPending_ = true;
+	}
+}
+
+void FrameLoop::EndFrame()
+{
+	if (!bIsThreadedSimulation_)
+	{
+		return;
+	}
+
+	if (bIsSimulationPending_)
+	{
+		JobManager::GetRef().Wait(simulationCounter_);
+		bIsSimulationPending_ = false;
+
+		if (publishFunction_)
+		{
+			publishFunction_();
+		}
+	}
+
+	publishedAlpha_ = pendingAlpha_;
+}
+
+void FrameLoop::RunSteps(uint32_t stepCount)
+{
+	PROFILE_SCOPE("FrameLoop::RunSteps");
+
+	if (!simulateFunction_)
+	{
+		return;
+	}
+
+	/** ùķ̼  忡  ߿  尡 BeginFrame ȣϹǷ, ܸ  Ʒ մϴ. */
+	for (uint32_t step = 0; step < stepCount; ++step)
+	{
+		FrameArenaScope frameArenaScope;
+		simulateFunction_(stepSeconds_);
+	}
+}
\ No newline at end of file
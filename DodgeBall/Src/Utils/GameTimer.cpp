@@ -1,58 +1,28 @@
-#include <glfw/glfw3.h>
+#include <algorithm>
+#include <chrono>
 
 #include "Utils/GameTimer.h"
 
-GameTimer::GameTimer(GameTimer&& instance) noexcept
-	: bIsStop_(instance.bIsStop_)
-	, baseTime_(instance.baseTime_)
-	, pausedTime_(instance.pausedTime_)
-	, stopTime_(instance.stopTime_)
-	, prevTime_(instance.prevTime_)
-	, currTime_(instance.currTime_) {
-}
-
-GameTimer::GameTimer(const GameTimer& instance) noexcept
-	: bIsStop_(instance.bIsStop_)
-	, baseTime_(instance.baseTime_)
-	, pausedTime_(instance.pausedTime_)
-	, stopTime_(instance.stopTime_)
-	, prevTime_(instance.prevTime_)
-	, currTime_(instance.currTime_) {
-}
+GameTimer::GameTimer(GameTimer&& instance) noexcept = default;
+GameTimer::GameTimer(const GameTimer& instance) noexcept = default;
+GameTimer& GameTimer::operator=(GameTimer&& instance) noexcept = default;
+GameTimer& GameTimer::operator=(const GameTimer& instance) noexcept = default;
 
-GameTimer& GameTimer::operator=(GameTimer&& instance) noexcept
+double GameTimer::GetDeltaSeconds() const
 {
-	if (this == &instance) return *this;
-
-	bIsStop_ = instance.bIsStop_;
-	baseTime_ = instance.baseTime_;
-	pausedTime_ = instance.pausedTime_;
-	stopTime_ = instance.stopTime_;
-	prevTime_ = instance.prevTime_;
-	currTime_ = instance.currTime_;
-
-	return *this;
+	return ConvertTicksToSeconds(GetDeltaTicks());
 }
 
-GameTimer& GameTimer::operator=(const GameTimer& instance) noexcept
+double GameTimer::GetTotalSeconds() const
 {
-	if (this == &instance) return *this;
-
-	bIsStop_ = instance.bIsStop_;
-	baseTime_ = instance.baseTime_;
-	pausedTime_ = instance.pausedTime_;
-	stopTime_ = instance.stopTime_;
-	prevTime_ = instance.prevTime_;
-	currTime_ = instance.currTime_;
-
-	return *this;
+	return ConvertTicksToSeconds(GetTotalTicks());
 }
 
-float GameTimer::GetDeltaSeconds() const
+uint64_t GameTimer::GetDeltaTicks() const
 {
 	if (bIsStop_)
 	{
-		return 0.0f;
+		return 0ULL;
 	}
 	else
 	{
@@ -60,7 +30,7 @@ float GameTimer::GetDeltaSeconds() const
 	}
 }
 
-float GameTimer::GetTotalSeconds() const
+uint64_t GameTimer::GetTotalTicks() const
 {
 	if (bIsStop_)
 	{
@@ -72,27 +42,62 @@ float GameTimer::GetTotalSeconds() const
 	}
 }
 
+FrameTimeStatistics GameTimer::GetFrameTimeStatistics() const
+{
+	FrameTimeStatistics statistics;
+	if (frameTimeCount_ == 0)
+	{
+		return statistics;
+	}
+
+	std::array<uint64_t, FRAME_TIME_WINDOW_SIZE> frameTimeTicks = frameTimeTicks_;
+	auto begin = frameTimeTicks.begin();
+	auto end = frameTimeTicks.begin() + frameTimeCount_;
+
+	uint64_t sumTicks = 0ULL;
+	for (auto iter = begin; iter != end; ++iter)
+	{
+		sumTicks += *iter;
+	}
+
+	/** 99   ĵ ġ ceil(0.99 * N) - 1 Դϴ. */
+	uint32_t p99Index = (frameTimeCount_ * 99 + 99) / 100 - 1;
+	std::nth_element(begin, begin + p99Index, end);
+
+	statistics.sampleCount = frameTimeCount_;
+	statistics.minSeconds = ConvertTicksToSeconds(*std::min_element(begin, end));
+	statistics.averageSeconds = ConvertTicksToSeconds(sumTicks) / static_cast<double>(frameTimeCount_);
+	statistics.p99Seconds = ConvertTicksToSeconds(*(begin + p99Index));
+	statistics.maxSeconds = ConvertTicksToSeconds(*std::max_element(begin, end));
+
+	return statistics;
+}
+
 void GameTimer::Reset()
 {
-	float tickTime = static_cast<float>(glfwGetTime());
+	uint64_t tickTime = GetCurrentTicks();
 
 	bIsStop_ = false;
 	baseTime_ = tickTime;
-	pausedTime_ = 0.0f;
-	stopTime_ = 0.0f;
+	pausedTime_ = 0ULL;
+	stopTime_ = 0ULL;
 	prevTime_ = tickTime;
 	currTime_ = tickTime;
+
+	frameTimeCount_ = 0;
+	frameTimeCursor_ = 0;
 }
 
 void GameTimer::Start()
 {
 	if (bIsStop_)
 	{
-		float tickTime = static_cast<float>(glfwGetTime());
+		uint64_t tickTime = GetCurrentTicks();
 
 		pausedTime_ += (tickTime - stopTime_);
 		prevTime_ = tickTime;
-		stopTime_ = 0.0f;
+		currTime_ = tickTime;
+		stopTime_ = 0ULL;
 
 		bIsStop_ = false;
 	}
@@ -102,7 +107,7 @@ void GameTimer::Stop()
 {
 	if (!bIsStop_)
 	{
-		stopTime_ = static_cast<float>(glfwGetTime());
+		stopTime_ = GetCurrentTicks();
 		bIsStop_ = true;
 	}
 }
@@ -110,5 +115,30 @@ void GameTimer::Stop()
 void GameTimer::Tick()
 {
 	prevTime_ = currTime_;
-	currTime_ = static_cast<float>(glfwGetTime());
+	currTime_ = GetCurrentTicks();
+
+	if (!bIsStop_)
+	{
+		frameTimeTicks_[frameTimeCursor_] = currTime_ - prevTime_;
+		frameTimeCursor_ = (frameTimeCursor_ + 1) % FRAME_TIME_WINDOW_SIZE;
+		if (frameTimeCount_ < FRAME_TIME_WINDOW_SIZE)
+		{
+			++frameTimeCount_;
+		}
+	}
+}
+
+uint64_t GameTimer::GetCurrentTicks()
+{
+	return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+uint64_t GameTimer::GetTickFrequency()
+{
+	return 1000000000ULL;
+}
+
+double GameTimer::ConvertTicksToSeconds(uint64_t ticks)
+{
+	return static_cast<double>(ticks) / static_cast<double>(GetTickFrequency());
 }
\ No newline at end of file
@@ -1,5 +1,9 @@
 #include <mimalloc.h>
+
+/** Windows ̿ ÷ mimalloc  ̺귯 new/delete ڸ  մϴ. */
+#if defined(_WIN32)
 #include <mimalloc-new-delete.h>
+#endif
 
 #include "Utils/MemoryAlloc.h"
 
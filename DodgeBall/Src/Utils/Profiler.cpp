@@ -0,0 +1,240 @@
+#include <atomic>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "Utils/GameTimer.h"
+#include "Utils/Profiler.h"
+#include "Utils/Utils.h"
+
+/** ̺Ʈ ûũ ϳ  ̺Ʈ  庰 ִ ûũ Դϴ.  ִ 256 * 16384 ̺Ʈ մϴ. */
+static const uint32_t EVENT_CHUNK_SHIFT = 14;
+static const uint32_t EVENT_CHUNK_SIZE = (1u << EVENT_CHUNK_SHIFT);
+static const uint32_t MAX_EVENT_CHUNK_COUNT = 256;
+
+/** ̺Ʈ Դϴ. */
+enum class EProfileEventType : uint32_t
+{
+	SCOPE   = 0x00,
+	COUNTER = 0x01,
+};
+
+/** Ϸ  ̺Ʈ Ǵ ī Դϴ. īʹ beginTicks  ð, value  մϴ. */
+struct ProfileEvent
+{
+	const char* name;
+	uint64_t beginTicks;
+	uint64_t endTicks;
+	int64_t value;
+	EProfileEventType type;
+};
+
+/**
+ * 庰 ̺Ʈ Դϴ.  常 ̺Ʈ ϰ, ٸ  ĸó   eventCount нϴ.
+ * ûũ   ҴǸ ̵ Ƿ ۰ Ŀ ̹  ̺Ʈ д  浹 ʽϴ.
+ * 尡  ڿ ̺Ʈ   ֵ ۴   մϴ.
+ */
+struct ThreadProfileBuffer
+{
+	std::unique_ptr<ProfileEvent[]> chunks[MAX_EVENT_CHUNK_COUNT];
+	std::atomic<ProfileEvent*> chunkPtrs[MAX_EVENT_CHUNK_COUNT] = {};
+
+	std::atomic<uint32_t> eventCount = { 0 };
+	uint32_t droppedEventCount = 0;
+	uint64_t captureIndex = 0;
+
+	uint32_t threadID = 0;
+	std::string threadName;
+};
+
+/** ĸó ο ĸó εԴϴ. ĸó ε ٲ      ڽ ۸ ϴ. */
+static std::atomic<bool> bIsCapturing = { false };
+static std::atomic<uint64_t> captureIndex = { 0 };
+
+/** ĸó  ðԴϴ. Ʈ̽  ð  մϴ. */
+static uint64_t captureBeginTicks = 0;
+
+/**   ̺Ʈ Դϴ. ۸ ߰ϰų ȸ  ޴ϴ. */
+static std::mutex threadProfileBuffersMutex;
+static std::vector<std::unique_ptr<ThreadProfileBuffer>> threadProfileBuffers;
+
+static ThreadProfileBuffer& GetThreadProfileBuffer()
+{
+	static thread_local ThreadProfileBuffer* threadProfileBuffer = nullptr;
+	if (!threadProfileBuffer)
+	{
+		std::lock_guard<std::mutex> lock(threadProfileBuffersMutex);
+		threadProfileBuffers.push_back(std::make_unique<ThreadProfileBuffer>());
+
+		threadProfileBuffer = threadProfileBuffers.back().get();
+		threadProfileBuffer->threadID = static_cast<uint32_t>(threadProfileBuffers.size());
+		threadProfileBuffer->threadName = PrintF("Thread %u", threadProfileBuffer->threadID);
+	}
+
+	return *threadProfileBuffer;
+}
+
+/** JSON ڿ    ڸ ̽մϴ. */
+static std::string EscapeJsonString(const char* text)
+{
+	std::string escapeText;
+	for (; *text != '\0'; ++text)
+	{
+		if (*text == '"' || *text == '\\')
+		{
+			escapeText.push_back('\\');
+		}
+		escapeText.push_back(*text);
+	}
+
+	return escapeText;
+}
+
+void Profiler::BeginCapture()
+{
+	captureBeginTicks = GameTimer::GetCurrentTicks();
+	captureIndex.fetch_add(1);
+	bIsCapturing.store(true);
+}
+
+void Profiler::EndCapture()
+{
+	bIsCapturing.store(false);
+}
+
+bool Profiler::IsCapturing()
+{
+	return bIsCapturing.load(std::memory_order_relaxed);
+}
+
+void Profiler::SetThreadName(const std::string& threadName)
+{
+	ThreadProfileBuffer& threadProfileBuffer = GetThreadProfileBuffer();
+
+	std::lock_guard<std::mutex> lock(threadProfileBuffersMutex);
+	threadProfileBuffer.threadName = threadName;
+}
+
+/** ̺Ʈ   ̺Ʈ ۿ ߰մϴ. */
+static void PushEvent(const ProfileEvent& newEvent)
+{
+	ThreadProfileBuffer& threadProfileBuffer = GetThreadProfileBuffer();
+
+	uint64_t currentCaptureIndex = captureIndex.load(std::memory_order_relaxed);
+	if (threadProfileBuffer.captureIndex != currentCaptureIndex)
+	{
+		threadProfileBuffer.captureIndex = currentCaptureIndex;
+		threadProfileBuffer.droppedEventCount = 0;
+		threadProfileBuffer.eventCount.store(0, std::memory_order_relaxed);
+	}
+
+	uint32_t eventCount = threadProfileBuffer.eventCount.load(std::memory_order_relaxed);
+	uint32_t chunkIndex = eventCount >> EVENT_CHUNK_SHIFT;
+	if (chunkIndex >= MAX_EVENT_CHUNK_COUNT)
+	{
+		++threadProfileBuffer.droppedEventCount;
+		return;
+	}
+
+	if (!threadProfileBuffer.chunks[chunkIndex])
+	{
+		threadProfileBuffer.chunks[chunkIndex] = std::make_unique<ProfileEvent[]>(EVENT_CHUNK_SIZE);
+		threadProfileBuffer.chunkPtrs[chunkIndex].store(threadProfileBuffer.chunks[chunkIndex].get(), std::memory_order_release);
+	}
+
+	threadProfileBuffer.chunks[chunkIndex][eventCount & (EVENT_CHUNK_SIZE - 1)] = newEvent;
+	threadProfileBuffer.eventCount.store(eventCount + 1, std::memory_order_release);
+}
+
+void Profiler::RecordEvent(const char* name, uint64_t beginTicks, uint64_t endTicks)
+{
+	PushEvent({ name, beginTicks, endTicks, 0, EProfileEventType::SCOPE });
+}
+
+void Profiler::RecordCounter(const char* name, int64_t value)
+{
+	if (!IsCapturing())
+	{
+		return;
+	}
+
+	uint64_t ticks = GameTimer::GetCurrentTicks();
+	PushEvent({ name, ticks, ticks, value, EProfileEventType::COUNTER });
+}
+
+bool Profiler::WriteChromeTrace(const std::string& path)
+{
+	FILE* file = std::fopen(path.c_str(), "wb");
+	if (!file)
+	{
+		DebugPrintF("Failed to open trace file. (path: %s)\n", path.c_str());
+		return false;
+	}
+
+	uint64_t currentCaptureIndex = captureIndex.load();
+	bool bIsFirstEvent = true;
+
+	std::fputs("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[", file);
+
+	std::lock_guard<std::mutex> lock(threadProfileBuffersMutex);
+	for (const auto& threadProfileBuffer : threadProfileBuffers)
+	{
+		std::fprintf(file, "%s\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":\"%s\"}}", bIsFirstEvent ? "" : ",", threadProfileBuffer->threadID, EscapeJsonString(threadProfileBuffer->threadName.c_str()).c_str());
+		bIsFirstEvent = false;
+
+		uint32_t eventCount = threadProfileBuffer->eventCount.load(std::memory_order_acquire);
+		if (threadProfileBuffer->captureIndex != currentCaptureIndex)
+		{
+			continue; // ̹ ĸó  ̺Ʈ   .
+		}
+
+		for (uint32_t index = 0; index < eventCount; ++index)
+		{
+			const ProfileEvent* chunk = threadProfileBuffer->chunkPtrs[index >> EVENT_CHUNK_SHIFT].load(std::memory_order_acquire);
+			const ProfileEvent& event = chunk[index & (EVENT_CHUNK_SIZE - 1)];
+			if (event.beginTicks < captureBeginTicks)
+			{
+				continue; // ĸó   ۵ .
+			}
+
+			/** Chrome Ʈ̽ ð  ũ̸, Ҽ  3ڸ  е մϴ. */
+			double beginMicroseconds = static_cast<double>(event.beginTicks - captureBeginTicks) / 1000.0;
+			if (event.type == EProfileEventType::COUNTER)
+			{
+				std::fprintf(file, ",\n{\"name\":\"%s\",\"cat\":\"DodgeBall\",\"ph\":\"C\",\"ts\":%.3f,\"pid\":1,\"args\":{\"value\":%lld}}", EscapeJsonString(event.name).c_str(), beginMicroseconds, static_cast<long long>(event.value));
+				continue;
+			}
+
+			double durationMicroseconds = static_cast<double>(event.endTicks - event.beginTicks) / 1000.0;
+			std::fprintf(file, ",\n{\"name\":\"%s\",\"cat\":\"DodgeBall\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":%u}", EscapeJsonString(event.name).c_str(), beginMicroseconds, durationMicroseconds, threadProfileBuffer->threadID);
+		}
+
+		if (threadProfileBuffer->droppedEventCount > 0)
+		{
+			DebugPrintF("Profiler event buffer overflow. (thread: %s, dropped: %u)\n", threadProfileBuffer->threadName.c_str(), threadProfileBuffer->droppedEventCount);
+		}
+	}
+
+	std::fputs("\n]}\n", file);
+	std::fclose(file);
+
+	return true;
+}
+
+ProfileScope::ProfileScope(const char* name)
+{
+	if (Profiler::IsCapturing())
+	{
+		name_ = name;
+		beginTicks_ = GameTimer::GetCurrentTicks();
+	}
+}
+
+ProfileScope::~ProfileScope()
+{
+	if (name_)
+	{
+		Profiler::RecordEvent(name_, beginTicks_, GameTimer::GetCurrentTicks());
+	}
+}
\ No newline at end of file
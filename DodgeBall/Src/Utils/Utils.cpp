@@ -1,10 +1,14 @@
 #include <cstdarg>
 #include <cstdint>
 #include <cstdio>
+#include <cstdlib>
 #include <cstring>
+#include <cwchar>
 
+#if defined(_WIN32)
 #include <windows.h>
 #include <Shlwapi.h>
+#endif
 
 #include "Utils/Utils.h"
 
@@ -17,10 +21,14 @@ void DebugPrintF(const char* format, ...)
 
 	va_list args;
 	va_start(args, format);
-	int32_t size = _vsnprintf_s(buffer, MAX_BUFFER_SIZE, MAX_BUFFER_SIZE, format, args);
+	int32_t size = std::vsnprintf(buffer, MAX_BUFFER_SIZE, format, args);
 	va_end(args);
 
+#if defined(_WIN32)
 	OutputDebugStringA(buffer);
+#else
+	std::fputs(buffer, stderr);
+#endif
 #endif
 }
 
@@ -31,10 +39,21 @@ void DebugPrintF(const wchar_t* format, ...)
 
 	va_list args;
 	va_start(args, format);
-	int32_t size = _vsnwprintf_s(buffer, MAX_BUFFER_SIZE, format, args);
+	int32_t size = std::vswprintf(buffer, MAX_BUFFER_SIZE, format, args);
 	va_end(args);
 
+#if defined(_WIN32)
 	OutputDebugStringW(buffer);
+#else
+	/** ǥ  Ʈ (orientation)  ʵ ƼƮ ڿ ȯ  մϴ. */
+	char convertBuffer[MAX_BUFFER_SIZE];
+	std::size_t convertSize = std::wcstombs(convertBuffer, buffer, MAX_BUFFER_SIZE - 1);
+	if (convertSize != static_cast<std::size_t>(-1))
+	{
+		convertBuffer[convertSize] = '\0';
+		std::fputs(convertBuffer, stderr);
+	}
+#endif
 #endif
 }
 
@@ -44,7 +63,7 @@ std::string PrintF(const char* format, ...)
 
 	va_list args;
 	va_start(args, format);
-	int32_t size = vsnprintf(buffer, MAX_BUFFER_SIZE, format, args);
+	int32_t size = std::vsnprintf(buffer, MAX_BUFFER_SIZE, format, args);
 	va_end(args);
 
 	return std::string(buffer, size);
@@ -56,7 +75,7 @@ std::wstring PrintF(const wchar_t* format, ...)
 
 	va_list args;
 	va_start(args, format);
-	int32_t size = _vsnwprintf_s(buffer, MAX_BUFFER_SIZE, format, args);
+	int32_t size = std::vswprintf(buffer, MAX_BUFFER_SIZE, format, args);
 	va_end(args);
 
 	return std::wstring(buffer, size);
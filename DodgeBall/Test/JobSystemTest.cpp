@@ -0,0 +1,251 @@
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "Job/JobManager.h"
+#include "Job/WorkStealingDeque.h"
+
+#include "Test.h"
+
+/**  Ŵ Ŀ  Դϴ.  ھ ȯ濡 ġ  ߻ϵ ϵ    մϴ. */
+static const uint32_t WORKER_COUNT = 4;
+
+/**  ˻翡  尡 ߰ϴ   Ҹ ġ  Դϴ.  ۰    µ ˻մϴ. */
+static const uint32_t DEQUE_ELEMENT_COUNT = 200000;
+static const uint32_t DEQUE_CAPACITY = 256;
+static const uint32_t STEAL_THREAD_COUNT = 3;
+
+/**  尡 Push/Pop ϴ  ٸ 尡 Steal ص,  Ұ Ȯ    ˻մϴ. */
+static void TestDequeConcurrentSteal()
+{
+	std::vector<uint32_t> elements(DEQUE_ELEMENT_COUNT);
+	std::unique_ptr<std::atomic<uint32_t>[]> takenCounts(new std::atomic<uint32_t>[DEQUE_ELEMENT_COUNT]);
+	for (uint32_t index = 0; index < DEQUE_ELEMENT_COUNT; ++index)
+	{
+		elements[index] = index;
+		takenCounts[index].store(0);
+	}
+
+	WorkStealingDeque<uint32_t> deque(DEQUE_CAPACITY);
+	std::atomic<bool> bIsOwnerDone = { false };
+	std::atomic<uint32_t> stolenCount = { 0 };
+
+	auto take = [&](uint32_t* element) { takenCounts[*element].fetch_add(1, std::memory_order_relaxed); };
+
+	std::vector<std::thread> stealThreads;
+	for (uint32_t index = 0; index < STEAL_THREAD_COUNT; ++index)
+	{
+		stealThreads.emplace_back([&]()
+			{
+				while (!bIsOwnerDone.load(std::memory_order_acquire) || deque.GetApproximateSize() > 0)
+				{
+					if (uint32_t* element = deque.Steal())
+					{
+						take(element);
+						stolenCount.fetch_add(1, std::memory_order_relaxed);
+					}
+				}
+			}
+		);
+	}
+
+	/**   ߰    ,     ڸ ϴ. */
+	for (uint32_t index = 0; index < DEQUE_ELEMENT_COUNT; ++index)
+	{
+		while (!deque.Push(&elements[index]))
+		{
+			if (uint32_t* element = deque.Pop())
+			{
+				take(element);
+			}
+		}
+
+		if ((index % 3) == 2)
+		{
+			if (uint32_t* element = deque.Pop())
+			{
+				take(element);
+			}
+		}
+	}
+
+	while (uint32_t* element = deque.Pop())
+	{
+		take(element);
+	}
+	bIsOwnerDone.store(true, std::memory_order_release);
+
+	for (auto& stealThread : stealThreads)
+	{
+		stealThread.join();
+	}
+
+	uint32_t lostCount = 0;
+	uint32_t duplicatedCount = 0;
+	for (uint32_t index = 0; index < DEQUE_ELEMENT_COUNT; ++index)
+	{
+		uint32_t takenCount = takenCounts[index].load();
+		lostCount += (takenCount == 0) ? 1 : 0;
+		duplicatedCount += (takenCount > 1) ? 1 : 0;
+	}
+
+	std::printf("  deque push/pop vs steal: stolen %u of %u, lost %u, duplicated %u\n", stolenCount.load(), DEQUE_ELEMENT_COUNT, lostCount, duplicatedCount);
+	TEST_EXPECT(lostCount == 0);
+	TEST_EXPECT(duplicatedCount == 0);
+	TEST_EXPECT(deque.Pop() == nullptr && deque.Steal() == nullptr);
+}
+
+/**   ī ۾   ڿ ϴ ۾ Ǵ ˻մϴ. */
+static void TestCounterDependency()
+{
+	static const uint32_t FIRST_JOB_COUNT = 64;
+
+	JobManager& jobManager = JobManager::GetRef();
+
+	std::atomic<uint32_t> firstDoneCount = { 0 };
+	std::atomic<uint32_t> secondObservedCount = { 0xFFFFFFFF };
+	std::atomic<uint32_t> thirdObservedCount = { 0xFFFFFFFF };
+	std::atomic<bool> bIsSecondDone = { false };
+
+	JobCounter firstCounter;
+	JobCounter secondCounter;
+	JobCounter thirdCounter;
+
+	/** ϴ ۾  ص  ۾    ʾƾ մϴ. */
+	for (uint32_t index = 0; index < FIRST_JOB_COUNT; ++index)
+	{
+		jobManager.Submit([&]()
+			{
+				std::this_thread::sleep_for(std::chrono::microseconds(200));
+				firstDoneCount.fetch_add(1);
+			}, &firstCounter
+		);
+	}
+	jobManager.Submit([&]() { secondObservedCount.store(firstDoneCount.load()); bIsSecondDone.store(true); }, &secondCounter, &firstCounter);
+	jobManager.Submit([&]() { thirdObservedCount.store(bIsSecondDone.load() ? firstDoneCount.load() : 0); }, &thirdCounter, &secondCounter);
+
+	jobManager.Wait(thirdCounter);
+
+	std::printf("  counter dependency: second job saw %u of %u, third job saw %u\n", secondObservedCount.load(), FIRST_JOB_COUNT, thirdObservedCount.load());
+	TEST_EXPECT(secondObservedCount.load() == FIRST_JOB_COUNT);
+	TEST_EXPECT(thirdObservedCount.load() == FIRST_JOB_COUNT);
+	TEST_EXPECT(firstCounter.IsDone() && secondCounter.IsDone());
+
+	/** ̹ Ϸ īͿ ϴ ۾ ٷ ˴ϴ. */
+	std::atomic<bool> bIsLateJobDone = { false };
+	JobCounter lateCounter;
+	jobManager.Submit([&]() { bIsLateJobDone.store(true); }, &lateCounter, &firstCounter);
+	jobManager.Wait(lateCounter);
+	TEST_EXPECT(bIsLateJobDone.load());
+}
+
+/** ParallelFor  ε Ȯ   óϴ ˻մϴ.  ġ ũ  ƴ  0 츦 մϴ. */
+static void TestParallelForCoverage()
+{
+	static const uint32_t INDEX_COUNT = 100003;
+	static const uint32_t BATCH_SIZES[] = { 1, 97, 4096, INDEX_COUNT + 1 };
+
+	JobManager& jobManager = JobManager::GetRef();
+
+	for (uint32_t batchSize : BATCH_SIZES)
+	{
+		std::unique_ptr<std::atomic<uint32_t>[]> visitCounts(new std::atomic<uint32_t>[INDEX_COUNT]);
+		for (uint32_t index = 0; index < INDEX_COUNT; ++index)
+		{
+			visitCounts[index].store(0);
+		}
+
+		std::atomic<bool> bIsRangeValid = { true };
+		jobManager.ParallelFor(INDEX_COUNT, batchSize, [&](uint32_t begin, uint32_t end)
+			{
+				if (begin >= end || end > INDEX_COUNT || end - begin > batchSize)
+				{
+					bIsRangeValid.store(false);
+				}
+
+				for (uint32_t index = begin; index < end && index < INDEX_COUNT; ++index)
+				{
+					visitCounts[index].fetch_add(1, std::memory_order_relaxed);
+				}
+			}
+		);
+
+		uint32_t wrongCount = 0;
+		for (uint32_t index = 0; index < INDEX_COUNT; ++index)
+		{
+			wrongCount += (visitCounts[index].load() != 1) ? 1 : 0;
+		}
+
+		std::printf("  parallel for (batch %u): %u indices visited not exactly once\n", batchSize, wrongCount);
+		TEST_EXPECT(bIsRangeValid.load());
+		TEST_EXPECT(wrongCount == 0);
+	}
+
+	std::atomic<uint32_t> emptyCallCount = { 0 };
+	jobManager.ParallelFor(0, 16, [&](uint32_t, uint32_t) { emptyCallCount.fetch_add(1); });
+	TEST_EXPECT(emptyCallCount.load() == 0);
+}
+
+/**  Ŵ ʱȭ  (  ) ۾ ϰ   ִ ˻մϴ. */
+static void TestSubmitFromNonWorkerThread()
+{
+	static const uint32_t JOB_COUNT = 10000;
+	static const uint32_t SUBMIT_THREAD_COUNT = 2;
+
+	JobManager& jobManager = JobManager::GetRef();
+
+	std::atomic<uint32_t> doneCount = { 0 };
+	std::vector<std::thread> submitThreads;
+	for (uint32_t index = 0; index < SUBMIT_THREAD_COUNT; ++index)
+	{
+		submitThreads.emplace_back([&]()
+			{
+				JobCounter counter;
+				for (uint32_t jobIndex = 0; jobIndex < JOB_COUNT; ++jobIndex)
+				{
+					jobManager.Submit([&]() { doneCount.fetch_add(1, std::memory_order_relaxed); }, &counter);
+				}
+				jobManager.Wait(counter);
+			}
+		);
+	}
+
+	for (auto& submitThread : submitThreads)
+	{
+		submitThread.join();
+	}
+
+	/** ٸ 尡  ۾  忡 ϴ Դϴ. */
+	JobCounter mainCounter;
+	std::thread submitThread([&]()
+		{
+			for (uint32_t jobIndex = 0; jobIndex < JOB_COUNT; ++jobIndex)
+			{
+				jobManager.Submit([&]() { doneCount.fetch_add(1, std::memory_order_relaxed); }, &mainCounter);
+			}
+		}
+	);
+	submitThread.join();
+	jobManager.Wait(mainCounter);
+
+	uint32_t expectedCount = (SUBMIT_THREAD_COUNT + 1) * JOB_COUNT;
+	std::printf("  submit from non-worker threads: %u of %u jobs done\n", doneCount.load(), expectedCount);
+	TEST_EXPECT(doneCount.load() == expectedCount);
+}
+
+void RunJobSystemTest()
+{
+	TestDequeConcurrentSteal();
+
+	JobManager::GetRef().Startup(WORKER_COUNT);
+
+	TestCounterDependency();
+	TestParallelForCoverage();
+	TestSubmitFromNonWorkerThread();
+
+	JobManager::GetRef().Shutdown();
+}
\ No newline at end of file
@@ -0,0 +1,45 @@
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+#include "Test.h"
+
+/**   ׽Ʈ Դϴ. */
+struct TestSuite
+{
+	const char* name;
+	void (*run)();
+};
+
+static const TestSuite TEST_SUITES[] =
+{
+	{ "JobSystem", RunJobSystemTest },
+	{ "TextureResidency", RunTextureResidencyTest },
+};
+
+/**
+ *  ڷ ޵ ̸ ׽Ʈ մϴ. ڰ ٸ  ׽Ʈ մϴ.
+ *  ˻簡  0 ƴ  ȯϹǷ CTest з մϴ.
+ * ex) DodgeBallTest JobSystem
+ */
+int32_t main(int32_t argc, char* argv[])
+{
+	for (const auto& testSuite : TEST_SUITES)
+	{
+		bool bIsSelected = (argc <= 1);
+		for (int32_t index = 1; index < argc; ++index)
+		{
+			bIsSelected = bIsSelected || (std::strcmp(argv[index], testSuite.name) == 0);
+		}
+
+		if (bIsSelected)
+		{
+			std::printf("[%s]\n", testSuite.name);
+			testSuite.run();
+		}
+	}
+
+	uint32_t failureCount = GetTestFailureCount();
+	std::printf("%s (failures: %u)\n", (failureCount == 0) ? "PASSED" : "FAILED", failureCount);
+	return (failureCount == 0) ? 0 : 1;
+}
\ No newline at end of file
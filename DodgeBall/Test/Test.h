@@ -0,0 +1,33 @@
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+
+/**  ˻   ϴ. */
+inline uint32_t& GetTestFailureCount()
+{
+	static uint32_t testFailureCount = 0;
+	return testFailureCount;
+}
+
+/**  ˻ ǰ ġ ϰ   ŵϴ. */
+inline void ReportTestFailure(const char* condition, const char* file, int32_t line)
+{
+	std::printf("  FAILED: %s (%s:%d)\n", condition, file, line);
+	++GetTestFailureCount();
+}
+
+/**  ̸ ׽Ʈ з մϴ. ASSERT/CHECK ޸    ׻ ˻ϰ, ص  ˻縦  մϴ. */
+#define TEST_EXPECT(Condition)\
+{\
+	if (!(Condition))\
+	{\
+		ReportTestFailure(#Condition, __FILE__, __LINE__);\
+	}\
+}
+
+/** ۾ ġ   Ŵ ۾ //ParallelFor ˻մϴ. */
+void RunJobSystemTest();
+
+/** ؽó    (LRU), ּ  ũ,    ؼ   ó ¥ OpenGL ˻մϴ. */
+void RunTextureResidencyTest();
\ No newline at end of file
@@ -0,0 +1,592 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <glad/glad.h>
+#include <imgui.h>
+
+#include "GL/GLManager.h"
+#include "GL/Texture2D.h"
+#include "GL/TextureContainer.h"
+#include "GL/TextureLoader.h"
+#include "GL/TextureResidencyManager.h"
+
+#include "Test.h"
+
+/** ˻翡 ϴ ؽó ũ(ؼ) ä Դϴ. RGB8 ؼ GPU ޸ ġ 4Ʈ մϴ. */
+static const int32_t TEXTURE_SIZE = 256;
+static const int32_t TEXTURE_CHANNELS = 3;
+
+/** ڵ 带 ٸ ϴ  ִ Դϴ. */
+static const uint32_t MAX_WAIT_FRAME_COUNT = 2000;
+
+/** ֱٿ  ؽó  ʵ   ̿ ϴ  Դϴ. RECENT_USAGE_FRAME_COUNT Ŀ մϴ. */
+static const uint32_t USAGE_GAP_FRAME_COUNT = 4;
+
+/** ¥ OpenGL ϴ ؽó  Դϴ. */
+struct FakeTexture
+{
+	int32_t width = 0;
+	int32_t height = 0;
+	int32_t levelCount = 0;
+	GLenum internalFormat = 0;
+};
+
+/**
+ * ¥ OpenGL Դϴ. OpenGL ؽƮ  ؽó δ  ڸ ϵ glad Լ ͸ ¥ Լ üմϴ.
+ * ؽó   ũ⸦ ؼ  ÿ  GPU ޸𸮸 ϰ,   ε/縦  ϴ.
+ */
+static std::unordered_map<GLuint, FakeTexture> fakeTextures;
+static std::unordered_map<GLuint, std::vector<uint8_t>> fakeBuffers;
+static std::unordered_map<GLenum, GLuint> fakeBoundBuffers;
+static GLuint nextFakeObjectID = 1;
+static uint64_t liveTextureByteSize = 0;
+static uint64_t peakTextureByteSize = 0;
+static uint32_t fakeErrorCount = 0;
+
+/** ¥ ؽó   ϳ Ʈ ũ⸦ ϴ. Texture2D GPU ޸ ġ  ĢԴϴ. */
+static uint64_t GetFakeLevelByteSize(GLenum internalFormat, int32_t width, int32_t height)
+{
+	if (internalFormat == GL_COMPRESSED_RED_RGTC1)
+	{
+		return static_cast<uint64_t>((width + 3) / 4) * static_cast<uint64_t>((height + 3) / 4) * 8;
+	}
+
+	uint64_t texelByteSize = (internalFormat == GL_R8) ? 1 : ((internalFormat == GL_RG8) ? 2 : 4);
+	return static_cast<uint64_t>(width) * static_cast<uint64_t>(height) * texelByteSize;
+}
+
+/** ¥ ؽó   ü Ʈ ũ⸦ ϴ. */
+static uint64_t GetFakeTextureByteSize(const FakeTexture& texture)
+{
+	uint64_t byteSize = 0;
+	for (int32_t level = 0; level < texture.levelCount; ++level)
+	{
+		byteSize += GetFakeLevelByteSize(texture.internalFormat, std::max(texture.width >> level, 1), std::max(texture.height >> level, 1));
+	}
+
+	return byteSize;
+}
+
+/** ¥ ؽó      ȿ ִ Ȯմϴ.   ϴ. */
+static bool CheckFakeRegion(GLuint textureID, GLint level, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+	auto it = fakeTextures.find(textureID);
+	if (it == fakeTextures.end() || level < 0 || level >= it->second.levelCount)
+	{
+		++fakeErrorCount;
+		return false;
+	}
+
+	int32_t levelWidth = std::max(it->second.width >> level, 1);
+	int32_t levelHeight = std::max(it->second.height >> level, 1);
+	if (x < 0 || y < 0 || width <= 0 || height <= 0 || x + width > levelWidth || y + height > levelHeight)
+	{
+		++fakeErrorCount;
+		return false;
+	}
+
+	return true;
+}
+
+static void APIENTRY FakeCreateTextures(GLenum, GLsizei count, GLuint* textureIDs)
+{
+	for (GLsizei index = 0; index < count; ++index)
+	{
+		textureIDs[index] = nextFakeObjectID++;
+		fakeTextures[textureIDs[index]] = FakeTexture();
+	}
+}
+
+static void APIENTRY FakeTextureStorage2D(GLuint textureID, GLsizei levelCount, GLenum internalFormat, GLsizei width, GLsizei height)
+{
+	FakeTexture& texture = fakeTextures[textureID];
+	texture.width = width;
+	texture.height = height;
+	texture.levelCount = levelCount;
+	texture.internalFormat = internalFormat;
+
+	liveTextureByteSize += GetFakeTextureByteSize(texture);
+	peakTextureByteSize = std::max(peakTextureByteSize, liveTextureByteSize);
+}
+
+static void APIENTRY FakeDeleteTextures(GLsizei count, const GLuint* textureIDs)
+{
+	for (GLsizei index = 0; index < count; ++index)
+	{
+		auto it = fakeTextures.find(textureIDs[index]);
+		if (it != fakeTextures.end())
+		{
+			liveTextureByteSize -= GetFakeTextureByteSize(it->second);
+			fakeTextures.erase(it);
+		}
+	}
+}
+
+static void APIENTRY FakeTextureSubImage2D(GLuint textureID, GLint level, GLint x, GLint y, GLsizei width, GLsizei height, GLenum, GLenum, const void*)
+{
+	CheckFakeRegion(textureID, level, x, y, width, height);
+}
+
+static void APIENTRY FakeCompressedTextureSubImage2D(GLuint textureID, GLint level, GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void*)
+{
+	if (CheckFakeRegion(textureID, level, x, y, width, height) && static_cast<uint64_t>(imageSize) != GetFakeLevelByteSize(format, width, height))
+	{
+		++fakeErrorCount;
+	}
+}
+
+static void APIENTRY FakeCopyImageSubData(GLuint sourceID, GLenum, GLint sourceLevel, GLint, GLint, GLint, GLuint destinationID, GLenum, GLint destinationLevel, GLint, GLint, GLint, GLsizei width, GLsizei height, GLsizei)
+{
+	/**   ü ϹǷ,    ũⰡ   ƾ մϴ. */
+	if (CheckFakeRegion(sourceID, sourceLevel, 0, 0, width, height) && CheckFakeRegion(destinationID, destinationLevel, 0, 0, width, height))
+	{
+		const FakeTexture& source = fakeTextures[sourceID];
+		const FakeTexture& destination = fakeTextures[destinationID];
+		if (std::max(source.width >> sourceLevel, 1) != std::max(destination.width >> destinationLevel, 1) || std::max(source.height >> sourceLevel, 1) != height)
+		{
+			++fakeErrorCount;
+		}
+	}
+}
+
+static void APIENTRY FakeGenBuffers(GLsizei count, GLuint* bufferIDs)
+{
+	for (GLsizei index = 0; index < count; ++index)
+	{
+		bufferIDs[index] = nextFakeObjectID++;
+	}
+}
+
+static void APIENTRY FakeDeleteBuffers(GLsizei count, const GLuint* bufferIDs)
+{
+	for (GLsizei index = 0; index < count; ++index)
+	{
+		fakeBuffers.erase(bufferIDs[index]);
+	}
+}
+
+static void APIENTRY FakeBindBuffer(GLenum target, GLuint bufferID)
+{
+	fakeBoundBuffers[target] = bufferID;
+}
+
+static void APIENTRY FakeBufferStorage(GLenum target, GLsizeiptr byteSize, const void*, GLbitfield)
+{
+	fakeBuffers[fakeBoundBuffers[target]].resize(static_cast<std::size_t>(byteSize));
+}
+
+static void* APIENTRY FakeMapBufferRange(GLenum target, GLintptr offset, GLsizeiptr, GLbitfield)
+{
+	return fakeBuffers[fakeBoundBuffers[target]].data() + offset;
+}
+
+static GLboolean APIENTRY FakeUnmapBuffer(GLenum)
+{
+	return GL_TRUE;
+}
+
+static GLsync APIENTRY FakeFenceSync(GLenum, GLbitfield)
+{
+	return reinterpret_cast<GLsync>(static_cast<uintptr_t>(1));
+}
+
+static GLenum APIENTRY FakeClientWaitSync(GLsync, GLbitfield, GLuint64)
+{
+	return GL_ALREADY_SIGNALED;
+}
+
+static GLenum APIENTRY FakeGetError()
+{
+	return GL_NO_ERROR;
+}
+
+static void APIENTRY FakeDeleteSync(GLsync) {}
+static void APIENTRY FakeTextureParameteri(GLuint, GLenum, GLint) {}
+static void APIENTRY FakeTextureParameterfv(GLuint, GLenum, const GLfloat*) {}
+static void APIENTRY FakeGenerateTextureMipmap(GLuint) {}
+static void APIENTRY FakePixelStorei(GLenum, GLint) {}
+static void APIENTRY FakeActiveTexture(GLenum) {}
+static void APIENTRY FakeBindTexture(GLenum, GLuint) {}
+static void APIENTRY FakeViewport(GLint, GLint, GLsizei, GLsizei) {}
+static void APIENTRY FakeClearColor(GLfloat, GLfloat, GLfloat, GLfloat) {}
+static void APIENTRY FakeClearDepth(GLdouble) {}
+static void APIENTRY FakeClearStencil(GLint) {}
+static void APIENTRY FakeClear(GLbitfield) {}
+
+/** ؽó δ,  ڿ GL Ŵ  ó ȣϴ glad Լ ͸ ¥ Լ üմϴ. */
+static void InstallFakeGL()
+{
+	glad_glCreateTextures = FakeCreateTextures;
+	glad_glTextureStorage2D = FakeTextureStorage2D;
+	glad_glDeleteTextures = FakeDeleteTextures;
+	glad_glTextureSubImage2D = FakeTextureSubImage2D;
+	glad_glCompressedTextureSubImage2D = FakeCompressedTextureSubImage2D;
+	glad_glCopyImageSubData = FakeCopyImageSubData;
+	glad_glTextureParameteri = FakeTextureParameteri;
+	glad_glTextureParameterfv = FakeTextureParameterfv;
+	glad_glGenerateTextureMipmap = FakeGenerateTextureMipmap;
+	glad_glPixelStorei = FakePixelStorei;
+	glad_glActiveTexture = FakeActiveTexture;
+	glad_glBindTexture = FakeBindTexture;
+	glad_glGenBuffers = FakeGenBuffers;
+	glad_glDeleteBuffers = FakeDeleteBuffers;
+	glad_glBindBuffer = FakeBindBuffer;
+	glad_glBufferStorage = FakeBufferStorage;
+	glad_glMapBufferRange = FakeMapBufferRange;
+	glad_glUnmapBuffer = FakeUnmapBuffer;
+	glad_glFenceSync = FakeFenceSync;
+	glad_glClientWaitSync = FakeClientWaitSync;
+	glad_glDeleteSync = FakeDeleteSync;
+	glad_glGetError = FakeGetError;
+	glad_glViewport = FakeViewport;
+	glad_glClearColor = FakeClearColor;
+	glad_glClearDepth = FakeClearDepth;
+	glad_glClearStencil = FakeClearStencil;
+	glad_glClear = FakeClear;
+}
+
+/**  24Ʈ TGA ̹  մϴ.  ˻ Ƿ ؽó ٸ ܻ äϴ. */
+static bool WriteTGAFile(const std::string& path, int32_t size, uint8_t value)
+{
+	FILE* file = std::fopen(path.c_str(), "wb");
+	if (!file)
+	{
+		return false;
+	}
+
+	uint8_t header[18] = {};
+	header[2] = 2; //  Ʈ ÷
+	header[12] = static_cast<uint8_t>(size & 0xFF);
+	header[13] = static_cast<uint8_t>(size >> 8);
+	header[14] = static_cast<uint8_t>(size & 0xFF);
+	header[15] = static_cast<uint8_t>(size >> 8);
+	header[16] = static_cast<uint8_t>(TEXTURE_CHANNELS * 8);
+	header[17] = 0x20; //   
+	std::fwrite(header, 1, sizeof(header), file);
+
+	std::vector<uint8_t> pixels(static_cast<std::size_t>(size) * size * TEXTURE_CHANNELS, value);
+	std::fwrite(pixels.data(), 1, pixels.size(), file);
+
+	std::fclose(file);
+	return true;
+}
+
+/** ˻   ӽ ͸  θ ϴ. */
+static std::string GetTestFilePath(const std::string& fileName)
+{
+	return (std::filesystem::temp_directory_path() / "DodgeBallTextureResidencyTest" / fileName).string();
+}
+
+/** ؽó  ڰ  ʴ  ū  (  MIN_RESIDENT_SIZE  ù ) ϴ. */
+static int32_t GetFloorMipLevel(const Texture2D* texture)
+{
+	int32_t mipLevel = 0;
+	for (int32_t size = std::max(texture->GetWidth(), texture->GetHeight()); size > TextureResidencyManager::MIN_RESIDENT_SIZE; size >>= 1)
+	{
+		++mipLevel;
+	}
+
+	return mipLevel;
+}
+
+/**   ؽó ϴ  ŭ GPU ޸𸮸 ϴ. ¥ OpenGL  ũ մϴ. */
+static uint64_t GetResidentByteSize(const std::vector<Texture2D*>& textures)
+{
+	uint64_t byteSize = 0;
+	for (const Texture2D* texture : textures)
+	{
+		byteSize += texture->GetGPUMemoryByteSize();
+	}
+
+	return byteSize;
+}
+
+/** Main      ϳ մϴ. usedTextures ̹ ӿ  ũ ׸ ؽóԴϴ. */
+static void RunFrame(const std::vector<Texture2D*>& usedTextures)
+{
+	GLManager& glManager = GLManager::GetRef();
+
+	ImGui::NewFrame();
+	glManager.BeginFrame(0.0f, 0.0f, 0.0f, 1.0f);
+
+	TextureLoader::GetRef().Tick();
+	TextureResidencyManager::GetRef().Tick();
+
+	for (Texture2D* texture : usedTextures)
+	{
+		TextureResidencyManager::GetRef().NotifyUsage(texture, static_cast<float>(TEXTURE_SIZE));
+	}
+
+	glManager.EndFrame();
+}
+
+/**     մϴ. ڵ 尡   ֵ  ̿  մϴ. */
+template <typename TCondition>
+static bool RunFramesUntil(TCondition condition, const std::vector<Texture2D*>& usedTextures)
+{
+	for (uint32_t frame = 0; frame < MAX_WAIT_FRAME_COUNT && !condition(); ++frame)
+	{
+		RunFrame(usedTextures);
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+
+	return condition();
+}
+
+/** ̹  񵿱 ҷ, ε尡    մϴ. */
+static std::vector<Texture2D*> LoadTextures(const std::string& name, uint32_t count)
+{
+	std::vector<Texture2D*> textures;
+	for (uint32_t index = 0; index < count; ++index)
+	{
+		std::string path = GetTestFilePath(name + std::to_string(index) + ".tga");
+		TEST_EXPECT(WriteTGAFile(path, TEXTURE_SIZE, static_cast<uint8_t>(32 * (index + 1))));
+		textures.push_back(TextureLoader::GetRef().LoadAsync(path, ITexture::EFilter::LINEAR));
+	}
+
+	bool bIsLoaded = RunFramesUntil([&]() { return TextureLoader::GetRef().IsIdle(); }, {});
+	TEST_EXPECT(bIsLoaded);
+
+	for (const Texture2D* texture : textures)
+	{
+		TEST_EXPECT(texture->IsResident() && texture->GetResidentMipLevel() == 0);
+	}
+
+	return textures;
+}
+
+/** ؽó ıϰ,  ڰ  󿡼 ϵ   մϴ. */
+static void DestroyTextures(const std::vector<Texture2D*>& textures)
+{
+	for (const Texture2D* texture : textures)
+	{
+		GLManager::GetRef().Destroy(texture);
+	}
+
+	RunFrame({});
+	TEST_EXPECT(TextureResidencyManager::GetRef().GetStatistics().textureCount == 0);
+}
+
+/**  پ    ؽó,   ؽó    , MIN_RESIDENT_SIZE       ˻մϴ. */
+static void TestEvictionOrderAndFloor()
+{
+	TextureResidencyManager& residencyManager = TextureResidencyManager::GetRef();
+	residencyManager.SetBudget(TextureResidencyManager::DEFAULT_BUDGET_BYTE_SIZE);
+
+	std::vector<Texture2D*> textures = LoadTextures("Eviction", 4);
+
+	/** 0, 1, 2    ϰ, 3  ʽϴ.   ֱٿ   ° ǵ  մϴ. */
+	for (uint32_t index = 0; index < 3; ++index)
+	{
+		RunFrame({ textures[index] });
+		for (uint32_t frame = 0; frame < USAGE_GAP_FRAME_COUNT; ++frame)
+		{
+			RunFrame({});
+		}
+	}
+
+	uint64_t fullByteSize = textures[0]->GetGPUMemoryByteSize(0);
+	int32_t floorMipLevel = GetFloorMipLevel(textures[0]);
+	uint64_t floorByteSize = textures[0]->GetGPUMemoryByteSize(floorMipLevel);
+
+	/**  ؽó ϳ  ̸,  ŭ   ϴ. */
+	const uint32_t expectedOrder[] = { 3, 0, 1, 2 };
+	for (uint32_t evictedCount = 1; evictedCount <= 4; ++evictedCount)
+	{
+		residencyManager.SetBudget((4 - evictedCount) * fullByteSize + evictedCount * floorByteSize);
+		RunFrame({});
+
+		for (uint32_t order = 0; order < 4; ++order)
+		{
+			int32_t expectedMipLevel = (order < evictedCount) ? floorMipLevel : 0;
+			TEST_EXPECT(textures[expectedOrder[order]]->GetResidentMipLevel() == expectedMipLevel);
+		}
+
+		TextureResidencyStatistics statistics = residencyManager.GetStatistics();
+		TEST_EXPECT(statistics.residentByteSize <= statistics.budgetByteSize);
+		TEST_EXPECT(liveTextureByteSize - GetResidentByteSize(textures) == 4); // ڸ ǥ ؽó(1x1 RGBA8) .
+	}
+
+	/**    ٵ ,       ä Ӵϴ. */
+	residencyManager.SetBudget(1);
+	RunFrame({});
+
+	for (const Texture2D* texture : textures)
+	{
+		TEST_EXPECT(texture->GetResidentMipLevel() == floorMipLevel);
+	}
+	TEST_EXPECT(residencyManager.GetStatistics().residentByteSize == 4 * floorByteSize);
+
+	DestroyTextures(textures);
+}
+
+/**
+ *    ϴ     ״ ϰ,  ߿       Բ ص
+ * ¥ OpenGL  GPU ޸𸮰     ʴ ˻մϴ.
+ */
+static void TestStreamWithinBudget()
+{
+	TextureResidencyManager& residencyManager = TextureResidencyManager::GetRef();
+	residencyManager.SetBudget(TextureResidencyManager::DEFAULT_BUDGET_BYTE_SIZE);
+
+	std::vector<Texture2D*> textures = LoadTextures("Stream", 4);
+
+	residencyManager.SetBudget(1);
+	RunFrame({});
+
+	int32_t floorMipLevel = GetFloorMipLevel(textures[0]);
+	uint64_t fullByteSize = textures[0]->GetGPUMemoryByteSize(0);
+	uint64_t floorByteSize = textures[0]->GetGPUMemoryByteSize(floorMipLevel);
+
+	/** ü ؽó  Դϴ.          Բ ϴ   ѽϴ. */
+	uint64_t budgetByteSize = 2 * fullByteSize + 3 * floorByteSize;
+	residencyManager.SetBudget(budgetByteSize);
+
+	uint64_t totalStreamedLevelCount = residencyManager.GetStatistics().totalStreamedLevelCount;
+	uint64_t placeholderByteSize = liveTextureByteSize - GetResidentByteSize(textures);
+	bool bIsPendingChecked = false;
+	uint32_t idleFrameCount = 0;
+
+	for (uint32_t frame = 0; frame < MAX_WAIT_FRAME_COUNT && idleFrameCount < USAGE_GAP_FRAME_COUNT; ++frame)
+	{
+		peakTextureByteSize = liveTextureByteSize;
+		RunFrame(textures);
+
+		TextureResidencyStatistics statistics = residencyManager.GetStatistics();
+		TEST_EXPECT(peakTextureByteSize - placeholderByteSize <= budgetByteSize);
+		TEST_EXPECT(statistics.residentByteSize + statistics.reservedByteSize <= budgetByteSize);
+		TEST_EXPECT(statistics.peakByteSize <= budgetByteSize);
+
+		/**  û ӿ ڵ  ʾǷ,  ؽó û    εǾ մϴ. */
+		if (!bIsPendingChecked && statistics.pendingStreamCount > 0)
+		{
+			bIsPendingChecked = true;
+			for (const Texture2D* texture : textures)
+			{
+				TEST_EXPECT(texture->IsResident() && texture->GetResidentMipLevel() == floorMipLevel);
+			}
+		}
+
+		idleFrameCount = (statistics.pendingStreamCount == 0 && statistics.streamedLevelCount == 0 && statistics.evictedLevelCount == 0) ? idleFrameCount + 1 : 0;
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+
+	TextureResidencyStatistics statistics = residencyManager.GetStatistics();
+	TEST_EXPECT(bIsPendingChecked);
+	TEST_EXPECT(statistics.pendingStreamCount == 0 && statistics.reservedByteSize == 0);
+	TEST_EXPECT(statistics.totalStreamedLevelCount > totalStreamedLevelCount);
+	TEST_EXPECT(statistics.residentByteSize > 4 * floorByteSize && statistics.residentByteSize <= budgetByteSize);
+	TEST_EXPECT(std::any_of(textures.begin(), textures.end(), [](const Texture2D* texture) { return texture->GetResidentMipLevel() == 0; }));
+	TEST_EXPECT(liveTextureByteSize - placeholderByteSize == GetResidentByteSize(textures));
+
+	DestroyTextures(textures);
+}
+
+/**   ų  ٲ ؽó    ϰ,     ä ٽ  û ʴ ˻մϴ. */
+static void TestStreamFailure()
+{
+	TextureResidencyManager& residencyManager = TextureResidencyManager::GetRef();
+	residencyManager.SetBudget(TextureResidencyManager::DEFAULT_BUDGET_BYTE_SIZE);
+
+	std::vector<Texture2D*> textures = LoadTextures("Failure", 2);
+	int32_t floorMipLevel = GetFloorMipLevel(textures[0]);
+
+	residencyManager.SetBudget(1);
+	RunFrame({});
+	residencyManager.SetBudget(TextureResidencyManager::DEFAULT_BUDGET_BYTE_SIZE);
+
+	std::error_code errorCode;
+	std::filesystem::remove(textures[0]->GetPath(), errorCode);
+	TEST_EXPECT(WriteTGAFile(textures[1]->GetPath(), TEXTURE_SIZE / 2, 0));
+
+	uint32_t streamFailedCount = residencyManager.GetStatistics().streamFailedCount;
+	bool bIsFailed = RunFramesUntil([&]() { return residencyManager.GetStatistics().streamFailedCount == streamFailedCount + 2; }, textures);
+	TEST_EXPECT(bIsFailed);
+
+	/**  ؽó  ̻  û Ƿ,  ص      ʽϴ. */
+	for (uint32_t frame = 0; frame < USAGE_GAP_FRAME_COUNT; ++frame)
+	{
+		RunFrame(textures);
+
+		TextureResidencyStatistics statistics = residencyManager.GetStatistics();
+		TEST_EXPECT(statistics.pendingStreamCount == 0 && statistics.streamFailedCount == streamFailedCount + 2);
+	}
+
+	for (const Texture2D* texture : textures)
+	{
+		TEST_EXPECT(texture->IsResident() && texture->GetResidentMipLevel() == floorMipLevel);
+	}
+	TEST_EXPECT(liveTextureByteSize - GetResidentByteSize(textures) == 4);
+
+	DestroyTextures(textures);
+}
+
+/** ŷ ؽó       εؼ ϴ ˻մϴ.  ũ ε  ¥ OpenGL ˻մϴ. */
+static void TestCompressedStream()
+{
+	TextureResidencyManager& residencyManager = TextureResidencyManager::GetRef();
+	residencyManager.SetBudget(TextureResidencyManager::DEFAULT_BUDGET_BYTE_SIZE);
+
+	/** S3TC Ȯ ʿ  BC4  ü  ü մϴ. */
+	TextureContainer container;
+	container.Reset(ECompressedFormat::BC4, TEXTURE_SIZE, TEXTURE_SIZE);
+	for (int32_t size = TEXTURE_SIZE; size >= 1; size >>= 1)
+	{
+		container.AddLevel(size, size, std::vector<uint8_t>(TextureContainer::GetLevelByteSize(ECompressedFormat::BC4, size, size), 0));
+	}
+
+	std::string path = GetTestFilePath(std::string("Compressed") + TextureContainer::FILE_EXTENSION);
+	TEST_EXPECT(container.Save(path));
+
+	Texture2D* texture = GLManager::GetRef().Create<Texture2D>(path, ITexture::EFilter::LINEAR);
+	residencyManager.Register(texture);
+
+	residencyManager.SetBudget(1);
+	RunFrame({});
+	TEST_EXPECT(texture->GetResidentMipLevel() == GetFloorMipLevel(texture));
+
+	residencyManager.SetBudget(TextureResidencyManager::DEFAULT_BUDGET_BYTE_SIZE);
+	bool bIsStreamed = RunFramesUntil([&]() { return texture->GetResidentMipLevel() == 0; }, { texture });
+	TEST_EXPECT(bIsStreamed);
+	TEST_EXPECT(liveTextureByteSize - texture->GetGPUMemoryByteSize() == 4);
+
+	DestroyTextures({ texture });
+}
+
+void RunTextureResidencyTest()
+{
+	InstallFakeGL();
+
+	std::error_code errorCode;
+	std::filesystem::create_directories(std::filesystem::temp_directory_path() / "DodgeBallTextureResidencyTest", errorCode);
+
+	/** GL Ŵ  ĥ  ImGui ϹǷ ؽƮ ϴ. ȭ ũⰡ 0̸ ImGui  ƹ͵ ׸ ʰ, â  ϵ  ʽϴ. */
+	ImGui::CreateContext();
+	ImGui::GetIO().IniFilename = nullptr;
+	ImGui::GetIO().DisplaySize = ImVec2(0.0f, 0.0f);
+	ImGui::GetIO().Fonts->Build();
+
+	TextureLoader::GetRef().Startup();
+	TextureResidencyManager::GetRef().Startup();
+
+	TestEvictionOrderAndFloor();
+	TestStreamWithinBudget();
+	TestStreamFailure();
+	TestCompressedStream();
+
+	TextureResidencyManager::GetRef().Shutdown();
+	TextureLoader::GetRef().Shutdown();
+
+	ImGui::DestroyContext();
+	std::filesystem::remove_all(std::filesystem::temp_directory_path() / "DodgeBallTextureResidencyTest", errorCode);
+
+	TEST_EXPECT(fakeErrorCount == 0);
+}
\ No newline at end of file
@@ -0,0 +1,284 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+#include "Job/JobManager.h"
+
+#include "TextureCooker.h"
+
+/**  ϳ ؼ Դϴ. */
+static const int32_t BLOCK_TEXEL_COUNT = 16;
+
+/** ּ  ã ŵ ݺ ȽԴϴ. */
+static const int32_t POWER_ITERATION_COUNT = 4;
+
+/** RGB888  RGB565 ȭմϴ. */
+static uint16_t PackRGB565(const float* color)
+{
+	int32_t r = std::clamp(static_cast<int32_t>(color[0] * (31.0f / 255.0f) + 0.5f), 0, 31);
+	int32_t g = std::clamp(static_cast<int32_t>(color[1] * (63.0f / 255.0f) + 0.5f), 0, 63);
+	int32_t b = std::clamp(static_cast<int32_t>(color[2] * (31.0f / 255.0f) + 0.5f), 0, 31);
+	return static_cast<uint16_t>((r << 11) | (g << 5) | b);
+}
+
+/** RGB565  ڴ   RGB888 մϴ. */
+static void UnpackRGB565(uint16_t packed, int32_t* outColor)
+{
+	int32_t r = (packed >> 11) & 31;
+	int32_t g = (packed >> 5) & 63;
+	int32_t b = packed & 31;
+
+	outColor[0] = (r << 3) | (r >> 2);
+	outColor[1] = (g << 2) | (g >> 4);
+	outColor[2] = (b << 3) | (b >> 2);
+}
+
+/**
+ *    ּ (л  ִ  )    ؼ ϰ, ؼ   ȷƮ  ε մϴ.
+ *  ׻ color0 > color1 ǵ ؼ, BC1   ( ) մϴ.
+ */
+static void CompressColorBlock(const uint8_t* texels, uint8_t* outBlock)
+{
+	float mean[3] = {};
+	for (int32_t texel = 0; texel < BLOCK_TEXEL_COUNT; ++texel)
+	{
+		for (int32_t channel = 0; channel < 3; ++channel)
+		{
+			mean[channel] += texels[texel * 4 + channel];
+		}
+	}
+	for (auto& value : mean)
+	{
+		value /= static_cast<float>(BLOCK_TEXEL_COUNT);
+	}
+
+	float covariance[6] = {}; // rr, rg, rb, gg, gb, bb
+	float minColor[3] = { 255.0f, 255.0f, 255.0f };
+	float maxColor[3] = { 0.0f, 0.0f, 0.0f };
+	for (int32_t texel = 0; texel < BLOCK_TEXEL_COUNT; ++texel)
+	{
+		float r = texels[texel * 4 + 0] - mean[0];
+		float g = texels[texel * 4 + 1] - mean[1];
+		float b = texels[texel * 4 + 2] - mean[2];
+
+		covariance[0] += r * r;
+		covariance[1] += r * g;
+		covariance[2] += r * b;
+		covariance[3] += g * g;
+		covariance[4] += g * b;
+		covariance[5] += b * b;
+
+		for (int32_t channel = 0; channel < 3; ++channel)
+		{
+			minColor[channel] = std::min(minColor[channel], static_cast<float>(texels[texel * 4 + channel]));
+			maxColor[channel] = std::max(maxColor[channel], static_cast<float>(texels[texel * 4 + channel]));
+		}
+	}
+
+	/**   밢 ؼ ŵ ݺ ּ  ٻմϴ. */
+	float axis[3] = { maxColor[0] - minColor[0], maxColor[1] - minColor[1], maxColor[2] - minColor[2] };
+	for (int32_t iteration = 0; iteration < POWER_ITERATION_COUNT; ++iteration)
+	{
+		float r = axis[0] * covariance[0] + axis[1] * covariance[1] + axis[2] * covariance[2];
+		float g = axis[0] * covariance[1] + axis[1] * covariance[3] + axis[2] * covariance[4];
+		float b = axis[0] * covariance[2] + axis[1] * covariance[4] + axis[2] * covariance[5];
+
+		float length = std::max(std::max(std::abs(r), std::abs(g)), std::abs(b));
+		if (length <= 0.0f)
+		{
+			break;
+		}
+
+		axis[0] = r / length;
+		axis[1] = g / length;
+		axis[2] = b / length;
+	}
+
+	int32_t minTexel = 0;
+	int32_t maxTexel = 0;
+	float minProjection = 0.0f;
+	float maxProjection = 0.0f;
+	for (int32_t texel = 0; texel < BLOCK_TEXEL_COUNT; ++texel)
+	{
+		float projection = texels[texel * 4 + 0] * axis[0] + texels[texel * 4 + 1] * axis[1] + texels[texel * 4 + 2] * axis[2];
+		if (texel == 0 || projection < minProjection)
+		{
+			minProjection = projection;
+			minTexel = texel;
+		}
+		if (texel == 0 || projection > maxProjection)
+		{
+			maxProjection = projection;
+			maxTexel = texel;
+		}
+	}
+
+	float endpoint0[3] = { static_cast<float>(texels[maxTexel * 4 + 0]), static_cast<float>(texels[maxTexel * 4 + 1]), static_cast<float>(texels[maxTexel * 4 + 2]) };
+	float endpoint1[3] = { static_cast<float>(texels[minTexel * 4 + 0]), static_cast<float>(texels[minTexel * 4 + 1]), static_cast<float>(texels[minTexel * 4 + 2]) };
+
+	uint16_t color0 = PackRGB565(endpoint0);
+	uint16_t color1 = PackRGB565(endpoint1);
+	if (color0 < color1)
+	{
+		std::swap(color0, color1);
+	}
+
+	uint32_t indices = 0;
+	if (color0 != color1)
+	{
+		int32_t palette[4][3];
+		UnpackRGB565(color0, palette[0]);
+		UnpackRGB565(color1, palette[1]);
+		for (int32_t channel = 0; channel < 3; ++channel)
+		{
+			palette[2][channel] = (2 * palette[0][channel] + palette[1][channel]) / 3;
+			palette[3][channel] = (palette[0][channel] + 2 * palette[1][channel]) / 3;
+		}
+
+		for (int32_t texel = 0; texel < BLOCK_TEXEL_COUNT; ++texel)
+		{
+			uint32_t bestIndex = 0;
+			int32_t bestDistance = INT32_MAX;
+			for (uint32_t index = 0; index < 4; ++index)
+			{
+				int32_t distance = 0;
+				for (int32_t channel = 0; channel < 3; ++channel)
+				{
+					int32_t delta = texels[texel * 4 + channel] - palette[index][channel];
+					distance += delta * delta;
+				}
+
+				if (distance < bestDistance)
+				{
+					bestDistance = distance;
+					bestIndex = index;
+				}
+			}
+
+			indices |= bestIndex << (2 * texel);
+		}
+	}
+
+	std::memcpy(outBlock + 0, &color0, sizeof(color0));
+	std::memcpy(outBlock + 2, &color1, sizeof(color1));
+	std::memcpy(outBlock + 4, &indices, sizeof(indices));
+}
+
+/**
+ *   ä BC4 (   ؼ 3Ʈ ε) մϴ.
+ *  ִ񰪰 ּڰ̰,   (value0 > value1)  ̸ ϰ ܰ մϴ.
+ */
+static void CompressChannelBlock(const uint8_t* texels, int32_t channel, uint8_t* outBlock)
+{
+	int32_t minValue = 255;
+	int32_t maxValue = 0;
+	for (int32_t texel = 0; texel < BLOCK_TEXEL_COUNT; ++texel)
+	{
+		minValue = std::min(minValue, static_cast<int32_t>(texels[texel * 4 + channel]));
+		maxValue = std::max(maxValue, static_cast<int32_t>(texels[texel * 4 + channel]));
+	}
+
+	int32_t palette[8] = { maxValue, minValue };
+	for (int32_t index = 2; index < 8; ++index)
+	{
+		palette[index] = ((8 - index) * maxValue + (index - 1) * minValue) / 7;
+	}
+
+	uint64_t indices = 0;
+	if (maxValue != minValue)
+	{
+		for (int32_t texel = 0; texel < BLOCK_TEXEL_COUNT; ++texel)
+		{
+			int32_t value = texels[texel * 4 + channel];
+
+			uint64_t bestIndex = 0;
+			int32_t bestDistance = INT32_MAX;
+			for (int32_t index = 0; index < 8; ++index)
+			{
+				int32_t distance = std::abs(value - palette[index]);
+				if (distance < bestDistance)
+				{
+					bestDistance = distance;
+					bestIndex = static_cast<uint64_t>(index);
+				}
+			}
+
+			indices |= bestIndex << (3 * texel);
+		}
+	}
+
+	outBlock[0] = static_cast<uint8_t>(maxValue);
+	outBlock[1] = static_cast<uint8_t>(minValue);
+	for (int32_t byte = 0; byte < 6; ++byte)
+	{
+		outBlock[2 + byte] = static_cast<uint8_t>(indices >> (8 * byte));
+	}
+}
+
+void CompressBlockBC1(const uint8_t* texels, uint8_t* outBlock)
+{
+	CompressColorBlock(texels, outBlock);
+}
+
+void CompressBlockBC3(const uint8_t* texels, uint8_t* outBlock)
+{
+	CompressChannelBlock(texels, 3, outBlock);
+	CompressColorBlock(texels, outBlock + 8);
+}
+
+void CompressBlockBC4(const uint8_t* texels, uint8_t* outBlock)
+{
+	CompressChannelBlock(texels, 0, outBlock);
+}
+
+void CompressBlockBC5(const uint8_t* texels, uint8_t* outBlock)
+{
+	CompressChannelBlock(texels, 0, outBlock);
+	CompressChannelBlock(texels, 1, outBlock + 8);
+}
+
+void CompressImage(const CookImage& image, const ECompressedFormat& format, std::vector<uint8_t>& outData)
+{
+	int32_t blockCountX = (image.width + 3) / 4;
+	int32_t blockCountY = (image.height + 3) / 4;
+	uint32_t blockByteSize = TextureContainer::GetBlockByteSize(format);
+
+	outData.resize(TextureContainer::GetLevelByteSize(format, image.width, image.height));
+
+	void (*compressBlock)(const uint8_t*, uint8_t*) = nullptr;
+	switch (format)
+	{
+	case ECompressedFormat::BC1: compressBlock = CompressBlockBC1; break;
+	case ECompressedFormat::BC3: compressBlock = CompressBlockBC3; break;
+	case ECompressedFormat::BC4: compressBlock = CompressBlockBC4; break;
+	case ECompressedFormat::BC5: compressBlock = CompressBlockBC5; break;
+	default: return;
+	}
+
+	JobManager::GetRef().ParallelFor(static_cast<uint32_t>(blockCountY), 4, [&](uint32_t beginBlockY, uint32_t endBlockY)
+	{
+		uint8_t texels[BLOCK_TEXEL_COUNT * 4];
+		for (int32_t blockY = static_cast<int32_t>(beginBlockY); blockY < static_cast<int32_t>(endBlockY); ++blockY)
+		{
+			for (int32_t blockX = 0; blockX < blockCountX; ++blockX)
+			{
+				/**  ؼ RGBA ϴ. ̹  ؼ ڸ ؼ ݺϰ,  ä 0(Ĵ 255) äϴ. */
+				for (int32_t texel = 0; texel < BLOCK_TEXEL_COUNT; ++texel)
+				{
+					int32_t x = std::min(blockX * 4 + (texel % 4), image.width - 1);
+					int32_t y = std::min(blockY * 4 + (texel / 4), image.height - 1);
+					const uint8_t* pixel = image.pixels.data() + (static_cast<std::size_t>(y) * image.width + x) * image.channels;
+
+					uint8_t* rgba = texels + texel * 4;
+					rgba[0] = pixel[0];
+					rgba[1] = (image.channels > 1) ? pixel[1] : 0;
+					rgba[2] = (image.channels > 2) ? pixel[2] : 0;
+					rgba[3] = (image.channels > 3) ? pixel[3] : 255;
+				}
+
+				compressBlock(texels, outData.data() + (static_cast<std::size_t>(blockY) * blockCountX + blockX) * blockByteSize);
+			}
+		}
+	});
+}
\ No newline at end of file
@@ -0,0 +1,181 @@
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include <stb_image.h>
+
+#include "GL/TextureContainer.h"
+#include "Job/JobManager.h"
+#include "Utils/GameTimer.h"
+
+#include "TextureCooker.h"
+
+/**   ̸Դϴ. ε   - 1Դϴ. */
+static const char* FORMAT_NAMES[] = { "bc1", "bc3", "bc4", "bc5" };
+
+/**
+ *  ڷ ޵ ŷ ɼԴϴ.
+ * --format=FORMAT :  Դϴ. bc1, bc3, bc4, bc5  ϳ̰,   ̹ ä  մϴ.
+ *      : ŷ ̹ Դϴ.  Ȯڸ .dbtex ٲ ο մϴ.
+ */
+struct CookOption
+{
+	bool bIsFormatSpecified = false;
+	ECompressedFormat format = ECompressedFormat::BC1;
+	std::vector<std::string> inputPaths;
+};
+
+static bool ParseCookOption(int32_t argc, char* argv[], CookOption& outOption)
+{
+	static const std::string FORMAT_OPTION = "--format=";
+
+	for (int32_t index = 1; index < argc; ++index)
+	{
+		std::string argument = argv[index];
+		if (argument.compare(0, FORMAT_OPTION.size(), FORMAT_OPTION) == 0)
+		{
+			std::string formatName = argument.substr(FORMAT_OPTION.size());
+
+			outOption.bIsFormatSpecified = false;
+			for (uint32_t format = 0; format < sizeof(FORMAT_NAMES) / sizeof(FORMAT_NAMES[0]); ++format)
+			{
+				if (formatName == FORMAT_NAMES[format])
+				{
+					outOption.format = static_cast<ECompressedFormat>(format + 1);
+					outOption.bIsFormatSpecified = true;
+				}
+			}
+
+			if (!outOption.bIsFormatSpecified)
+			{
+				std::printf("unknown format: %s\n", formatName.c_str());
+				return false;
+			}
+		}
+		else
+		{
+			outOption.inputPaths.push_back(argument);
+		}
+	}
+
+	return !outOption.inputPaths.empty();
+}
+
+/** ̹ ä    մϴ.  ؼ  RGBA ̹ ĸ  BC1 մϴ. */
+static ECompressedFormat SelectFormat(const CookImage& image)
+{
+	switch (image.channels)
+	{
+	case 1: return ECompressedFormat::BC4;
+	case 2: return ECompressedFormat::BC5;
+	case 3: return ECompressedFormat::BC1;
+	default: break;
+	}
+
+	for (std::size_t index = 3; index < image.pixels.size(); index += 4)
+	{
+		if (image.pixels[index] != 255)
+		{
+			return ECompressedFormat::BC3;
+		}
+	}
+
+	return ECompressedFormat::BC1;
+}
+
+/**  ð и  ϴ. */
+static double GetElapsedMilliseconds(uint64_t beginTicks)
+{
+	return 1000.0 * GameTimer::ConvertTicksToSeconds(GameTimer::GetCurrentTicks() - beginTicks);
+}
+
+/** ̹  ϳ ŷմϴ. */
+static bool CookTexture(const std::string& inputPath, const CookOption& option)
+{
+	uint64_t beginTicks = GameTimer::GetCurrentTicks();
+
+	CookImage image;
+	/**
+	 *  (BC1/BC3) stb_image ä  ȯϵ ûմϴ(ȸ ,  ߰/).
+	 * BC4/BC5  ä(R, RG) ״ ؾ ϴµ,  ä ȯ ȸ+ĸ    äη ҷɴϴ.
+	 */
+	bool bIsColorFormat = (option.format == ECompressedFormat::BC1 || option.format == ECompressedFormat::BC3);
+	int32_t desiredChannels = (option.bIsFormatSpecified && bIsColorFormat) ? TextureContainer::GetChannelCount(option.format) : 0;
+	uint8_t* imagePtr = stbi_load(inputPath.c_str(), &image.width, &image.height, &image.channels, desiredChannels);
+	if (!imagePtr)
+	{
+		std::printf("%s: failed to load (%s)\n", inputPath.c_str(), stbi_failure_reason());
+		return false;
+	}
+
+	image.channels = desiredChannels ? desiredChannels : image.channels;
+	image.pixels.assign(imagePtr, imagePtr + static_cast<std::size_t>(image.width) * image.height * image.channels);
+	stbi_image_free(imagePtr);
+
+	double decodeMilliseconds = GetElapsedMilliseconds(beginTicks);
+	beginTicks = GameTimer::GetCurrentTicks();
+
+	std::vector<CookImage> levels;
+	GenerateMipChain(image, levels);
+
+	double mipMilliseconds = GetElapsedMilliseconds(beginTicks);
+	beginTicks = GameTimer::GetCurrentTicks();
+
+	ECompressedFormat format = option.bIsFormatSpecified ? option.format : SelectFormat(image);
+
+	TextureContainer container;
+	container.Reset(format, image.width, image.height);
+
+	uint64_t uncompressedByteSize = 0;
+	for (const auto& level : levels)
+	{
+		std::vector<uint8_t> data;
+		CompressImage(level, format, data);
+		container.AddLevel(level.width, level.height, std::move(data));
+
+		uncompressedByteSize += level.pixels.size();
+	}
+
+	double compressMilliseconds = GetElapsedMilliseconds(beginTicks);
+
+	std::string outputPath = std::filesystem::path(inputPath).replace_extension(TextureContainer::FILE_EXTENSION).string();
+	if (!container.Save(outputPath))
+	{
+		std::printf("%s: failed to write %s\n", inputPath.c_str(), outputPath.c_str());
+		return false;
+	}
+
+	uint64_t compressedByteSize = container.GetDataByteSize();
+	std::printf("%s -> %s: %dx%d, %d channels, %s, %d levels, %.2f KiB -> %.2f KiB (%.1fx), decode: %.2f ms, mip: %.2f ms, compress: %.2f ms\n",
+		inputPath.c_str(), outputPath.c_str(), image.width, image.height, image.channels, FORMAT_NAMES[static_cast<uint32_t>(format) - 1], container.GetMipLevelCount(),
+		static_cast<double>(uncompressedByteSize) / 1024.0, static_cast<double>(compressedByteSize) / 1024.0, static_cast<double>(uncompressedByteSize) / static_cast<double>(compressedByteSize),
+		decodeMilliseconds, mipMilliseconds, compressMilliseconds);
+	return true;
+}
+
+/**
+ * ̹  ڵϰ,  ü ؼ    ŷ ؽó (.dbtex) մϴ.
+ * ex) DodgeBallTextureCooker --format=bc3 Resource/Texture/Ball.png Resource/Texture/Floor.png
+ */
+int32_t main(int32_t argc, char* argv[])
+{
+	CookOption option;
+	if (!ParseCookOption(argc, argv, option))
+	{
+		std::printf("usage: %s [--format=bc1|bc3|bc4|bc5] <image> [<image> ...]\n", argv[0]);
+		return 1;
+	}
+
+	JobManager::GetRef().Startup();
+
+	int32_t failCount = 0;
+	for (const auto& inputPath : option.inputPaths)
+	{
+		failCount += CookTexture(inputPath, option) ? 0 : 1;
+	}
+
+	JobManager::GetRef().Shutdown();
+	return (failCount == 0) ? 0 : 1;
+}
\ No newline at end of file
@@ -0,0 +1,82 @@
+#include <algorithm>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define TEXTURE_COOKER_SSE2
+#endif
+
+#include "TextureCooker.h"
+
+/**  ̹   2x2 ڽ ͷ ؼ   մϴ. Ȧ ʺ   ڸ ؼ ݺմϴ. */
+static void DownsampleRow(const uint8_t* row0, const uint8_t* row1, int32_t sourceWidth, int32_t channels, uint8_t* outRow, int32_t width)
+{
+	int32_t x = 0;
+
+#if defined(TEXTURE_COOKER_SSE2)
+	/** RGBA ̹   ؼ(  64Ʈ)  ؼ մϴ. 16Ʈ Ȯؼ ϹǷ ݿø  Į ο ϴ. */
+	if (channels == 4)
+	{
+		const __m128i zero = _mm_setzero_si128();
+		const __m128i rounding = _mm_set1_epi16(2);
+
+		for (; x + 4 <= width && 2 * x + 8 <= sourceWidth; x += 4)
+		{
+			__m128i sums[2];
+			for (int32_t half = 0; half < 2; ++half)
+			{
+				__m128i top = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row0 + (2 * x + 4 * half) * 4));
+				__m128i bottom = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row1 + (2 * x + 4 * half) * 4));
+
+				__m128i low = _mm_add_epi16(_mm_unpacklo_epi8(top, zero), _mm_unpacklo_epi8(bottom, zero));   // ؼ 0, 1  
+				__m128i high = _mm_add_epi16(_mm_unpackhi_epi8(top, zero), _mm_unpackhi_epi8(bottom, zero)); // ؼ 2, 3  
+
+				low = _mm_add_epi16(low, _mm_srli_si128(low, 8));
+				high = _mm_add_epi16(high, _mm_srli_si128(high, 8));
+				sums[half] = _mm_srli_epi16(_mm_add_epi16(_mm_unpacklo_epi64(low, high), rounding), 2);
+			}
+
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(outRow + x * 4), _mm_packus_epi16(sums[0], sums[1]));
+		}
+	}
+#endif
+
+	for (; x < width; ++x)
+	{
+		int32_t x0 = std::min(2 * x, sourceWidth - 1) * channels;
+		int32_t x1 = std::min(2 * x + 1, sourceWidth - 1) * channels;
+
+		for (int32_t channel = 0; channel < channels; ++channel)
+		{
+			uint32_t sum = row0[x0 + channel] + row0[x1 + channel] + row1[x0 + channel] + row1[x1 + channel];
+			outRow[x * channels + channel] = static_cast<uint8_t>((sum + 2) >> 2);
+		}
+	}
+}
+
+void GenerateMipChain(const CookImage& image, std::vector<CookImage>& outLevels)
+{
+	outLevels.clear();
+	outLevels.push_back(image);
+
+	while (outLevels.back().width > 1 || outLevels.back().height > 1)
+	{
+		const CookImage& source = outLevels.back();
+
+		CookImage level;
+		level.width = std::max(source.width >> 1, 1);
+		level.height = std::max(source.height >> 1, 1);
+		level.channels = source.channels;
+		level.pixels.resize(static_cast<std::size_t>(level.width) * level.height * level.channels);
+
+		std::size_t sourcePitch = static_cast<std::size_t>(source.width) * source.channels;
+		std::size_t pitch = static_cast<std::size_t>(level.width) * level.channels;
+		for (int32_t y = 0; y < level.height; ++y)
+		{
+			const uint8_t* row0 = source.pixels.data() + std::min(2 * y, source.height - 1) * sourcePitch;
+			const uint8_t* row1 = source.pixels.data() + std::min(2 * y + 1, source.height - 1) * sourcePitch;
+			DownsampleRow(row0, row1, source.width, source.channels, level.pixels.data() + y * pitch, level.width);
+		}
+
+		outLevels.push_back(std::move(level));
+	}
+}
\ No newline at end of file
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "GL/TextureContainer.h"
+
+/** ŷ  8Ʈ ̹Դϴ. ȼ     ä  մϴ. */
+struct CookImage
+{
+	int32_t width = 0;
+	int32_t height = 0;
+	int32_t channels = 0;
+	std::vector<uint8_t> pixels;
+};
+
+/**
+ * 0  1x1  ü 2x2 ڽ ͷ մϴ.  ù ° Ҵ  ̹ 纻Դϴ.
+ * Ȧ ũ ڸ ؼ ݺؼ øϰ, RGBA ̹ SSE2  ؼ ͸մϴ.
+ */
+void GenerateMipChain(const CookImage& image, std::vector<CookImage>& outLevels);
+
+/** 4x4 RGBA ؼ(64Ʈ) BC1 (8Ʈ) մϴ. Ĵ մϴ. */
+void CompressBlockBC1(const uint8_t* texels, uint8_t* outBlock);
+
+/** 4x4 RGBA ؼ(64Ʈ) BC3 (16Ʈ) մϴ. */
+void CompressBlockBC3(const uint8_t* texels, uint8_t* outBlock);
+
+/** 4x4 RGBA ؼ(64Ʈ) R ä BC4 (8Ʈ) մϴ. */
+void CompressBlockBC4(const uint8_t* texels, uint8_t* outBlock);
+
+/** 4x4 RGBA ؼ(64Ʈ) R, G ä BC5 (16Ʈ) մϴ. */
+void CompressBlockBC5(const uint8_t* texels, uint8_t* outBlock);
+
+/**
+ * ̹ ü  մϴ. 4  ƴ ũ ڸ ؼ ݺؼ  äϴ.
+ *    Ŵ ParallelFor  ϹǷ,  Ŵ ʱȭ ڿ ȣؾ մϴ.
+ */
+void CompressImage(const CookImage& image, const ECompressedFormat& format, std::vector<uint8_t>& outData);
\ No newline at end of file